@@ -1,3 +1,4 @@
+#include <doctest/doctest.h>
 #include "analysis.h"
 #include "auxiliary.h"
 #include "core.h"
@@ -8,6 +9,8 @@
 #include "multipole.h"
 #include "potentials.h"
 #include "sasa.h"
+#include "checkpoint.h"
+#include "threadpool.h"
 #include "aux/iteratorsupport.h"
 #include "aux/eigensupport.h"
 #include "aux/arange.h"
@@ -27,6 +30,7 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <numeric>
 
 namespace Faunus::analysis {
 
@@ -45,6 +49,7 @@ void Analysis::_to_disk() {}
  */
 void Analysis::to_disk()
 {
+    wait();
     _to_disk();
 }
 
@@ -63,10 +68,19 @@ void Analysis::sample()
         number_of_steps++;
         if (sample_interval > 0 && number_of_steps > number_of_skipped_steps) {
             if ((number_of_steps % sample_interval) == 0) {
-                number_of_samples++;
-                timer.start();
-                _sample();
-                timer.stop();
+                if (asynchronous) {
+                    wait(); // previous sample must complete before the snapshot is overwritten
+                    number_of_samples++;
+                    Change change;
+                    change.everything = true;
+                    asynchronous->snapshot->sync(asynchronous->source, change);
+                    asynchronous->pending =
+                        asynchronous->thread_pool->runInBackground([this] { timedSample(); });
+                }
+                else {
+                    number_of_samples++;
+                    timedSample();
+                }
             }
         }
     }
@@ -75,6 +89,53 @@ void Analysis::sample()
     }
 }
 
+void Analysis::timedSample()
+{
+    timer.start();
+    _sample();
+    timer.stop();
+}
+
+/**
+ * @param source Space of the running simulation
+ * @param snapshot Copy of `source` that was used to construct this analysis
+ * @param thread_pool Pool whose workers run the samples; synchronous if it has a single thread
+ *
+ * The snapshot must have the same particles and groups as `source`, i.e. it
+ * must be created with `createSnapshot()`.
+ */
+void Analysis::sampleAsynchronously(const Space& source, std::unique_ptr<Space> snapshot,
+                                    std::shared_ptr<ThreadPool> thread_pool)
+{
+    if (&spc != snapshot.get()) {
+        throw std::logic_error("analysis must operate on the snapshot");
+    }
+    if (!thread_pool) {
+        throw std::logic_error("asynchronous sampling requires a thread pool");
+    }
+    asynchronous.reset(
+        new AsynchronousSampling{source, std::move(snapshot), std::move(thread_pool), {}});
+}
+
+/**
+ * A pending sample at this point would run on a partially destroyed object, so owners must
+ * call `wait()` in their destructor, see e.g. `CombinedAnalysis`.
+ */
+Analysis::~Analysis()
+{
+    assert(!asynchronous || !asynchronous->pending.valid());
+}
+
+/**
+ * @throw Rethrows any exception from the pending sample
+ */
+void Analysis::wait()
+{
+    if (asynchronous && asynchronous->pending.valid()) {
+        asynchronous->pending.get();
+    }
+}
+
 void Analysis::from_json(const json& j)
 {
     try {
@@ -98,6 +159,9 @@ void Analysis::to_json(json& json_output) const
             if (number_of_skipped_steps > 0) {
                 j["nskip"] = number_of_skipped_steps;
             }
+            if (asynchronous) {
+                j["async"] = true;
+            }
             if (timer.result() > 0.01) {
                 // only print if more than 1% of the time
                 j["relative time"] = roundValue(timer.result());
@@ -279,15 +343,146 @@ void CombinedAnalysis::to_disk()
     }
 }
 
+void CombinedAnalysis::wait()
+{
+    for (const auto& analysis : this->vec) {
+        analysis->wait();
+    }
+}
+
+CombinedAnalysis::~CombinedAnalysis()
+{
+    for (const auto& analysis : this->vec) {
+        try {
+            analysis->wait();
+        }
+        catch (std::exception& e) {
+            faunus_logger->error("{}: {}", analysis->name, e.what());
+        }
+    }
+}
+
+/**
+ * @param source Space to copy
+ * @return Independent copy of `source` with identical particles, groups, and geometry
+ *
+ * Triggers are not copied. Subsequent updates can be made with `Space::sync()`.
+ */
+std::unique_ptr<Space> createSnapshot(const Space& source)
+{
+    auto snapshot = std::make_unique<Space>();
+    snapshot->geometry = source.geometry;
+    snapshot->particles = source.particles;
+    snapshot->getImplicitReservoir() = source.getImplicitReservoir();
+    snapshot->groups.reserve(source.groups.size());
+    auto begin = snapshot->particles.begin();
+    for (const auto& group : source.groups) {
+        auto& copy = snapshot->groups.emplace_back(group.id, begin, begin + group.capacity());
+        copy.shallowCopy(group); // particles are already in place
+        begin = copy.trueend();
+    }
+    snapshot->updateRegistry();
+    return snapshot;
+}
+
+TEST_CASE("[Faunus] createSnapshot")
+{
+    using doctest::Approx;
+    Space spc;
+    SpaceFactory::makeWater(spc, 3, R"( {"type": "cuboid", "length": 20} )"_json);
+    auto snapshot = createSnapshot(spc);
+    CHECK_EQ(snapshot->geometry.getVolume(), Approx(spc.geometry.getVolume()));
+    REQUIRE_EQ(snapshot->particles.size(), spc.particles.size());
+    REQUIRE_EQ(snapshot->groups.size(), spc.groups.size());
+    for (std::size_t i = 0; i < spc.groups.size(); ++i) {
+        const auto& group = snapshot->groups[i];
+        CHECK_EQ(group.id, spc.groups[i].id);
+        CHECK_EQ(group.size(), spc.groups[i].size());
+        CHECK_EQ(group.capacity(), spc.groups[i].capacity());
+        CHECK_EQ(group.begin(), snapshot->particles.begin() + 3 * i); // not in `spc`
+    }
+    CHECK_EQ(snapshot->numMolecules<Space::GroupType::ANY>(0), 3);
+
+    const Point original_position = spc.particles.front().pos;
+    spc.particles.front().pos = {1.0, 2.0, 3.0};
+    CHECK_EQ(snapshot->particles.front().pos.x(), Approx(original_position.x()));
+    Change change;
+    change.everything = true;
+    snapshot->sync(spc, change);
+    CHECK_EQ(snapshot->particles.front().pos.x(), Approx(1.0));
+}
+
+TEST_CASE("[Faunus] Analysis::sampleAsynchronously")
+{
+    using doctest::Approx;
+    class MeanPosition : public Analysis
+    {
+        void _sample() override { mean += spc.particles.front().pos.x(); }
+
+      public:
+        Average<double> mean;
+        explicit MeanPosition(const Space& spc)
+            : Analysis(spc, "mean_position")
+        {
+            sample_interval = 2;
+        }
+    };
+
+    Space spc;
+    SpaceFactory::makeWater(spc, 2, R"( {"type": "cuboid", "length": 20} )"_json);
+    for (const auto number_of_threads : {1U, 2U}) { // a single thread samples synchronously
+        auto snapshot = createSnapshot(spc);
+        MeanPosition synchronous(spc);
+        MeanPosition asynchronous(*snapshot);
+        asynchronous.sampleAsynchronously(spc, std::move(snapshot),
+                                          std::make_shared<ThreadPool>(number_of_threads));
+        for (int step = 0; step < 100; ++step) {
+            spc.particles.front().pos.x() = 0.1 * step;
+            synchronous.sample();
+            asynchronous.sample();
+        }
+        asynchronous.wait();
+        CHECK_EQ(asynchronous.mean.size(), 50);
+        CHECK_EQ(asynchronous.mean.avg(), Approx(synchronous.mean.avg()));
+    }
+}
+
+/**
+ * Analyses with `async=true` are constructed with, and operate on, a snapshot of Space
+ * that is updated only when a sample is due, allowing the simulation to continue while
+ * the analysis is running. Samples run on the thread pool of the Hamiltonian, which is
+ * created with one thread per core if no energy term requested one. Analyses that need the
+ * Hamiltonian or the global random number generator are tied to the running simulation and
+ * cannot be asynchronous.
+ */
 CombinedAnalysis::CombinedAnalysis(const json& json_array, Space& spc, Energy::Hamiltonian& pot)
 {
+    const std::set<std::string> synchronous_only = {
+        "electricpotential", "groupmatrix",   "penaltyfunction", "savestate",
+        "systemenergy",      "virtualvolume", "virtualtranslate", "widom"};
     if (!json_array.is_array()) {
         throw ConfigurationError("json array expected");
     }
     for (const auto& j : json_array) {
         try {
             const auto& [key, json_parameters] = jsonSingleItem(j);
-            vec.emplace_back(createAnalysis(key, json_parameters, spc, pot));
+            if (json_parameters.is_object() && json_parameters.value("async", false)) {
+                if (synchronous_only.contains(key)) {
+                    throw ConfigurationError("{}: asynchronous sampling unsupported", key);
+                }
+                auto snapshot = createSnapshot(spc);
+                auto analysis = createAnalysis(key, json_parameters, *snapshot, pot);
+                auto thread_pool = pot.getThreadPool(0);
+                if (thread_pool->size() == 1) {
+                    faunus_logger->warn("{}: single thread available; sampling synchronously", key);
+                }
+                analysis->sampleAsynchronously(spc, std::move(snapshot), thread_pool);
+                vec.emplace_back(std::move(analysis));
+                faunus_logger->debug("{}: sampling asynchronously", key);
+            }
+            else {
+                vec.emplace_back(createAnalysis(key, json_parameters, spc, pot));
+            }
         }
         catch (std::exception& e) {
             throw ConfigurationError("analysis: {}", e.what()).attachJson(j);
@@ -646,6 +841,16 @@ void SaveState::setWriteFunction(const Space& spc)
         // Universal Binary JSON state file
         writeFunc = [&](auto& file) { saveBinaryJsonStateFile(file, spc); };
     }
+    else if (suffix == "cpt") {
+        // Memory-mappable checkpoint; snapshot is taken here and written in the background
+        checkpoint_writer = std::make_unique<Checkpoint::AsyncWriter>();
+        writeFunc = [&](auto& file) {
+            auto buffer = save_random_number_generator_state
+                          ? Checkpoint::serialize(spc, &move::Move::slump, &random)
+                          : Checkpoint::serialize(spc);
+            checkpoint_writer->write(file, std::move(buffer));
+        };
+    }
     else {
         throw ConfigurationError("unknown file extension for '{}'", filename);
     }
@@ -1217,6 +1422,220 @@ PointVector MassCenterDisplacement::getPositions() const
 
 //----------------------------
 
+/**
+ * @brief Tabulated nonbonded energy of a probe particle with a set of static particles
+ *
+ * Each grid node holds the energy of a probe with all static particles. Pairs closer than
+ * `exact_distance` are evaluated with the probe moved out to that distance, so that the
+ * tabulated function stays smooth. At lookup, such close pairs are found in a cell list and
+ * replaced by their exact energy. One grid is created for each probe atom type and charge.
+ * Only isotropic pair potentials are supported.
+ */
+class WidomInsertion::StaticGrid
+{
+    using Grid = Tabulate::Grid<double>;
+    using Key = std::pair<AtomData::index_type, double>;
+    const Space& spc;
+    Energy::NonbondedBase& nonbonded;
+    double spacing;                          //!< Maximum node spacing (Å)
+    double exact_distance;                   //!< Pairs closer than this are evaluated exactly (Å)
+    Grid::Interpolation interpolation;       //!< Interpolation scheme
+    std::shared_ptr<ThreadPool> thread_pool; //!< Tabulates nodes in parallel; serial if empty
+    std::vector<std::pair<Key, Grid>> grids; //!< Grid of each probe type
+    std::array<int, 3> number_of_cells = {1, 1, 1}; //!< Cells along each axis
+    Point cell_length;                               //!< Cell length along each axis
+    std::vector<std::vector<std::size_t>> cells;     //!< Static particle indices in each cell
+
+    /** Energy with the probe moved out to `exact_distance` if closer */
+    double tabulatedPairEnergy(const Particle& probe, const Particle& other) const
+    {
+        const Point distance = spc.geometry.vdist(probe.pos, other.pos);
+        const auto squared_distance = distance.squaredNorm();
+        if (squared_distance >= exact_distance * exact_distance) {
+            return nonbonded.particleParticleEnergy(probe, other);
+        }
+        Particle moved_probe = probe;
+        moved_probe.pos = other.pos + ((squared_distance > 0.0)
+                                           ? Point(distance * exact_distance /
+                                                   std::sqrt(squared_distance))
+                                           : Point(exact_distance, 0.0, 0.0));
+        spc.geometry.boundary(moved_probe.pos);
+        return nonbonded.particleParticleEnergy(moved_probe, other);
+    }
+
+    std::array<int, 3> cellCoordinates(const Point& position) const
+    {
+        const Point scaled = (position + 0.5 * spc.geometry.getLength()).cwiseQuotient(cell_length);
+        std::array<int, 3> cell;
+        for (int axis = 0; axis < 3; ++axis) {
+            cell[axis] = std::clamp(static_cast<int>(std::floor(scaled[axis])), 0,
+                                    number_of_cells[axis] - 1);
+        }
+        return cell;
+    }
+
+    std::size_t cellIndex(const std::array<int, 3>& cell) const
+    {
+        return (static_cast<std::size_t>(cell[2]) * number_of_cells[1] + cell[1]) *
+                   number_of_cells[0] +
+               cell[0];
+    }
+
+    /** Difference between exact and tabulated energies of static particles close to the probe */
+    double correction(const Particle& probe) const
+    {
+        const auto center = cellCoordinates(probe.pos);
+        const auto periodic = spc.geometry.boundaryConditions().isPeriodic();
+        std::array<std::size_t, 27> visited_cells;
+        std::size_t number_of_visited_cells = 0;
+        double energy = 0.0;
+        for (int dz = -1; dz <= 1; ++dz) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    std::array<int, 3> cell = {center[0] + dx, center[1] + dy, center[2] + dz};
+                    bool outside = false;
+                    for (int axis = 0; axis < 3; ++axis) {
+                        const auto n = number_of_cells[axis];
+                        if (periodic[axis]) {
+                            cell[axis] = (cell[axis] + n) % n;
+                        }
+                        else if (cell[axis] < 0 || cell[axis] >= n) {
+                            outside = true;
+                        }
+                    }
+                    if (outside) {
+                        continue;
+                    }
+                    const auto index = cellIndex(cell);
+                    const auto visited_end = visited_cells.begin() + number_of_visited_cells;
+                    if (std::find(visited_cells.begin(), visited_end, index) != visited_end) {
+                        continue; // with less than three cells, neighbours may coincide
+                    }
+                    visited_cells[number_of_visited_cells++] = index;
+                    for (const auto particle_index : cells[index]) {
+                        const auto& other = static_particles[particle_index];
+                        if (spc.geometry.sqdist(probe.pos, other.pos) <
+                            exact_distance * exact_distance) {
+                            energy += nonbonded.particleParticleEnergy(probe, other) -
+                                      tabulatedPairEnergy(probe, other);
+                        }
+                    }
+                }
+            }
+        }
+        return energy;
+    }
+
+    const Grid* find(const Particle& probe) const
+    {
+        const auto it = std::ranges::find_if(grids, [&](const auto& key_and_grid) {
+            return key_and_grid.first == Key{probe.id, probe.charge};
+        });
+        return (it == grids.end()) ? nullptr : &it->second;
+    }
+
+  public:
+    const ParticleVector static_particles; //!< Copy used for tabulation
+
+    StaticGrid(const Space& spc, Energy::NonbondedBase& nonbonded,
+               ParticleVector static_particles, const json& j,
+               std::shared_ptr<ThreadPool> thread_pool)
+        : spc(spc)
+        , nonbonded(nonbonded)
+        , spacing(j.value("spacing", 1.0))
+        , exact_distance(j.value("exact_distance", 4.0))
+        , interpolation(j.value("interpolation", "cubic"s) == "linear"
+                            ? Grid::Interpolation::LINEAR
+                            : Grid::Interpolation::CUBIC)
+        , thread_pool(std::move(thread_pool))
+        , static_particles(std::move(static_particles))
+    {
+        if (exact_distance <= 0.0) {
+            throw ConfigurationError("exact_distance must be positive");
+        }
+        const Point box = spc.geometry.getLength();
+        for (int axis = 0; axis < 3; ++axis) {
+            number_of_cells[axis] = std::max(1, static_cast<int>(box[axis] / exact_distance));
+            cell_length[axis] = box[axis] / number_of_cells[axis];
+        }
+        cells.resize(static_cast<std::size_t>(number_of_cells[0]) * number_of_cells[1] *
+                     number_of_cells[2]);
+        for (std::size_t i = 0; i < this->static_particles.size(); ++i) {
+            cells[cellIndex(cellCoordinates(this->static_particles[i].pos))].push_back(i);
+        }
+    }
+
+    /** Tabulate energy of probes not seen before; the most expensive step */
+    void addProbes(const ParticleVector& probes)
+    {
+        for (const auto& probe : probes) {
+            if (find(probe) != nullptr) {
+                continue;
+            }
+            const Point half_box = 0.5 * spc.geometry.getLength();
+            Grid grid({-half_box.x(), -half_box.y(), -half_box.z()},
+                      {half_box.x(), half_box.y(), half_box.z()}, {true, true, true}, spacing,
+                      interpolation);
+            const auto nodes = grid.nodes();
+            std::vector<double> values(nodes.size());
+            auto tabulate = [&](const std::size_t first, const std::size_t last) {
+                Particle node_probe = probe;
+                for (auto i = first; i < last; ++i) {
+                    node_probe.pos = {nodes[i][0], nodes[i][1], nodes[i][2]};
+                    values[i] = 0.0;
+                    for (const auto& other : static_particles) {
+                        values[i] += tabulatedPairEnergy(node_probe, other);
+                    }
+                }
+            };
+            parallelFor(thread_pool.get(), nodes.size(), tabulate);
+            grid.setValues(std::move(values));
+            faunus_logger->debug("widom: tabulated {} nodes for atom {} with charge {}",
+                                 grid.size(), Faunus::atoms.at(probe.id).name, probe.charge);
+            grids.emplace_back(Key{probe.id, probe.charge}, std::move(grid));
+        }
+    }
+
+    /** Energy of probe with all static particles; probe must have been added */
+    double energy(const Particle& probe) const
+    {
+        const auto* grid = find(probe);
+        assert(grid != nullptr);
+        const Grid::Coordinate point = {probe.pos.x(), probe.pos.y(), probe.pos.z()};
+        if (!grid->contains(point)) { // possible outside cuboidal containers
+            return std::accumulate(static_particles.begin(), static_particles.end(), 0.0,
+                                   [&](const double sum, const auto& other) {
+                                       return sum + nonbonded.particleParticleEnergy(probe, other);
+                                   });
+        }
+        return (*grid)(point) + correction(probe);
+    }
+
+    /**
+     * @brief Split [0, size) in one contiguous range per thread
+     * @param thread_pool Thread pool; serial if null
+     * @param size Number of elements
+     * @param function Called with each range as `function(first, last)`
+     */
+    template <typename Function>
+    static void parallelFor(ThreadPool* thread_pool, const std::size_t size, Function& function)
+    {
+        const std::size_t number_of_threads = thread_pool ? thread_pool->size() : 1;
+        if (number_of_threads == 1 || size < 2 * number_of_threads) {
+            function(std::size_t(0), size);
+            return;
+        }
+        const auto chunk_size = (size + number_of_threads - 1) / number_of_threads;
+        std::vector<ThreadPool::Task> tasks;
+        tasks.reserve(number_of_threads);
+        for (std::size_t first = 0; first < size; first += chunk_size) {
+            const auto last = std::min(first + chunk_size, size);
+            tasks.emplace_back([&function, first, last]() { function(first, last); });
+        }
+        thread_pool->run(tasks);
+    }
+};
+
 /**
  * This searches for an inactive group of type `molid`
  * and prepares the `change` object for energy evaluation. If no
@@ -1245,6 +1664,9 @@ void WidomInsertion::_sample()
         faunus_logger->warn("{}: no inactive {} groups available", name,
                             Faunus::molecules[molid].name);
     }
+    else if (nonbonded) {
+        samplePairEnergies();
+    }
     else {
         auto& group =
             mutable_space.groups.at(change.groups.at(0).group_index); // inactive "ghost" group
@@ -1262,6 +1684,96 @@ void WidomInsertion::_sample()
     }
 }
 
+/**
+ * Insertions are generated serially in batches, whereafter their energies are evaluated in
+ * parallel and added to the average in order. The result is thus independent of the number
+ * of threads.
+ */
+void WidomInsertion::samplePairEnergies()
+{
+    updateStaticGrid();
+    mobile_particles.clear();
+    for (const auto& group : spc.groups) {
+        if (!static_grid || std::ranges::find(static_molids, group.id) == static_molids.end()) {
+            for (const auto& particle : group) { // active particles only; ghost is inactive
+                mobile_particles.push_back(&particle);
+            }
+        }
+    }
+
+    constexpr int insertions_per_thread = 1024; // per batch
+    const int number_of_threads = thread_pool ? static_cast<int>(thread_pool->size()) : 1;
+    for (int remaining = number_of_insertions; remaining > 0;) {
+        const auto batch_size = std::min(remaining, insertions_per_thread * number_of_threads);
+        trial_insertions.resize(batch_size);
+        trial_energies.resize(batch_size);
+        for (auto& particles : trial_insertions) {
+            particles = inserter->operator()(spc.geometry, Faunus::molecules[molid], spc.particles);
+            if (absolute_z_coords) {
+                std::ranges::for_each(particles,
+                                      [](Particle& i) { i.pos.z() = std::fabs(i.pos.z()); });
+            }
+            if (static_grid) {
+                static_grid->addProbes(particles); // no-op for known probes
+            }
+        }
+        auto evaluate = [&](const std::size_t first, const std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                trial_energies[i] = pairEnergy(trial_insertions[i]);
+            }
+        };
+        StaticGrid::parallelFor(thread_pool.get(), trial_insertions.size(), evaluate);
+        std::ranges::for_each(trial_energies, [&](auto energy) { collectWidomAverage(energy); });
+        remaining -= batch_size;
+    }
+}
+
+/**
+ * @return Nonbonded energy of the inserted particles with all mobile and static particles
+ */
+double WidomInsertion::pairEnergy(const ParticleVector& particles) const
+{
+    double energy = 0.0;
+    for (const auto& particle : particles) {
+        for (const auto* other : mobile_particles) {
+            energy += nonbonded->particleParticleEnergy(particle, *other);
+        }
+        if (static_grid) {
+            energy += static_grid->energy(particle);
+        }
+    }
+    return energy;
+}
+
+/**
+ * The grid is created upon first use and recreated if any static particle has changed
+ * position, type, or charge, which should normally not happen.
+ */
+void WidomInsertion::updateStaticGrid()
+{
+    if (static_molids.empty()) {
+        return;
+    }
+    ParticleVector static_particles;
+    for (const auto& group : spc.groups) {
+        if (std::ranges::find(static_molids, group.id) != static_molids.end()) {
+            static_particles.insert(static_particles.end(), group.begin(), group.end());
+        }
+    }
+    auto is_equal = [](const Particle& a, const Particle& b) {
+        return a.id == b.id && a.charge == b.charge && a.pos == b.pos;
+    };
+    if (static_grid &&
+        std::ranges::equal(static_grid->static_particles, static_particles, is_equal)) {
+        return;
+    }
+    if (static_grid) {
+        faunus_logger->warn("{}: static particles have changed; recreating grid", name);
+    }
+    static_grid = std::make_unique<StaticGrid>(spc, *nonbonded, std::move(static_particles),
+                                               grid_input, thread_pool);
+}
+
 void WidomInsertion::updateGroup(Space::GroupType& group, const ParticleVector& particles)
 {
     assert(particles.size() == group.size());
@@ -1286,6 +1798,13 @@ void WidomInsertion::_to_json(json& j) const
              {"absz", absolute_z_coords},
              {"insertscheme", *inserter},
              {unicode::mu + "/kT", {{"excess", excess_chemical_potential}}}};
+        if (nonbonded) {
+            j["energy"] = "nonbonded";
+            j["threads"] = thread_pool ? thread_pool->size() : 1;
+        }
+        if (!grid_input.is_null()) {
+            j["grid"] = grid_input;
+        }
     }
 }
 
@@ -1299,6 +1818,17 @@ void WidomInsertion::_from_json(const json& j)
 
     const auto molecule_name = j.at("molecule").get<std::string>();
     molid = findMoleculeByName(molecule_name).id();
+
+    if (j.contains("grid")) {
+        grid_input = j.at("grid");
+        for (const auto& static_name : grid_input.at("static").get<std::vector<std::string>>()) {
+            const auto static_molid = findMoleculeByName(static_name).id();
+            if (static_molid == molid) {
+                throw ConfigurationError("{}: inserted molecule cannot be static", name);
+            }
+            static_molids.push_back(static_molid);
+        }
+    }
 }
 
 WidomInsertion::WidomInsertion(const json& j, Space& spc, Energy::Hamiltonian& pot)
@@ -1307,6 +1837,112 @@ WidomInsertion::WidomInsertion(const json& j, Space& spc, Energy::Hamiltonian& p
     cite = "doi:10/dkv4s6";
     inserter = std::make_shared<RandomInserter>();
     from_json(j);
+    if (j.contains("threads") || j.contains("grid")) {
+        const auto nonbonded_terms = pot.find<Energy::NonbondedBase>();
+        if (nonbonded_terms.size() != 1) {
+            throw ConfigurationError("{}: `threads` and `grid` require a single nonbonded energy",
+                                     name);
+        }
+        nonbonded = nonbonded_terms.front();
+        if (const auto threads = j.value("threads", 1U); threads != 1) {
+            thread_pool = pot.getThreadPool(threads);
+        }
+        faunus_logger->info("{}: only nonbonded energies are included in insertions", name);
+    }
+    if (!grid_input.is_null()) { // grids are tabulated later, so check the memory cost now
+        using Grid = Tabulate::Grid<double>;
+        const Point box = spc.geometry.getLength();
+        const auto interpolation = grid_input.value("interpolation", "cubic"s) == "linear"
+                                       ? Grid::Interpolation::LINEAR
+                                       : Grid::Interpolation::CUBIC;
+        const auto nodes = Grid::countNodes({0.0, 0.0, 0.0}, {box.x(), box.y(), box.z()},
+                                            {true, true, true}, grid_input.value("spacing", 1.0),
+                                            interpolation);
+        if (nodes > static_cast<double>(Grid::max_size)) {
+            throw ConfigurationError("{}: {:.0f} grid nodes ({:.0f} MB per probe) exceeds the "
+                                     "maximum of {}; increase the spacing",
+                                     name, nodes, nodes * sizeof(double) / 1e6, Grid::max_size);
+        }
+    }
+}
+
+WidomInsertion::~WidomInsertion() = default;
+
+TEST_CASE("[Faunus] WidomInsertion")
+{
+    using doctest::Approx;
+    atoms = R"([
+        { "A": { "q": 1.0, "sigma": 2.0 } },
+        { "B": { "q": 1.0, "sigma": 2.0 } }
+    ])"_json.get<decltype(atoms)>();
+    molecules = R"([
+        { "static": { "atoms": ["A", "A", "A"], "atomic": true } },
+        { "probe": { "atoms": ["B"], "atomic": true } }
+    ])"_json.get<decltype(molecules)>();
+    Space spc = R"({
+        "geometry": {"type": "cuboid", "length": 12.0 },
+        "insertmolecules": [ { "static": { "N": 1 } }, { "probe": { "N": 1, "inactive": true } } ]
+    })"_json;
+    spc.particles.at(0).pos = {5.5, 5.5, -5.5}; // in a corner of the periodic box
+    spc.particles.at(1).pos = {0.0, 1.0, 0.0};
+    spc.particles.at(2).pos = {-2.0, -3.0, 4.0};
+    Energy::Hamiltonian pot(
+        spc, R"([{"nonbonded": {"default": [{"coulomb": {"type": "plain", "epsr": 80}}]}}])"_json);
+    auto nonbonded = pot.find<Energy::NonbondedBase>().front();
+    const ParticleVector static_particles(spc.groups.at(0).begin(), spc.groups.at(0).end());
+    const auto grid_input = R"({"spacing": 0.25, "exact_distance": 4.0})"_json;
+
+    SUBCASE("StaticGrid equals direct sum")
+    {
+        WidomInsertion::StaticGrid grid(spc, *nonbonded, static_particles, grid_input, nullptr);
+        WidomInsertion::StaticGrid threaded_grid(spc, *nonbonded, static_particles, grid_input,
+                                                 std::make_shared<ThreadPool>(3));
+        Particle probe = Faunus::atoms.at(1);
+        grid.addProbes({probe});
+        threaded_grid.addProbes({probe});
+        const std::vector<Point> positions = {
+            {0.5, 2.0, 0.0},   // closer than exact_distance
+            {-5.0, 5.0, -5.0}, // closer than exact_distance across one boundary
+            {-5.0, -5.5, 5.8}, // closer than exact_distance across three boundaries
+            {2.0, -4.0, -2.0}, // farther than exact_distance from all static particles
+        };
+        for (const auto& position : positions) {
+            probe.pos = position;
+            const auto direct_energy = std::accumulate(
+                static_particles.begin(), static_particles.end(), 0.0,
+                [&](const double sum, const auto& other) {
+                    return sum + nonbonded->particleParticleEnergy(probe, other);
+                });
+            CHECK_LT(std::fabs(grid.energy(probe) - direct_energy), 0.02);
+            CHECK_EQ(threaded_grid.energy(probe), grid.energy(probe));
+        }
+    }
+
+    SUBCASE("result is independent of grid and threads")
+    {
+        auto excess_chemical_potential = [&](const json& settings) {
+            Faunus::random = Random(); // same insertions for all settings
+            WidomInsertion widom(settings, spc, pot);
+            widom.sample();
+            json j;
+            widom.to_json(j);
+            return j.at("widom").at(unicode::mu + "/kT").at("excess").get<double>();
+        };
+        auto settings = R"({"molecule": "probe", "ninsert": 5000, "nstep": 1})"_json;
+        const auto full_hamiltonian = excess_chemical_potential(settings);
+        CHECK_GT(full_hamiltonian, 0.0); // repulsive
+        settings["threads"] = 1;
+        const auto single_thread = excess_chemical_potential(settings);
+        CHECK_EQ(single_thread, Approx(full_hamiltonian));
+        settings["threads"] = 3;
+        CHECK_EQ(excess_chemical_potential(settings), single_thread);
+        settings["grid"] = grid_input;
+        settings["grid"]["static"] = json::array({"static"});
+        const auto grid_with_threads = excess_chemical_potential(settings);
+        CHECK_EQ(grid_with_threads, Approx(full_hamiltonian).epsilon(0.01));
+        settings["threads"] = 1;
+        CHECK_EQ(excess_chemical_potential(settings), grid_with_threads);
+    }
 }
 
 double Density::updateVolumeStatistics()
@@ -2196,6 +2832,7 @@ SASAAnalysis::SASAAnalysis(const json& j, const Space& spc)
     : SASAAnalysis(j.value("radius", 1.4_angstrom), j.value("slices", 20),
                    j.value("resolution", 50.0), j.value("policy", Policies::INVALID), spc)
 {
+    sasa->from_json(j);
     from_json(j);
     policy->from_json(j);
 }
@@ -2209,6 +2846,7 @@ void SASAAnalysis::_to_json(json& json_ouput) const
     }
     json_ouput["radius"] = (probe_radius);
     json_ouput["slices_per_atom"] = (slices_per_atom);
+    json_ouput["method"] = sasa->getMethod();
     policy->to_json(json_ouput);
 }
 
@@ -2253,12 +2891,35 @@ void SASAAnalysis::_sample()
     policy->sample(spc, *this);
 }
 
+/**
+ * @brief Appends absolute indices of all active particles in a particle or group
+ * @return Number of appended indices
+ */
+static size_t appendParticleIndices(const Space& spc, const Particle& particle,
+                                    std::vector<size_t>& indices)
+{
+    indices.push_back(static_cast<size_t>(std::addressof(particle) - spc.particles.data()));
+    return 1;
+}
+
+static size_t appendParticleIndices(const Space& spc, const Group& group,
+                                    std::vector<size_t>& indices)
+{
+    const auto offset = spc.getFirstParticleIndex(group);
+    for (size_t i = 0; i < group.size(); ++i) {
+        indices.push_back(offset + i);
+    }
+    return group.size();
+}
+
 /** @brief samples sasa of each object (either a whole group or a particle)
  * by sampling each sasa between first and last individually
  * @param first iterator at first particle or group
  * @param last iterator at last particle or group
  * @param analysis SASAanalysis object to insert samples into
  *
+ * All areas are calculated in a single (possibly parallel) batch before being summed per object.
+ *
  * @tparam TBegin
  * @tparam TEnd
  * */
@@ -2266,10 +2927,20 @@ template <typename TBegin, typename TEnd>
 void AreaSamplingPolicy::sampleIndividualSASA(TBegin first, TEnd last, SASAAnalysis& analysis)
 {
     analysis.sasa->init(analysis.spc);
-    std::for_each(first, last, [&analysis](const auto& species) {
-        auto area = analysis.sasa->calcSASAOf(analysis.spc, species);
-        analysis.takeSample(area);
+    std::vector<size_t> indices;
+    std::vector<size_t> sizes;
+    std::for_each(first, last, [&](const auto& species) {
+        sizes.push_back(appendParticleIndices(analysis.spc, species, indices));
     });
+    analysis.sasa->updateSASA(analysis.spc, indices);
+    const auto& areas = analysis.sasa->getAreas();
+    auto index = indices.begin();
+    for (const auto size : sizes) {
+        const auto area = std::accumulate(index, index + size, 0.0,
+                                          [&](auto sum, auto i) { return sum + areas[i]; });
+        analysis.takeSample(area);
+        index += size;
+    }
 }
 
 /** @brief samples a sum of SASAs of objects (either a whole group or a particle)
@@ -2283,7 +2954,14 @@ template <typename TBegin, typename TEnd>
 void AreaSamplingPolicy::sampleTotalSASA(TBegin first, TEnd last, SASAAnalysis& analysis)
 {
     analysis.sasa->init(analysis.spc);
-    auto area = analysis.sasa->calcSASA(analysis.spc, first, last);
+    std::vector<size_t> indices;
+    std::for_each(first, last, [&](const auto& species) {
+        appendParticleIndices(analysis.spc, species, indices);
+    });
+    analysis.sasa->updateSASA(analysis.spc, indices);
+    const auto& areas = analysis.sasa->getAreas();
+    const auto area = std::accumulate(indices.begin(), indices.end(), 0.0,
+                                      [&](auto sum, auto i) { return sum + areas[i]; });
     analysis.takeSample(area);
     if (analysis.output_stream) {
         *analysis.output_stream << fmt::format("{} {:.3f}\n", analysis.getNumberOfSteps(), area);
@@ -2687,6 +3365,7 @@ void ScatteringFunction::_sample()
 
     switch (scheme) {
     case Schemes::DEBYE:
+    case Schemes::DEBYE_HISTOGRAM:
         debye->sample(scatter_positions, spc.geometry.getVolume());
         if (save_after_sample) {
             IO::writeKeyValuePairs(filename + "." + suffix, debye->getIntensity());
@@ -2715,6 +3394,11 @@ void ScatteringFunction::_to_json(json& j) const
         j["scheme"] = "debye";
         std::tie(j["qmin"], j["qmax"], std::ignore) = debye->getQMeshParameters();
         break;
+    case Schemes::DEBYE_HISTOGRAM:
+        j["scheme"] = "debye_histogram";
+        std::tie(j["qmin"], j["qmax"], std::ignore) = debye->getQMeshParameters();
+        j["dr"] = debye->getHistogramResolution();
+        break;
     case Schemes::EXPLICIT_PBC:
         j["scheme"] = "explicit";
         j["pmax"] = explicit_average_pbc->getQMultiplier();
@@ -2742,9 +3426,14 @@ try : Analysis(spc, "scatter") {
     const auto cuboid =
         std::dynamic_pointer_cast<Geometry::Cuboid>(spc.geometry.asSimpleGeometry());
 
-    if (const auto scheme_str = j.value("scheme", "explicit"s); scheme_str == "debye") {
+    if (const auto scheme_str = j.value("scheme", "explicit"s);
+        scheme_str == "debye" || scheme_str == "debye_histogram") {
         scheme = Schemes::DEBYE;
         debye = std::make_unique<Scatter::DebyeFormula<Tformfactor>>(j);
+        if (scheme_str == "debye_histogram") {
+            scheme = Schemes::DEBYE_HISTOGRAM;
+            debye->setHistogramResolution(j.value("dr", 0.01) * 1.0_angstrom);
+        }
         if (cuboid) {
             faunus_logger->warn("cuboidal cell detected: consider using the `explicit` scheme");
         }
@@ -2778,6 +3467,7 @@ void ScatteringFunction::_to_disk()
 {
     switch (scheme) {
     case Schemes::DEBYE:
+    case Schemes::DEBYE_HISTOGRAM:
         IO::writeKeyValuePairs(filename, debye->getIntensity());
         break;
     case Schemes::EXPLICIT_PBC:
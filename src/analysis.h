@@ -11,6 +11,7 @@
 #include "aux/equidistant_table.h"
 #include "aux/sparsehistogram.h"
 #include <Eigen/SparseCore>
+#include <future>
 #include <limits>
 #include <memory>
 #include <set>
@@ -29,9 +30,18 @@ class NewCoulombGalore;
 namespace Faunus::Energy {
 class Hamiltonian;
 class EnergyTerm;
+class NonbondedBase;
 class Penalty;
 } // namespace Faunus::Energy
 
+namespace Faunus {
+class ThreadPool;
+}
+
+namespace Faunus::Checkpoint {
+class AsyncWriter;
+}
+
 namespace Faunus::SASA {
 class SASABase;
 }
@@ -54,6 +64,13 @@ namespace Faunus::analysis {
  * of an existing trajectory. The base class adds basic
  * functionality such as timing, number of steps, json IO
  * and enforce a common interface.
+ *
+ * If `sampleAsynchronously()` is called, the analysis must have been constructed with a
+ * snapshot of Space. Whenever a sample is due, the snapshot is updated from the running
+ * simulation and `_sample()` is run on a worker of the given thread pool while the simulation
+ * continues. At most one sample per analysis is in flight so that samples are processed in
+ * order. The owner must call `wait()` before destruction, as the members of derived classes
+ * are destroyed before `~Analysis()` is reached.
  */
 class Analysis
 {
@@ -66,6 +83,17 @@ class Analysis
     int number_of_skipped_steps = 0;      //!< steps to skip before sampling (do not modify)
     TimeRelativeOfTotal<std::chrono::microseconds> timer; //!< timer to benchmark `_sample()`
 
+    /** Source and snapshot of Space when sampling on a separate thread */
+    struct AsynchronousSampling
+    {
+        const Space& source;                     //!< Space of the running simulation
+        std::unique_ptr<Space> snapshot;         //!< Copy of `source` which the analysis uses
+        std::shared_ptr<ThreadPool> thread_pool; //!< Runs the samples
+        std::future<void> pending;               //!< Sample currently being processed, if any
+    };
+    std::unique_ptr<AsynchronousSampling> asynchronous; //!< Set if sampling is asynchronous
+    void timedSample();                                 //!< Call `_sample()` and time it
+
   protected:
     const Space& spc;          //!< Instance of Space to analyse
     int sample_interval = 0;   //!< Steps in between each sample point (do not modify)
@@ -79,10 +107,13 @@ class Analysis
     void to_disk();                             //!< Save data to disk (if defined)
     void sample();                              //!< Increase step count and sample
     [[nodiscard]] int getNumberOfSteps() const; //!< Number of steps
+    void sampleAsynchronously(const Space& source, std::unique_ptr<Space> snapshot,
+                              std::shared_ptr<ThreadPool> thread_pool); //!< Sample copies
+    void wait(); //!< Wait for pending asynchronous sample
     Analysis(const Space& spc, std::string_view name);
     Analysis(const Space& spc, std::string_view name, int sample_interval,
              int number_of_skipped_steps);
-    virtual ~Analysis() = default;
+    virtual ~Analysis();
 };
 
 void to_json(json& j, const Analysis& base);
@@ -101,6 +132,8 @@ void to_json(json& j, const Analysis& base);
 std::unique_ptr<Analysis> createAnalysis(const std::string& name, const json& j, Space& spc,
                                          Energy::Hamiltonian& pot);
 
+std::unique_ptr<Space> createSnapshot(const Space& source); //!< Copy Space for async. analysis
+
 /**
  * @brief Aggregator class for storing and selecting multiple analysis instances
  *
@@ -112,8 +145,12 @@ class CombinedAnalysis : public BasePointerVector<Analysis>
 {
   public:
     CombinedAnalysis(const json& json_array, Space& spc, Energy::Hamiltonian& pot);
+    CombinedAnalysis(const CombinedAnalysis&) = delete;
+    CombinedAnalysis& operator=(const CombinedAnalysis&) = delete;
+    ~CombinedAnalysis();
     void sample();
     void to_disk(); //!< prompt all analysis to save to disk if appropriate
+    void wait();    //!< wait for all asynchronous analyses to finish their current sample
 };
 
 /**
@@ -230,23 +267,44 @@ class MassCenterDisplacement : public AtomicDisplacement
 /**
  * @brief Excess chemical potential of molecules
  *
+ * By default, each insertion is evaluated with the full Hamiltonian. If `threads` or `grid`
+ * is given, only nonbonded pair energies between the inserted and all other active particles
+ * are summed, which allows batches of insertions to be evaluated in parallel. With `grid`, the
+ * energy due to static molecules is looked up in a pre-calculated grid per probe particle.
+ *
  * @todo Migrate `absolute_z_coords` into new `MoleculeInserter` policy
  */
 class WidomInsertion : public PerturbationAnalysis
 {
+  public:
+    class StaticGrid; //!< Defined in analysis.cpp; public only for unit testing
+
+  private:
     std::shared_ptr<MoleculeInserter> inserter; //!< Insertion method
     int number_of_insertions;                   //!< Number of insertions per sample event
     MoleculeData::index_type molid;             //!< Molecule id
     bool absolute_z_coords = false;             //!< Apply abs() on all inserted z coordinates?
+    std::shared_ptr<Energy::NonbondedBase> nonbonded; //!< Pair energies; empty if full Hamiltonian
+    std::shared_ptr<ThreadPool> thread_pool;          //!< Evaluates insertions; serial if empty
+    std::vector<MoleculeData::index_type> static_molids; //!< Molecules tabulated in `static_grid`
+    json grid_input;                                     //!< User input for `static_grid`
+    std::unique_ptr<StaticGrid> static_grid; //!< Energy of probes with static molecules
+    std::vector<const Particle*> mobile_particles; //!< Particles summed explicitly
+    std::vector<ParticleVector> trial_insertions;  //!< Batch of inserted configurations
+    std::vector<double> trial_energies;            //!< Energies of `trial_insertions`
 
     void selectGhostGroup(); //!< Select inactive group to act as group particle
     void updateGroup(Space::GroupType& group, const ParticleVector& particles);
+    void samplePairEnergies(); //!< Batched insertions using pair energies only
+    void updateStaticGrid();   //!< (Re)create `static_grid` if static particles have changed
+    [[nodiscard]] double pairEnergy(const ParticleVector& particles) const;
     void _sample() override; //!< Called for each sample event
     void _to_json(json& j) const override;
     void _from_json(const json& j) override;
 
   public:
     WidomInsertion(const json& j, Space& spc, Energy::Hamiltonian& pot);
+    ~WidomInsertion() override;
 };
 
 /**
@@ -612,6 +670,7 @@ class SaveState : public Analysis
 {
   private:
     std::function<void(const std::string&)> writeFunc = nullptr;
+    std::unique_ptr<Checkpoint::AsyncWriter> checkpoint_writer; //!< Background writer for .cpt
     bool save_random_number_generator_state = false;
     bool use_numbered_files = true;
     bool convert_hexagonal_prism_to_cuboid = false;
@@ -841,9 +900,10 @@ class ScatteringFunction : public Analysis
     enum class Schemes
     {
         DEBYE,
+        DEBYE_HISTOGRAM,
         EXPLICIT_PBC,
         EXPLICIT_IPBC
-    }; // three different schemes
+    }; // four different schemes
     Schemes scheme = Schemes::DEBYE;
     bool mass_center_scattering;          //!< scatter from mass center, only?
     bool save_after_sample = false;       //!< if true, save average S(q) after each sample point
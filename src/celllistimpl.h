@@ -531,12 +531,10 @@ class SparseContainer : virtual public AbstractContainer<TMember, TIndex>
     const Members& get(Index index) const override
     {
         assert(index >= 0 && index < indexEnd());
-        try {
-            return container.at(index);
-        }
-        catch (std::out_of_range& e) {
-            return empty_set;
+        if (auto it = container.find(index); it != container.end()) {
+            return it->second;
         }
+        return empty_set;
     }
 
     Members& get(Index index) override
@@ -655,7 +653,8 @@ class CellListBase
      */
     const Members& getMembers(const CellCoord& cell_coordinates) override
     {
-        return this->get(this->index(cell_coordinates));
+        // read-only lookup; unlike the mutable one, it never creates cells and is thread safe
+        return static_cast<const TContainer&>(*this).get(this->index(cell_coordinates));
     }
 
     /**
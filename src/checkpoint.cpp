@@ -0,0 +1,377 @@
+#include <doctest/doctest.h>
+#include "checkpoint.h"
+#include "space.h"
+#include "random.h"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FAUNUS_CHECKPOINT_MMAP
+#endif
+
+namespace Faunus::Checkpoint {
+
+namespace {
+
+constexpr char magic[8] = {'F', 'A', 'U', 'N', 'U', 'S', 'C', 'P'};
+constexpr std::uint32_t byte_order_marker = 0x01020304;
+
+constexpr std::size_t alignSection(std::size_t size) { return (size + 7) & ~std::size_t(7); }
+
+/** Byte offsets of the sections in a checkpoint with the given header */
+struct Layout
+{
+    std::size_t positions;
+    std::size_t charges;
+    std::size_t ids;
+    std::size_t groups;
+    std::size_t metadata;
+    std::size_t total;
+
+    explicit Layout(const Header& header)
+    {
+        const auto n = static_cast<std::size_t>(header.number_of_particles);
+        positions = alignSection(sizeof(Header));
+        charges = positions + alignSection(3 * n * sizeof(double));
+        ids = charges + alignSection(n * sizeof(double));
+        groups = ids + alignSection(n * sizeof(std::int32_t));
+        metadata = groups + alignSection(header.number_of_groups * sizeof(GroupRecord));
+        total = metadata + header.metadata_size;
+    }
+};
+
+template <typename T> void put(std::vector<std::byte>& buffer, std::size_t offset, const T& value)
+{
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+/** Names of all atom or molecule types; used to check that a checkpoint fits the topology */
+template <typename Topology> json topologyNames(const Topology& topology)
+{
+    auto names = json::array();
+    for (const auto& data : topology) {
+        names.push_back(data.name);
+    }
+    return names;
+}
+
+} // namespace
+
+std::vector<std::byte> serialize(const Space& spc, const Random* move_random,
+                                 const Random* global_random)
+{
+    json meta;
+    meta["geometry"] = spc.geometry;
+    meta["implicit_reservoir"] = spc.getImplicitReservoir();
+    meta["atoms"] = topologyNames(Faunus::atoms);
+    meta["molecules"] = topologyNames(Faunus::molecules);
+    auto& extensions = meta["extensions"] = json::array();
+    for (std::size_t i = 0; i < spc.particles.size(); ++i) {
+        if (spc.particles[i].hasExtension()) {
+            extensions.push_back({i, spc.particles[i]});
+        }
+    }
+    if (move_random != nullptr) {
+        meta["random-move"] = *move_random;
+    }
+    if (global_random != nullptr) {
+        meta["random-global"] = *global_random;
+    }
+    const auto metadata = json::to_ubjson(meta);
+
+    Header header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = format_version;
+    header.byte_order = byte_order_marker;
+    header.number_of_particles = spc.particles.size();
+    header.number_of_groups = spc.groups.size();
+    header.metadata_size = metadata.size();
+
+    const Layout layout(header);
+    std::vector<std::byte> buffer(layout.total); // zero initialized, incl. padding
+    put(buffer, 0, header);
+    for (std::size_t i = 0; i < spc.particles.size(); ++i) {
+        const auto& particle = spc.particles[i];
+        for (std::size_t k = 0; k < 3; ++k) {
+            put(buffer, layout.positions + (3 * i + k) * sizeof(double), particle.pos[k]);
+        }
+        put(buffer, layout.charges + i * sizeof(double), particle.charge);
+        put(buffer, layout.ids + i * sizeof(std::int32_t), static_cast<std::int32_t>(particle.id));
+    }
+    for (std::size_t i = 0; i < spc.groups.size(); ++i) {
+        const auto& group = spc.groups[i];
+        GroupRecord record{};
+        record.molid = static_cast<std::int32_t>(group.id);
+        record.confid = static_cast<std::int32_t>(group.conformation_id);
+        record.size = group.size();
+        record.capacity = group.capacity();
+        for (std::size_t k = 0; k < 3; ++k) {
+            record.mass_center[k] = group.mass_center[k];
+        }
+        put(buffer, layout.groups + i * sizeof(GroupRecord), record);
+    }
+    std::memcpy(buffer.data() + layout.metadata, metadata.data(), metadata.size());
+    return buffer;
+}
+
+/**
+ * The buffer is written to `filename.tmp` which is then renamed to `filename`. On POSIX
+ * systems the rename is atomic, so readers see either the old or the new checkpoint.
+ */
+void write(const std::string& filename, const std::vector<std::byte>& buffer)
+{
+    const auto temporary_filename = filename + ".tmp";
+    {
+        std::ofstream stream(temporary_filename, std::ios::binary);
+        stream.write(reinterpret_cast<const char*>(buffer.data()),
+                     static_cast<std::streamsize>(buffer.size()));
+        stream.close();
+        if (!stream) {
+            throw std::runtime_error("could not write checkpoint " + temporary_filename);
+        }
+    }
+    std::filesystem::rename(temporary_filename, filename);
+}
+
+Reader::Reader(const std::string& filename)
+{
+#ifdef FAUNUS_CHECKPOINT_MMAP
+    if (const int descriptor = ::open(filename.c_str(), O_RDONLY); descriptor >= 0) {
+        struct stat status;
+        if (::fstat(descriptor, &status) == 0 && status.st_size > 0) {
+            data_size = static_cast<std::size_t>(status.st_size);
+            void* address = ::mmap(nullptr, data_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (address != MAP_FAILED) {
+                data = static_cast<const std::byte*>(address);
+                is_mapped = true;
+            }
+        }
+        ::close(descriptor); // the mapping stays valid after closing
+    }
+#endif
+    if (!is_mapped) {
+        std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+        if (!stream) {
+            throw std::runtime_error("cannot open checkpoint " + filename);
+        }
+        buffer.resize(static_cast<std::size_t>(stream.tellg()));
+        stream.seekg(0, std::ios::beg);
+        stream.read(reinterpret_cast<char*>(buffer.data()),
+                    static_cast<std::streamsize>(buffer.size()));
+        data = buffer.data();
+        data_size = buffer.size();
+    }
+    try {
+        readHeader();
+    }
+    catch (...) {
+        unmap(); // destructor is not called if the constructor throws
+        throw;
+    }
+    faunus_logger->debug("checkpoint {} {}: {} particles, {} groups", filename,
+                         is_mapped ? "mapped" : "read", numParticles(), numGroups());
+}
+
+Reader::~Reader() { unmap(); }
+
+void Reader::unmap()
+{
+#ifdef FAUNUS_CHECKPOINT_MMAP
+    if (is_mapped) {
+        ::munmap(const_cast<std::byte*>(data), data_size);
+        is_mapped = false;
+    }
+#endif
+}
+
+template <typename T> T Reader::read(std::size_t offset, std::size_t index) const
+{
+    T value;
+    std::memcpy(&value, data + offset + index * sizeof(T), sizeof(T));
+    return value;
+}
+
+/**
+ * @throw std::runtime_error if the file is not a checkpoint, is from an incompatible version or
+ *        machine, or is truncated
+ */
+void Reader::readHeader()
+{
+    if (data_size < sizeof(Header)) {
+        throw std::runtime_error("checkpoint too small");
+    }
+    header = read<Header>(0);
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+        throw std::runtime_error("not a checkpoint file");
+    }
+    if (header.byte_order != byte_order_marker) {
+        throw std::runtime_error("checkpoint byte order does not match this machine");
+    }
+    if (header.version != format_version) {
+        throw std::runtime_error(
+            fmt::format("unsupported checkpoint version {}; expected {}", header.version,
+                        format_version));
+    }
+    // guard against overflow in the section offsets before calculating them
+    if (header.number_of_particles > data_size / sizeof(double) ||
+        header.number_of_groups > data_size / sizeof(GroupRecord) ||
+        header.metadata_size > data_size || Layout(header).total != data_size) {
+        throw std::runtime_error("checkpoint is truncated or corrupt");
+    }
+}
+
+std::size_t Reader::numParticles() const { return header.number_of_particles; }
+
+std::size_t Reader::numGroups() const { return header.number_of_groups; }
+
+json Reader::metadata() const
+{
+    const Layout layout(header);
+    const auto* begin = reinterpret_cast<const std::uint8_t*>(data + layout.metadata);
+    return json::from_ubjson(begin, begin + header.metadata_size);
+}
+
+/**
+ * Atom and molecule types must already be defined and match those used when the checkpoint
+ * was written. The Hamiltonian is not part of the checkpoint and must be initialized
+ * afterwards.
+ *
+ * @throw ConfigurationError if the topology differs from the one in the checkpoint
+ */
+void Reader::load(Space& spc) const
+{
+    const auto meta = metadata();
+    if (meta.at("atoms") != topologyNames(Faunus::atoms) ||
+        meta.at("molecules") != topologyNames(Faunus::molecules)) {
+        throw ConfigurationError("checkpoint atom or molecule types differ from input");
+    }
+    const Layout layout(header);
+    spc.clear();
+    spc.geometry = meta.at("geometry");
+    spc.particles.resize(numParticles());
+    for (std::size_t i = 0; i < spc.particles.size(); ++i) {
+        auto& particle = spc.particles[i];
+        for (std::size_t k = 0; k < 3; ++k) {
+            particle.pos[k] = read<double>(layout.positions, 3 * i + k);
+        }
+        particle.charge = read<double>(layout.charges, i);
+        particle.id = read<std::int32_t>(layout.ids, i);
+    }
+    for (const auto& extension : meta.at("extensions")) {
+        spc.particles.at(extension.at(0).get<std::size_t>()) = extension.at(1).get<Particle>();
+    }
+
+    auto begin = spc.particles.begin();
+    for (std::size_t i = 0; i < numGroups(); ++i) {
+        const auto record = read<GroupRecord>(layout.groups, i);
+        if (record.size > record.capacity ||
+            record.capacity > static_cast<std::size_t>(std::distance(begin, spc.particles.end()))) {
+            throw std::runtime_error("checkpoint group exceeds particle range");
+        }
+        Space::GroupType group(record.molid, begin, begin + record.capacity);
+        group.resize(record.size);
+        group.conformation_id = record.confid;
+        group.mass_center = {record.mass_center[0], record.mass_center[1], record.mass_center[2]};
+        spc.groups.push_back(group);
+        begin = group.trueend();
+    }
+    if (begin != spc.particles.end()) {
+        throw std::runtime_error("checkpoint has particles outside groups");
+    }
+    spc.updateRegistry();
+    for (const auto& pair : meta.at("implicit_reservoir")) {
+        spc.getImplicitReservoir()[pair.at(0)] = pair.at(1);
+    }
+}
+
+void AsyncWriter::write(const std::string& filename, std::vector<std::byte> buffer)
+{
+    wait();
+    pending_write = std::async(std::launch::async, [filename, buffer = std::move(buffer)]() {
+        Checkpoint::write(filename, buffer);
+    });
+}
+
+void AsyncWriter::wait()
+{
+    if (pending_write.valid()) {
+        pending_write.get();
+    }
+}
+
+AsyncWriter::~AsyncWriter()
+{
+    try {
+        wait();
+    }
+    catch (std::exception& e) {
+        faunus_logger->error("checkpoint writing failed: {}", e.what());
+    }
+}
+
+TEST_CASE("[Faunus] Checkpoint")
+{
+    using doctest::Approx;
+    Space spc;
+    SpaceFactory::makeWater(spc, 3, R"( {"type": "cuboid", "length": 20} )"_json);
+    spc.groups.back().resize(0); // deactivate last water molecule
+    spc.updateRegistry();
+    spc.particles.front().getExt().mu = {0.0, 0.0, 1.0};
+    spc.particles.front().getExt().mulen = 2.0;
+    spc.getImplicitReservoir()[0] = 5;
+
+    Random rng;
+    rng();
+    const auto filename = (std::filesystem::temp_directory_path() / "faunus_test.cpt").string();
+    {
+        AsyncWriter writer;
+        writer.write(filename, serialize(spc, &rng));
+    } // destructor waits for the write to finish
+
+    const Reader reader(filename);
+    CHECK_EQ(reader.numParticles(), spc.particles.size());
+    CHECK_EQ(reader.numGroups(), spc.groups.size());
+    CHECK_EQ(reader.metadata().at("random-move").at("seed"), json(rng).at("seed"));
+    CHECK_FALSE(reader.metadata().contains("random-global"));
+
+    Space restored;
+    reader.load(restored);
+    REQUIRE_EQ(restored.particles.size(), spc.particles.size());
+    for (std::size_t i = 0; i < spc.particles.size(); ++i) {
+        CHECK_EQ(restored.particles[i].id, spc.particles[i].id);
+        CHECK_EQ(restored.particles[i].charge, Approx(spc.particles[i].charge));
+        CHECK(restored.particles[i].pos.isApprox(spc.particles[i].pos));
+        CHECK_EQ(restored.particles[i].hasExtension(), spc.particles[i].hasExtension());
+    }
+    CHECK_EQ(restored.particles.front().getExt().mulen, Approx(2.0));
+    REQUIRE_EQ(restored.groups.size(), spc.groups.size());
+    for (std::size_t i = 0; i < spc.groups.size(); ++i) {
+        CHECK_EQ(restored.groups[i].size(), spc.groups[i].size());
+        CHECK_EQ(restored.groups[i].capacity(), spc.groups[i].capacity());
+        CHECK(restored.groups[i].mass_center.isApprox(spc.groups[i].mass_center));
+        CHECK(std::distance(restored.particles.begin(), restored.groups[i].begin()) ==
+              std::distance(spc.particles.begin(), spc.groups[i].begin()));
+    }
+    CHECK(restored.isRegistryValid());
+    CHECK_EQ(restored.numParticles(Space::Selection::ACTIVE), 6);
+    CHECK_EQ(restored.getImplicitReservoir().at(0), 5);
+    CHECK_EQ(restored.geometry.getVolume(), Approx(spc.geometry.getVolume()));
+
+    std::filesystem::remove(filename);
+
+    SUBCASE("Reject other files")
+    {
+        const auto other_filename = filename + ".json";
+        std::ofstream(other_filename) << "not a checkpoint";
+        CHECK_THROWS(Reader{other_filename});
+        std::filesystem::remove(other_filename);
+    }
+}
+
+} // namespace Faunus::Checkpoint
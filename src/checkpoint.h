@@ -0,0 +1,120 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace Faunus {
+
+class Space;
+class Random;
+
+/**
+ * @brief Binary, memory-mappable checkpoint files
+ *
+ * A checkpoint stores the particles and groups of a `Space` as flat arrays that can be read
+ * directly from a memory mapped file, which makes restarting large systems cheap compared to
+ * (binary) json state files. The file layout is:
+ *
+ * | Section     | Content                                                      |
+ * | ----------- | ------------------------------------------------------------ |
+ * | Header      | Magic string, format version, byte order, section sizes      |
+ * | Positions   | `3N` doubles (x, y, z for each particle)                     |
+ * | Charges     | `N` doubles                                                  |
+ * | Atom ids    | `N` 32-bit integers, padded to 8 bytes                       |
+ * | Groups      | One `GroupRecord` per group                                  |
+ * | Metadata    | Universal binary json with geometry, topology names,         |
+ * |             | implicit reservoir, particle extensions, and optionally the  |
+ * |             | random number generator states                               |
+ *
+ * All sections start at 8-byte aligned offsets. Only particles carrying extended properties
+ * (dipoles, quadrupoles, patches) are stored in the metadata, so the bulk of the data is
+ * binary. Files are written in native byte order and are rejected on a mismatching machine.
+ */
+namespace Checkpoint {
+
+constexpr std::uint32_t format_version = 1;
+
+struct Header
+{
+    char magic[8];                     //!< Always "FAUNUSCP"
+    std::uint32_t version;             //!< File format version
+    std::uint32_t byte_order;          //!< Written as 0x01020304 to detect endianness
+    std::uint64_t number_of_particles; //!< Particles incl. inactive ones
+    std::uint64_t number_of_groups;    //!< Number of groups
+    std::uint64_t metadata_size;       //!< Size of the metadata section (bytes)
+};
+
+struct GroupRecord
+{
+    std::int32_t molid;     //!< Molecule id
+    std::int32_t confid;    //!< Conformation id
+    std::uint64_t size;     //!< Number of active particles
+    std::uint64_t capacity; //!< Number of active and inactive particles
+    double mass_center[3];  //!< Mass center
+};
+
+/**
+ * @brief Snapshot of space (and optionally random number generators) as a checkpoint buffer
+ *
+ * This is the only part of a checkpoint that touches the simulation state; the returned buffer
+ * is self-contained and can be written to disk on another thread.
+ */
+std::vector<std::byte> serialize(const Space& spc, const Random* move_random = nullptr,
+                                 const Random* global_random = nullptr);
+
+void write(const std::string& filename, const std::vector<std::byte>& buffer); //!< Atomic write
+
+/**
+ * @brief Read-only, memory mapped view of a checkpoint file
+ *
+ * The file is mapped on construction and the header and section sizes are validated. Where
+ * memory mapping is unavailable, the file is read into memory instead.
+ */
+class Reader
+{
+  private:
+    const std::byte* data = nullptr;
+    std::size_t data_size = 0;
+    bool is_mapped = false;
+    std::vector<std::byte> buffer; //!< Fallback storage if the file is not memory mapped
+    Header header;
+
+    template <typename T> T read(std::size_t offset, std::size_t index = 0) const;
+    void readHeader(); //!< Read and validate header
+    void unmap();
+
+  public:
+    explicit Reader(const std::string& filename);
+    ~Reader();
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+    std::size_t numParticles() const;
+    std::size_t numGroups() const;
+    nlohmann::json metadata() const; //!< Decoded metadata section
+    void load(Space& spc) const;     //!< Replace particles and groups in space
+};
+
+/**
+ * @brief Writes checkpoint buffers on a background thread
+ *
+ * Each file is first written to a temporary file which is then renamed, so that an
+ * interrupted run never leaves a truncated checkpoint behind. At most one write is in flight;
+ * a new write, or destruction, waits for the previous one to finish.
+ */
+class AsyncWriter
+{
+  private:
+    std::future<void> pending_write;
+
+  public:
+    void write(const std::string& filename, std::vector<std::byte> buffer);
+    void wait(); //!< Wait for pending write; rethrows any error from the writer thread
+    ~AsyncWriter();
+};
+
+} // namespace Checkpoint
+} // namespace Faunus
@@ -54,6 +54,19 @@ EwaldData::EwaldData(const json& j)
         if (policy == EwaldData::INVALID)
             throw std::runtime_error("invalid `ewaldpolicy`");
     }
+    if (policy == EwaldData::SPME) {
+        const auto n_cutoff_ceil = static_cast<int>(std::ceil(n_cutoff));
+        mesh_size = j.value("mesh", PolicySPME::fftFriendlySize(4 * std::max(n_cutoff_ceil, 1)));
+        spline_order = j.value("spline_order", spline_order);
+        mesh_tolerance = j.value("mesh_tolerance", 0.0);
+        if (mesh_size <= 2 * n_cutoff_ceil) {
+            throw ConfigurationError("`mesh` must be larger than 2 x `ncutoff`");
+        }
+        if (spline_order < 2 || spline_order > std::min(max_spline_order, mesh_size)) {
+            throw ConfigurationError("`spline_order` must be in range [2:{}]",
+                                     std::min(max_spline_order, mesh_size));
+        }
+    }
 }
 
 void to_json(json& j, const EwaldData& d)
@@ -67,6 +80,10 @@ void to_json(json& j, const EwaldData& d)
          {"spherical_sum", d.use_spherical_sum},
          {"kappa", d.kappa},
          {"ewaldscheme", d.policy}};
+    if (d.policy == EwaldData::SPME) {
+        j["mesh"] = d.mesh_size;
+        j["spline_order"] = d.spline_order;
+    }
 }
 
 TEST_CASE("[Faunus] Ewald - EwaldData")
@@ -96,6 +113,62 @@ TEST_CASE("[Faunus] Ewald - EwaldData")
     CHECK_EQ(data.Q_ion.size(), data.k_vectors.cols());
 }
 
+EwaldExponentials::EwaldExponentials(const EwaldData& data)
+    : n_max(data.k_indices.size() > 0 ? data.k_indices.cwiseAbs().maxCoeff() : 0)
+    , box_length(data.box_length)
+{
+    assert(data.k_indices.cols() == data.k_vectors.cols());
+    for (int dim = 0; dim < 3; dim++) {
+        offsets[dim].resize(data.k_indices.cols());
+        for (int k = 0; k < data.k_indices.cols(); k++) {
+            offsets[dim][k] = data.k_indices(dim, k) + n_max;
+        }
+        cosines[dim].resize(2 * n_max + 1);
+        sines[dim].resize(2 * n_max + 1);
+    }
+}
+
+/**
+ * exp(inθ) = exp(i(n-1)θ) exp(iθ) and exp(-inθ) is the complex conjugate of exp(inθ).
+ * The round-off error grows linearly with n which is negligible for the typical n_max ~ 10.
+ */
+void EwaldExponentials::update(const Point& position)
+{
+    for (int dim = 0; dim < 3; dim++) {
+        const auto theta = 2.0 * pc::pi * position[dim] / box_length[dim];
+        const auto cos_theta = std::cos(theta);
+        const auto sin_theta = std::sin(theta);
+        auto* cosine = cosines[dim].data() + n_max; // index 0 corresponds to n = 0
+        auto* sine = sines[dim].data() + n_max;
+        cosine[0] = 1.0;
+        sine[0] = 0.0;
+        for (int n = 1; n <= n_max; n++) {
+            cosine[n] = cosine[n - 1] * cos_theta - sine[n - 1] * sin_theta;
+            sine[n] = sine[n - 1] * cos_theta + cosine[n - 1] * sin_theta;
+            cosine[-n] = cosine[n];
+            sine[-n] = -sine[n];
+        }
+    }
+}
+
+TEST_CASE("[Faunus] Ewald - EwaldExponentials")
+{
+    using doctest::Approx;
+    EwaldData data(R"({
+                "epsr": 1.0, "alpha": 0.894427190999916, "epss": 1.0,
+                "ncutoff": 7.0, "spherical_sum": true, "cutoff": 5.0})"_json);
+    PolicyIonIon policy;
+    policy.updateBox(data, {10.0, 12.0, 15.0});
+    EwaldExponentials exponentials(data);
+    const Point position = {-4.1, 2.3, 7.4};
+    exponentials.update(position);
+    for (int k = 0; k < data.k_vectors.cols(); k++) {
+        const auto k_dot_r = data.k_vectors.col(k).dot(position);
+        CHECK_EQ(exponentials[k].real(), Approx(std::cos(k_dot_r)));
+        CHECK_EQ(exponentials[k].imag(), Approx(std::sin(k_dot_r)));
+    }
+}
+
 //----------------- Ewald Policies -------------------
 
 std::unique_ptr<EwaldPolicyBase> EwaldPolicyBase::makePolicy(EwaldData::Policies policy)
@@ -109,6 +182,8 @@ std::unique_ptr<EwaldPolicyBase> EwaldPolicyBase::makePolicy(EwaldData::Policies
         return std::make_unique<PolicyIonIonIPBC>();
     case EwaldData::IPBCEigen:
         return std::make_unique<PolicyIonIonIPBCEigen>();
+    case EwaldData::SPME:
+        return std::make_unique<PolicySPME>();
     default:
         throw std::runtime_error("invalid Ewald policy");
     }
@@ -130,7 +205,8 @@ PolicyIonIonIPBC::PolicyIonIonIPBC()
  */
 void PolicyIonIon::updateBox(EwaldData& d, const Point& box) const
 {
-    assert(d.policy == EwaldData::PBC or d.policy == EwaldData::PBCEigen);
+    assert(d.policy == EwaldData::PBC or d.policy == EwaldData::PBCEigen or
+           d.policy == EwaldData::SPME);
     d.box_length = box;
     int n_cutoff_ceil = ceil(d.n_cutoff);
     d.check_k2_zero = 0.1 * std::pow(2 * pc::pi / d.box_length.maxCoeff(), 2);
@@ -138,6 +214,7 @@ void PolicyIonIon::updateBox(EwaldData& d, const Point& box) const
         (2 * n_cutoff_ceil + 1) * (2 * n_cutoff_ceil + 1) * (2 * n_cutoff_ceil + 1) - 1;
     if (k_vector_size == 0) {
         d.k_vectors.resize(3, 1);
+        d.k_indices.setZero(3, 1);
         d.Aks.resize(1);
         d.k_vectors.col(0) = Point(1, 0, 0); // Just so it is not the zero-vector
         d.Aks[0] = 0;
@@ -148,6 +225,7 @@ void PolicyIonIon::updateBox(EwaldData& d, const Point& box) const
     else {
         double nc2 = d.n_cutoff * d.n_cutoff;
         d.k_vectors.resize(3, k_vector_size);
+        d.k_indices.resize(3, k_vector_size);
         d.Aks.resize(k_vector_size);
         d.num_kvectors = 0;
         d.k_vectors.setZero();
@@ -171,6 +249,7 @@ void PolicyIonIon::updateBox(EwaldData& d, const Point& box) const
                             continue;
                     }
                     d.k_vectors.col(d.num_kvectors) = kv;
+                    d.k_indices.col(d.num_kvectors) << nx, ny, nz;
                     d.Aks[d.num_kvectors] = factor * exp(-k2 / (4 * d.alpha * d.alpha)) / k2;
                     d.num_kvectors++;
                 }
@@ -180,26 +259,22 @@ void PolicyIonIon::updateBox(EwaldData& d, const Point& box) const
         d.Q_dipole.resize(d.num_kvectors);
         d.Aks.conservativeResize(d.num_kvectors);
         d.k_vectors.conservativeResize(3, d.num_kvectors);
+        d.k_indices.conservativeResize(3, d.num_kvectors);
     }
 }
 
 /**
- * @todo Add OpenMP pragma to first loop
+ * The exponentials of each particle are generated by recurrence, see `EwaldExponentials`
  */
 void PolicyIonIon::updateComplex(EwaldData& data, const Space::GroupVector& groups) const
 {
-    for (int k = 0; k < data.k_vectors.cols(); k++) {
-        const Point& q = data.k_vectors.col(k);
-        EwaldData::Tcomplex Q(0, 0);
-        for (auto& g : groups) {       // loop over molecules
-            for (auto& particle : g) { // loop over active particles
-                double qr = q.dot(particle.pos);
-                Q += particle.charge *
-                     EwaldData::Tcomplex(std::cos(qr),
-                                         std::sin(qr)); // 'Q^q', see eq. 25 in ref.
-            }
+    EwaldExponentials exponentials(data);
+    data.Q_ion.setZero();
+    for (const auto& group : groups) {        // loop over molecules
+        for (const auto& particle : group) { // loop over active particles
+            exponentials.update(particle.pos);
+            exponentials.addTo(data.Q_ion, particle.charge); // 'Q^q', see eq. 25 in ref.
         }
-        data.Q_ion[k] = Q;
     }
 }
 
@@ -219,26 +294,22 @@ void PolicyIonIon::updateComplex(EwaldData& d, const Change& change,
                                  const Space::GroupVector& oldgroups) const
 {
     assert(groups.size() == oldgroups.size());
-    for (int k = 0; k < d.k_vectors.cols(); k++) {
-        auto& Q = d.Q_ion[k];
-        const Point& q = d.k_vectors.col(k);
-
-        for (auto& changed_group : change.groups) {
-            auto& g_new = groups.at(changed_group.group_index);
-            auto& g_old = oldgroups.at(changed_group.group_index);
-            const auto max_group_size = std::max(g_new.size(), g_old.size());
-            auto indices = (changed_group.all) ? std::views::iota(0u, max_group_size) |
-                                                     ranges::to<std::vector<Change::index_type>>
-                                               : changed_group.relative_atom_indices;
-            for (auto i : indices) {
-                if (i < g_new.size()) {
-                    double qr = q.dot(g_new[i].pos);
-                    Q += g_new[i].charge * EwaldData::Tcomplex(std::cos(qr), std::sin(qr));
-                }
-                if (i < g_old.size()) {
-                    double qr = q.dot(g_old[i].pos);
-                    Q -= g_old[i].charge * EwaldData::Tcomplex(std::cos(qr), std::sin(qr));
-                }
+    EwaldExponentials exponentials(d);
+    for (const auto& changed_group : change.groups) {
+        const auto& g_new = groups.at(changed_group.group_index);
+        const auto& g_old = oldgroups.at(changed_group.group_index);
+        const auto max_group_size = std::max(g_new.size(), g_old.size());
+        auto indices = (changed_group.all) ? std::views::iota(0u, max_group_size) |
+                                                 ranges::to<std::vector<Change::index_type>>
+                                           : changed_group.relative_atom_indices;
+        for (auto i : indices) {
+            if (i < g_new.size()) {
+                exponentials.update(g_new[i].pos);
+                exponentials.addTo(d.Q_ion, g_new[i].charge);
+            }
+            if (i < g_old.size()) {
+                exponentials.update(g_old[i].pos);
+                exponentials.addTo(d.Q_ion, -g_old[i].charge);
             }
         }
     }
@@ -302,16 +373,14 @@ TEST_CASE("[Faunus] Ewald - IonIonPolicy")
         CHECK_EQ(ionion.reciprocalEnergy(data), Approx(0.0865107467 * data.bjerrum_length));
     }
 
-    // IPBCEigen is under construction
-    /*SUBCASE("IPBCEigen") {
-        PolicyIonIonIPBCEigen ionion();
-        data.type = EwaldData::IPBCEigen;
-        ionion.updateBox(data, spc.geo.getLength());
+    SUBCASE("IPBCEigen")
+    {
+        PolicyIonIonIPBCEigen ionion;
+        data.policy = EwaldData::IPBCEigen;
+        ionion.updateBox(data, spc.geometry.getLength());
         ionion.updateComplex(data, spc.groups);
-        CHECK_EQ(ionion.selfEnergy(data, c, spc.groups), Approx(-1.0092530088080642 * data.lB));
-        CHECK_EQ(ionion.surfaceEnergy(data, c, spc.groups), Approx(0.0020943951023931952 *
-    data.lB)); CHECK_EQ(ionion.reciprocalEnergy(data), Approx(0.0865107467 * data.lB));
-    }*/
+        CHECK_EQ(ionion.reciprocalEnergy(data), Approx(0.0865107467 * data.bjerrum_length));
+    }
 }
 
 TEST_CASE("[Faunus] Ewald - IonIonPolicy Benchmarks")
@@ -346,6 +415,328 @@ TEST_CASE("[Faunus] Ewald - IonIonPolicy Benchmarks")
     }
 }
 
+//----------------- SPME Ewald -------------------
+
+PolicySPME::PolicySPME()
+{
+    cite = "doi:10.1063/1.470117";
+}
+
+int PolicySPME::fftFriendlySize(int size)
+{
+    for (;; ++size) {
+        auto remainder = size;
+        for (const auto factor : {2, 3, 5}) {
+            while (remainder > 1 && remainder % factor == 0) {
+                remainder /= factor;
+            }
+        }
+        if (remainder <= 1) {
+            return size;
+        }
+    }
+}
+
+/**
+ * @param fraction Fractional part, w, of the scaled particle coordinate
+ * @param order Spline order, n
+ * @param weights Destination for M_n(w + i), i = 0...n-1, which is the weight of the mesh point
+ *                located i points below the scaled particle coordinate
+ */
+void PolicySPME::splineWeights(const double fraction, const int order, double* weights)
+{
+    weights[0] = fraction; // M_2
+    weights[1] = 1.0 - fraction;
+    std::fill(weights + 2, weights + order, 0.0);
+    for (int k = 2; k < order; ++k) { // M_k -> M_(k+1) by recursion
+        for (int i = k; i >= 0; --i) {
+            const auto x = fraction + i;
+            const auto lower = (i > 0) ? (k + 1 - x) * weights[i - 1] : 0.0;
+            weights[i] = (x * weights[i] + lower) / k;
+        }
+    }
+}
+
+PolicySPME::SplineStencil PolicySPME::splineStencil(const EwaldData& d, const Point& position)
+{
+    SplineStencil stencil;
+    for (int dim = 0; dim < 3; ++dim) {
+        const auto scaled_position = d.mesh_size * position[dim] / d.box_length[dim];
+        const auto floored = std::floor(scaled_position);
+        stencil.floor_index[dim] = static_cast<int>(floored);
+        splineWeights(scaled_position - floored, d.spline_order, stencil.weights[dim].data());
+    }
+    return stencil;
+}
+
+void PolicySPME::spreadCharge(EwaldData& d, const SplineStencil& stencil, const double charge)
+{
+    const auto mesh_size = d.mesh_size;
+    const auto& [weights, floor_index] = stencil;
+    auto wrap = [mesh_size](int i) { return ((i % mesh_size) + mesh_size) % mesh_size; };
+    for (int i = 0; i < d.spline_order; ++i) {
+        const auto x_plane = wrap(floor_index[0] - i);
+        d.dirty_mesh_planes[x_plane] = true;
+        const auto x_offset = x_plane * mesh_size;
+        const auto x_weight = charge * weights[0][i];
+        for (int j = 0; j < d.spline_order; ++j) {
+            const auto xy_offset = (x_offset + wrap(floor_index[1] - j)) * mesh_size;
+            const auto xy_weight = x_weight * weights[1][j];
+            for (int k = 0; k < d.spline_order; ++k) {
+                d.charge_mesh[xy_offset + wrap(floor_index[2] - k)] += xy_weight * weights[2][k];
+            }
+        }
+    }
+}
+
+/**
+ * Adds the forward FFT of a single spread charge to `Q_ion`, i.e. what `transformMesh()` would
+ * add for the same particle. The FFT of the stencil at mesh index (mx, my, mz) factorizes into
+ * S_x(mx) S_y(my) S_z(mz) with S(m) = sum_i w_i exp(-2 pi i m (floor - i) / K).
+ */
+void PolicySPME::addTransformedStencil(EwaldData& d, const SplineStencil& stencil,
+                                       const double charge)
+{
+    const auto mesh_size = d.mesh_size;
+    std::array<std::vector<EwaldData::Tcomplex>, 3> sums;
+    for (int dim = 0; dim < 3; ++dim) {
+        sums[dim].assign(mesh_size, EwaldData::Tcomplex(0.0, 0.0));
+        for (int i = 0; i < d.spline_order; ++i) {
+            const auto point = (stencil.floor_index[dim] - i) % mesh_size;
+            const auto phase = -2.0 * pc::pi * point / mesh_size;
+            for (int m = 0; m < mesh_size; ++m) {
+                sums[dim][m] += stencil.weights[dim][i] * std::polar(1.0, phase * m);
+            }
+        }
+    }
+    for (Eigen::Index k = 0; k < d.mesh_indices.size(); ++k) {
+        const auto index = d.mesh_indices[k];
+        const auto structure_factor = sums[0][index / (mesh_size * mesh_size)] *
+                                      sums[1][(index / mesh_size) % mesh_size] *
+                                      sums[2][index % mesh_size];
+        d.Q_ion[k] += charge * d.mesh_moduli[k] * structure_factor;
+    }
+}
+
+/**
+ * The three-dimensional FFT is performed as one-dimensional transforms along each axis,
+ * whereafter the structure factor of each k-vector is picked out and multiplied by its
+ * Euler exponential spline factor.
+ */
+void PolicySPME::transformMesh(EwaldData& d) const
+{
+    const auto mesh_size = static_cast<Eigen::Index>(d.mesh_size);
+    transformed_mesh = d.charge_mesh.cast<std::complex<double>>();
+    fft_input.resize(mesh_size);
+    fft_output.resize(mesh_size);
+    const std::array<Eigen::Index, 3> strides = {mesh_size * mesh_size, mesh_size, 1};
+    for (int dim = 0; dim < 3; ++dim) {
+        const auto stride = strides[dim];
+        for (Eigen::Index line = 0; line < mesh_size * mesh_size; ++line) {
+            // first mesh point of the line; the two other dimensions are spanned by `line`
+            const auto start = (line / stride) * stride * mesh_size + line % stride;
+            for (Eigen::Index i = 0; i < mesh_size; ++i) {
+                fft_input[i] = transformed_mesh[start + i * stride];
+            }
+            fft.fwd(fft_output, fft_input);
+            for (Eigen::Index i = 0; i < mesh_size; ++i) {
+                transformed_mesh[start + i * stride] = fft_output[i];
+            }
+        }
+    }
+    for (Eigen::Index k = 0; k < d.mesh_indices.size(); ++k) {
+        d.Q_ion[k] = d.mesh_moduli[k] * transformed_mesh[d.mesh_indices[k]];
+    }
+}
+
+/**
+ * In addition to the PBC k-vectors, this sets up the mesh and the mesh index and spline factor,
+ * b(n), of each k-vector. As the forward FFT has a negative exponent, k-vector (nx, ny, nz) is
+ * found at mesh index (-nx, -ny, -nz).
+ */
+void PolicySPME::updateBox(EwaldData& d, const Point& box) const
+{
+    PolicyIonIon::updateBox(d, box);
+    const auto mesh_size = d.mesh_size;
+    d.charge_mesh.setZero(mesh_size * mesh_size * mesh_size);
+    d.dirty_mesh_planes.assign(mesh_size, true);
+
+    std::vector<double> spline_values(d.spline_order); // M_n(i + 1)
+    splineWeights(0.0, d.spline_order, spline_values.data());
+    std::rotate(spline_values.begin(), spline_values.begin() + 1, spline_values.end());
+    auto spline_factor = [&](const int n) {
+        EwaldData::Tcomplex denominator(0.0, 0.0);
+        for (int i = 0; i < d.spline_order - 1; ++i) {
+            denominator += spline_values[i] * std::polar(1.0, 2.0 * pc::pi * n * i / mesh_size);
+        }
+        return std::polar(1.0, 2.0 * pc::pi * (d.spline_order - 1) * n / mesh_size) / denominator;
+    };
+
+    d.mesh_indices.resize(d.num_kvectors);
+    d.mesh_moduli.resize(d.num_kvectors);
+    for (int k = 0; k < d.num_kvectors; ++k) {
+        const Point n = d.k_vectors.col(k).cwiseProduct(d.box_length) / (2.0 * pc::pi);
+        int index = 0;
+        EwaldData::Tcomplex moduli(1.0, 0.0);
+        for (int dim = 0; dim < 3; ++dim) {
+            const auto n_dim = static_cast<int>(std::lround(n[dim]));
+            index = index * mesh_size + (mesh_size - n_dim) % mesh_size;
+            moduli *= spline_factor(n_dim);
+        }
+        d.mesh_indices[k] = index;
+        d.mesh_moduli[k] = moduli;
+    }
+}
+
+void PolicySPME::updateComplex(EwaldData& d, const Space::GroupVector& groups) const
+{
+    d.charge_mesh.setZero();
+    std::fill(d.dirty_mesh_planes.begin(), d.dirty_mesh_planes.end(), true);
+    for (const auto& group : groups) {
+        for (const auto& particle : group) {
+            if (particle.charge != 0.0) {
+                spreadCharge(d, splineStencil(d, particle.pos), particle.charge);
+            }
+        }
+    }
+    transformMesh(d);
+}
+
+void PolicySPME::updateComplex(EwaldData& d, const Change& change,
+                               const Space::GroupVector& groups,
+                               const Space::GroupVector& oldgroups) const
+{
+    assert(groups.size() == oldgroups.size());
+    // the mesh is kept in step with `Q_ion` so that states can be synced plane by plane
+    auto updateParticle = [&d](const Particle& particle, const double sign) {
+        if (particle.charge != 0.0) {
+            const auto stencil = splineStencil(d, particle.pos);
+            spreadCharge(d, stencil, sign * particle.charge);
+            addTransformedStencil(d, stencil, sign * particle.charge);
+        }
+    };
+    for (const auto& changed_group : change.groups) {
+        const auto& g_new = groups.at(changed_group.group_index);
+        const auto& g_old = oldgroups.at(changed_group.group_index);
+        const auto max_group_size = std::max(g_new.size(), g_old.size());
+        auto indices = (changed_group.all) ? std::views::iota(0u, max_group_size) |
+                                                 ranges::to<std::vector<Change::index_type>>
+                                           : changed_group.relative_atom_indices;
+        for (auto i : indices) {
+            if (i < g_new.size()) {
+                updateParticle(g_new[i], 1.0);
+            }
+            if (i < g_old.size()) {
+                updateParticle(g_old[i], -1.0);
+            }
+        }
+    }
+}
+
+/**
+ * If `mesh_tolerance` is set, the mesh size is increased until the reciprocal energy of the
+ * given groups deviates less than the tolerance from that of `PolicyIonIon`.
+ */
+void PolicySPME::adjustMeshSize(EwaldData& d, const Point& box, const Space::GroupVector& groups)
+{
+    if (d.mesh_tolerance <= 0.0) {
+        return;
+    }
+    auto reference_data = d;
+    reference_data.policy = EwaldData::PBC;
+    PolicyIonIon reference;
+    reference.updateBox(reference_data, box);
+    reference.updateComplex(reference_data, groups);
+    const auto reference_energy = reference.reciprocalEnergy(reference_data);
+    if (reference_energy == 0.0) {
+        return;
+    }
+    const auto max_mesh_size = 8 * (static_cast<int>(std::ceil(d.n_cutoff)) + 1);
+    while (true) {
+        updateBox(d, box);
+        updateComplex(d, groups);
+        const auto deviation = std::fabs(reciprocalEnergy(d) / reference_energy - 1.0);
+        if (deviation <= d.mesh_tolerance) {
+            faunus_logger->debug("SPME mesh size {} deviates {:.2E} from PBC", d.mesh_size,
+                                 deviation);
+            return;
+        }
+        if (d.mesh_size >= max_mesh_size) {
+            faunus_logger->warn("SPME mesh size {} deviates {:.2E} from PBC; increase "
+                                "`spline_order`",
+                                d.mesh_size, deviation);
+            return;
+        }
+        d.mesh_size = fftFriendlySize(d.mesh_size + 1);
+    }
+}
+
+TEST_CASE("[Faunus] Ewald - SPMEPolicy")
+{
+    using doctest::Approx;
+    CHECK_EQ(PolicySPME::fftFriendlySize(7), 8);
+    CHECK_EQ(PolicySPME::fftFriendlySize(44), 45);
+    CHECK_EQ(PolicySPME::fftFriendlySize(49), 50);
+
+    Random random;
+    Space spc;
+    spc.geometry = R"( {"type": "cuboid", "length": 30} )"_json;
+    spc.particles.resize(100);
+    for (size_t i = 0; i < spc.particles.size(); ++i) {
+        spc.particles[i].charge = (i % 2 == 0) ? 1.0 : -1.0;
+        spc.particles[i].pos = (random() - 0.5) * spc.geometry.getLength();
+    }
+    spc.groups.emplace_back(0, spc.particles.begin(), spc.particles.end());
+
+    EwaldData data(R"({"epsr": 1.0, "alpha": 0.3, "epss": 0.0, "ncutoff": 10.0,
+                       "cutoff": 9.0, "ewaldscheme": "SPME"})"_json);
+    CHECK_EQ(data.mesh_size, 40);
+    CHECK_EQ(data.spline_order, 6);
+    CHECK_THROWS_AS(EwaldData(R"({"epsr": 1.0, "alpha": 0.3, "ncutoff": 10.0, "cutoff": 9.0,
+                                  "ewaldscheme": "SPME", "mesh": 20})"_json),
+                    ConfigurationError);
+
+    auto pbc_data = data;
+    pbc_data.policy = EwaldData::PBC;
+    PolicyIonIon pbc;
+    pbc.updateBox(pbc_data, spc.geometry.getLength());
+    pbc.updateComplex(pbc_data, spc.groups);
+
+    PolicySPME spme;
+    spme.updateBox(data, spc.geometry.getLength());
+    spme.updateComplex(data, spc.groups);
+    CHECK_EQ(data.Q_ion.size(), pbc_data.Q_ion.size());
+    CHECK_EQ(spme.reciprocalEnergy(data), Approx(pbc.reciprocalEnergy(pbc_data)).epsilon(1e-5));
+
+    SUBCASE("Partial update")
+    {
+        auto old_groups = spc.groups;
+        auto old_particles = spc.particles;
+        old_groups.front().relocate(spc.particles.cbegin(), old_particles.begin());
+        spc.particles[3].pos = {1.0, -2.0, 3.0};
+        spc.particles[8].pos = {-14.9, 14.9, 0.0}; // stencil wraps around the mesh
+        Change change;
+        change.groups.push_back({.group_index = 0, .relative_atom_indices = {3, 8}});
+        spme.updateComplex(data, change, spc.groups, old_groups);
+        const auto partial_energy = spme.reciprocalEnergy(data);
+        spme.updateComplex(data, spc.groups);
+        CHECK_EQ(partial_energy, Approx(spme.reciprocalEnergy(data)));
+        pbc.updateComplex(pbc_data, spc.groups);
+        CHECK_EQ(partial_energy, Approx(pbc.reciprocalEnergy(pbc_data)).epsilon(1e-5));
+    }
+
+    SUBCASE("Mesh tolerance")
+    {
+        data.mesh_size = 22;
+        data.spline_order = 4;
+        data.mesh_tolerance = 1e-4;
+        spme.adjustMeshSize(data, spc.geometry.getLength(), spc.groups);
+        CHECK(data.mesh_size > 22);
+        CHECK_EQ(spme.reciprocalEnergy(data),
+                 Approx(pbc.reciprocalEnergy(pbc_data)).epsilon(data.mesh_tolerance));
+    }
+}
+
 //----------------- IPBC Ewald -------------------
 
 /**
@@ -360,6 +751,7 @@ void PolicyIonIonIPBC::updateBox(EwaldData& data, const Point& box) const
     int k_vector_size = (2 * ncc + 1) * (2 * ncc + 1) * (2 * ncc + 1) - 1;
     if (k_vector_size == 0) {
         data.k_vectors.resize(3, 1);
+        data.k_indices.setZero(3, 1);
         data.Aks.resize(1);
         data.k_vectors.col(0) = Point(1, 0, 0); // Just so it is not the zero-vector
         data.Aks[0] = 0;
@@ -370,6 +762,7 @@ void PolicyIonIonIPBC::updateBox(EwaldData& data, const Point& box) const
     else {
         double nc2 = data.n_cutoff * data.n_cutoff;
         data.k_vectors.resize(3, k_vector_size);
+        data.k_indices.resize(3, k_vector_size);
         data.Aks.resize(k_vector_size);
         data.num_kvectors = 0;
         data.k_vectors.setZero();
@@ -396,6 +789,7 @@ void PolicyIonIonIPBC::updateBox(EwaldData& data, const Point& box) const
                             continue;
                     }
                     data.k_vectors.col(data.num_kvectors) = kv;
+                    data.k_indices.col(data.num_kvectors) << nx, ny, nz;
                     data.Aks[data.num_kvectors] =
                         factor * exp(-k2 / (4 * data.alpha * data.alpha)) / k2;
                     data.num_kvectors++;
@@ -406,52 +800,45 @@ void PolicyIonIonIPBC::updateBox(EwaldData& data, const Point& box) const
         data.Q_dipole.resize(data.num_kvectors);
         data.Aks.conservativeResize(data.num_kvectors);
         data.k_vectors.conservativeResize(3, data.num_kvectors);
+        data.k_indices.conservativeResize(3, data.num_kvectors);
     }
 }
 
 void PolicyIonIonIPBC::updateComplex(EwaldData& d, const Space::GroupVector& groups) const
 {
     assert(d.policy == EwaldData::IPBC or d.policy == EwaldData::IPBCEigen);
-    for (int k = 0; k < d.k_vectors.cols(); k++) {
-        const Point& q = d.k_vectors.col(k);
-        EwaldData::Tcomplex Q(0, 0);
-        for (auto& g : groups) {
-            for (auto& particle : g) {
-                Q += q.cwiseProduct(particle.pos).array().cos().prod() *
-                     particle.charge; // see eq. 2 in doi:10/css8
-            }
+    EwaldExponentials exponentials(d);
+    d.Q_ion.setZero();
+    for (const auto& group : groups) {
+        for (const auto& particle : group) {
+            exponentials.update(particle.pos);
+            exponentials.addCosinesTo(d.Q_ion, particle.charge); // see eq. 2 in doi:10/css8
         }
-        d.Q_ion[k] = Q;
     }
 }
 
-void PolicyIonIonIPBCEigen::updateComplex(EwaldData& d, const Space::GroupVector& groups) const
-{
-    assert(d.policy == EwaldData::IPBC or d.policy == EwaldData::IPBCEigen);
-    auto [pos, charge] = mapGroupsToEigen(groups); // throws if inactive particles
-    d.Q_ion.real() = (d.k_vectors.array().cwiseProduct(pos).array().cos().prod() * charge)
-                         .colwise()
-                         .sum(); // see eq. 2 in doi:10/css8
-}
-
 void PolicyIonIonIPBC::updateComplex(EwaldData& d, const Change& change,
                                      const Space::GroupVector& groups,
                                      const Space::GroupVector& oldgroups) const
 {
     assert(d.policy == EwaldData::IPBC or d.policy == EwaldData::IPBCEigen);
     assert(groups.size() == oldgroups.size());
-
-    for (int k = 0; k < d.k_vectors.cols(); k++) {
-        auto& Q = d.Q_ion[k];
-        const Point& q = d.k_vectors.col(k);
-        for (auto& changed_group : change.groups) {
-            auto& g_new = groups.at(changed_group.group_index);
-            auto& g_old = oldgroups.at(changed_group.group_index);
-            for (auto i : changed_group.relative_atom_indices) {
-                if (i < g_new.size())
-                    Q += q.cwiseProduct(g_new[i].pos).array().cos().prod() * g_new[i].charge;
-                if (i < g_old.size())
-                    Q -= q.cwiseProduct(g_old[i].pos).array().cos().prod() * g_old[i].charge;
+    EwaldExponentials exponentials(d);
+    for (const auto& changed_group : change.groups) {
+        const auto& g_new = groups.at(changed_group.group_index);
+        const auto& g_old = oldgroups.at(changed_group.group_index);
+        const auto max_group_size = std::max(g_new.size(), g_old.size());
+        auto indices = (changed_group.all) ? std::views::iota(0u, max_group_size) |
+                                                 ranges::to<std::vector<Change::index_type>>
+                                           : changed_group.relative_atom_indices;
+        for (auto i : indices) {
+            if (i < g_new.size()) {
+                exponentials.update(g_new[i].pos);
+                exponentials.addCosinesTo(d.Q_ion, g_new[i].charge);
+            }
+            if (i < g_old.size()) {
+                exponentials.update(g_old[i].pos);
+                exponentials.addCosinesTo(d.Q_ion, -g_old[i].charge);
             }
         }
     }
@@ -551,6 +938,9 @@ Ewald::Ewald(const json& j, const Space& spc)
 
 void Ewald::init()
 {
+    if (auto* spme = dynamic_cast<PolicySPME*>(policy.get())) {
+        spme->adjustMeshSize(data, spc.geometry.getLength(), spc.groups);
+    }
     policy->updateBox(data, spc.geometry.getLength());
     policy->updateComplex(data, spc.groups); // brute force. todo: be selective
 }
@@ -608,16 +998,17 @@ void Ewald::force(std::vector<Point>& forces)
 
     assert(data.k_vectors.cols() == data.Q_ion.size());
     data.Q_dipole.resize(data.Q_ion.size());
+    EwaldExponentials exponentials(data);
 
     for (auto& particle : spc.particles) { // loop over particles
         (*force) =
             total_dipole_moment * particle.charge / (2.0 * data.surface_dielectric_constant + 1.0);
         double mu_scalar = particle.hasExtension() ? particle.getExt().mulen : 0.0;
         std::complex<double> qmu(mu_scalar, particle.charge);
+        exponentials.update(particle.pos);
         for (size_t i = 0; i < data.k_vectors.cols(); i++) { // loop over k vectors
             std::complex<double> Q = data.Q_ion[i] + data.Q_dipole[i];
-            double k_dot_r = data.k_vectors.col(i).dot(particle.pos);
-            std::complex<double> expKri(std::cos(k_dot_r), std::sin(k_dot_r));
+            const std::complex<double> expKri = exponentials[i];
             std::complex<double> repart = expKri * qmu * std::conj(Q);
             (*force) += std::real(repart) * data.k_vectors.col(i) * data.Aks[i];
         }
@@ -635,9 +1026,13 @@ void Ewald::setOldGroups(const Space::GroupVector& old_groups)
     this->old_groups = &old_groups;
 }
 
+/**
+ * For partial changes, the structure factor is copied and, for SPME, only the mesh planes that
+ * have been modified in either instance since the last sync.
+ */
 void Ewald::sync(EnergyTerm* energybase, const Change& change)
 {
-    if (auto* other = dynamic_cast<const Ewald*>(energybase)) {
+    if (auto* other = dynamic_cast<Ewald*>(energybase)) {
         if (!old_groups && other->state == MonteCarloState::ACCEPTED) {
             setOldGroups(other->spc.groups);
         }
@@ -648,6 +1043,18 @@ void Ewald::sync(EnergyTerm* energybase, const Change& change)
         }
         else {
             data.Q_ion = other->data.Q_ion;
+            const auto& other_planes = other->data.dirty_mesh_planes; // empty unless SPME
+            const auto plane_size = data.charge_mesh.size() / std::max(data.mesh_size, 1);
+            for (std::size_t plane = 0; plane < data.dirty_mesh_planes.size(); ++plane) {
+                if (data.dirty_mesh_planes[plane] || other_planes.at(plane)) {
+                    const auto first = static_cast<Eigen::Index>(plane) * plane_size;
+                    data.charge_mesh.segment(first, plane_size) =
+                        other->data.charge_mesh.segment(first, plane_size);
+                }
+            }
+        }
+        for (auto* planes : {&data.dirty_mesh_planes, &other->data.dirty_mesh_planes}) {
+            std::fill(planes->begin(), planes->end(), false); // the meshes are now identical
         }
     }
     else {
@@ -759,6 +1166,48 @@ TEST_CASE("[Faunus] Energy::Ewald")
     }
 }
 
+TEST_CASE("[Faunus] Ewald::sync with SPME")
+{
+    EwaldData data(R"({
+                "epsr": 1.0, "alpha": 0.894427190999916, "epss": 1.0, "ewaldscheme": "SPME",
+                "ncutoff": 5.0, "spherical_sum": true, "cutoff": 5.0})"_json);
+    auto copy_position = [](auto& pos, auto& particle) { particle.pos = pos; };
+    Space space, trial_space;
+    PointVector positions = {{0, 0, 0}, {1, 0, 0}};
+    for (auto* spc : {&space, &trial_space}) {
+        SpaceFactory::makeNaCl(*spc, 1, R"( {"type": "cuboid", "length": 10} )"_json);
+        spc->updateParticles(positions.begin(), positions.end(), spc->particles.begin(),
+                             copy_position);
+    }
+    auto ewald = Ewald(space, data);
+    auto trial_ewald = Ewald(trial_space, data);
+    trial_ewald.setOldGroups(space.groups);
+    Change change;
+    auto& group_change = change.groups.emplace_back();
+    group_change.group_index = 0;
+    group_change.relative_atom_indices.push_back(0);
+
+    trial_ewald.sync(&ewald, change); // initially, all mesh planes are marked as modified
+
+    auto move_first_particle = [&](const Point& position) {
+        trial_space.particles.at(0).pos = position;
+        trial_ewald.updateState(change);
+    };
+    move_first_particle({3.1, -2.1, 4.1});
+    trial_space.sync(space, change); // reject; only modified mesh planes are restored
+    trial_ewald.sync(&ewald, change);
+    move_first_particle({0.1, 0.1, 0.1});
+    ewald.sync(&trial_ewald, change); // accept
+    space.sync(trial_space, change);
+    move_first_particle({-1.1, 0.5, 0.1});
+
+    auto reference_ewald = Ewald(trial_space, data); // full update
+    CHECK_EQ(trial_ewald.energy(change), doctest::Approx(reference_ewald.energy(change)));
+    ewald.sync(&trial_ewald, change);
+    space.sync(trial_space, change);
+    CHECK_EQ(ewald.energy(change), doctest::Approx(reference_ewald.energy(change)));
+}
+
 double Example2D::energy(const Change&)
 {
     double s = 1 + std::sin(2.0 * pc::pi * particle.x()) +
@@ -979,6 +1428,16 @@ void Bonded::updateGroupBonds(const Space::GroupType& group)
         bond->shiftIndices(first_particle_index); // shift to absolute particle index
         bond->setEnergyFunction(spc.particles);
     }
+    if (auto [it, inserted] = internal_bond_index.try_emplace(group.id); inserted) {
+        auto& bond_index = it->second; // relative particle index -> bonds in topology
+        bond_index.resize(group.capacity());
+        for (std::size_t bond_number = 0; const auto& bond : group.traits().bonds) {
+            for (const auto particle_index : bond->indices) {
+                bond_index.at(particle_index).push_back(bond_number);
+            }
+            ++bond_number;
+        }
+    }
 }
 
 /**
@@ -987,6 +1446,7 @@ void Bonded::updateGroupBonds(const Space::GroupType& group)
 void Bonded::updateInternalBonds()
 {
     internal_bonds.clear();
+    internal_bond_index.clear();
     std::for_each(spc.groups.begin(), spc.groups.end(),
                   [&](auto& group) { updateGroupBonds(group); });
 }
@@ -1007,19 +1467,97 @@ double Bonded::sumBondEnergy(const Bonded::BondVector& bonds) const
 #endif
 }
 
+/**
+ * @param bonds List of bonds
+ * @param bond_indices Indices of the bonds to evaluate
+ */
+double Bonded::sumEnergy(const Bonded::BondVector& bonds,
+                         const std::vector<std::size_t>& bond_indices) const
+{
+    const auto distance = spc.geometry.getDistanceFunc();
+    auto bond_energy = [&](auto bond_index) { return bonds.vec[bond_index]->energyFunc(distance); };
+    return std::transform_reduce(bond_indices.begin(), bond_indices.end(), 0.0, std::plus<>(),
+                                 bond_energy);
+}
+
+/**
+ * @return Sorted indices of internal bonds involving at least one of the changed particles
+ */
+std::vector<std::size_t> Bonded::affectedInternalBonds(const Change::GroupChange& changed) const
+{
+    const auto& bond_index = internal_bond_index.at(spc.groups.at(changed.group_index).id);
+    std::vector<std::size_t> bond_indices;
+    for (const auto particle_index : changed.relative_atom_indices) {
+        const auto& bonds_of_particle = bond_index.at(particle_index);
+        bond_indices.insert(bond_indices.end(), bonds_of_particle.begin(),
+                            bonds_of_particle.end());
+    }
+    if (changed.relative_atom_indices.size() > 1) { // bonds between changed particles
+        std::ranges::sort(bond_indices);
+        const auto duplicates = std::ranges::unique(bond_indices);
+        bond_indices.erase(duplicates.begin(), duplicates.end());
+    }
+    return bond_indices;
+}
+
+/**
+ * External bonds involving particles of the changed groups. All external bonds are
+ * evaluated for full and volume changes, as well as when this is cheaper than a lookup.
+ */
+double Bonded::externalBondEnergy(const Change& change) const
+{
+    if (external_bonds.empty()) {
+        return 0.0;
+    }
+    if (change.everything || change.volume_change || change.matter_change) {
+        return sumBondEnergy(external_bonds);
+    }
+    std::vector<std::size_t> bond_indices;
+    auto add_bonds_of_particle = [&](const std::size_t particle_index) {
+        if (auto it = external_bond_index.find(particle_index); it != external_bond_index.end()) {
+            bond_indices.insert(bond_indices.end(), it->second.begin(), it->second.end());
+        }
+    };
+    for (const auto& changed : change.groups) {
+        const auto& group = spc.groups.at(changed.group_index);
+        const auto first_particle_index = spc.getFirstParticleIndex(group);
+        if (changed.all || !changed.internal) {
+            if (group.size() > external_bonds.size()) {
+                return sumBondEnergy(external_bonds);
+            }
+            for (std::size_t i = 0; i < group.size(); ++i) {
+                add_bonds_of_particle(first_particle_index + i);
+            }
+        }
+        else {
+            for (const auto i : changed.relative_atom_indices) {
+                add_bonds_of_particle(first_particle_index + i);
+            }
+        }
+    }
+    std::ranges::sort(bond_indices);
+    const auto duplicates = std::ranges::unique(bond_indices);
+    bond_indices.erase(duplicates.begin(), duplicates.end());
+    return sumEnergy(external_bonds, bond_indices);
+}
+
 Bonded::Bonded(const Space& spc, BondVector external_bonds = BondVector())
     : spc(spc)
     , external_bonds(std::move(external_bonds))
 {
     name = "bonded";
     updateInternalBonds();
-    for (auto& bond : this->external_bonds) {
+    for (std::size_t bond_number = 0; auto& bond : this->external_bonds) {
         std::stringstream indices;
         std::copy(bond->indices.begin(), bond->indices.end(),
                   std::ostream_iterator<int>(indices, " "));
         faunus_logger->info("{}: adding inter-particle bonds involving indices [ {}]", name,
                             indices.str());
         bond->setEnergyFunction(spc.particles);
+        for (const auto particle_index : bond->indices) {
+            external_bond_index[particle_index].push_back(bond_number);
+        }
+        ++bond_number;
     }
 }
 
@@ -1046,7 +1584,7 @@ double Bonded::energy(const Change& change)
 {
     double energy = 0.0;
     if (change) {
-        energy += sumBondEnergy(external_bonds);
+        energy += externalBondEnergy(change);
         if (change.everything || change.volume_change) { // calc. for everything!
             for (const auto& [group_index, bonds] : internal_bonds) {
                 if (!spc.groups.at(group_index).empty()) {
@@ -1063,6 +1601,41 @@ double Bonded::energy(const Change& change)
     return energy;
 }
 
+/**
+ * For partial group updates, the affected bonds are identified only once and the very same bonds
+ * are then evaluated in both the trial (this) and the old configuration. Full updates, volume
+ * and matter changes fall back to two separate energy evaluations.
+ */
+EnergyPair Bonded::energyChange(EnergyTerm& old_energy, const Change& change)
+{
+    auto* old_bonded = dynamic_cast<Bonded*>(&old_energy);
+    if (old_bonded == nullptr || !change || change.everything || change.volume_change ||
+        change.matter_change) {
+        return EnergyTerm::energyChange(old_energy, change);
+    }
+    EnergyPair energies{externalBondEnergy(change), old_bonded->externalBondEnergy(change)};
+    const auto distance = spc.geometry.getDistanceFunc();
+    const auto old_distance = old_bonded->spc.geometry.getDistanceFunc();
+    for (const auto& changed : change.groups) {
+        const auto& group = spc.groups.at(changed.group_index);
+        if (!changed.internal || group.empty()) {
+            continue;
+        }
+        const auto& bonds = internal_bonds.at(changed.group_index);
+        const auto& old_bonds = old_bonded->internal_bonds.at(changed.group_index);
+        if (changed.all) {
+            energies.trial += sumBondEnergy(bonds);
+            energies.old += old_bonded->sumBondEnergy(old_bonds);
+            continue;
+        }
+        for (const auto i : affectedInternalBonds(changed)) {
+            energies.trial += bonds.vec[i]->energyFunc(distance);
+            energies.old += old_bonds.vec[i]->energyFunc(old_distance);
+        }
+    }
+    return energies;
+}
+
 double Bonded::internalGroupEnergy(const Change::GroupChange& changed)
 {
     double energy = 0.0;
@@ -1073,12 +1646,7 @@ double Bonded::internalGroupEnergy(const Change::GroupChange& changed)
             energy += sumBondEnergy(bonds);
         }
         else { // only partial update of affected atoms
-            const auto first_particle_index = spc.getFirstParticleIndex(group);
-            auto particle_indices = changed.relative_atom_indices |
-                                    std::views::transform([first_particle_index](auto i) {
-                                        return i + first_particle_index;
-                                    });
-            energy += sumEnergy(bonds, particle_indices);
+            energy += sumEnergy(bonds, affectedInternalBonds(changed));
         }
     }
     return energy;
@@ -1121,6 +1689,64 @@ void Bonded::force(std::vector<Point>& forces)
     }
 }
 
+TEST_CASE("[Faunus] Bonded")
+{
+    using doctest::Approx;
+    pc::temperature = 300.0_K;
+    atoms = R"([{ "A": { "sigma": 2.0 } }])"_json.get<decltype(atoms)>();
+    molecules = R"([
+        { "chain": { "structure": [
+                { "A": [0.0, 0.0, 0.0] }, { "A": [2.0, 0.0, 0.0] }, { "A": [4.0, 0.0, 0.0] },
+                { "A": [6.0, 0.0, 0.0] }, { "A": [8.0, 0.0, 0.0] }],
+            "bondlist": [
+                { "harmonic": { "index": [0, 1], "k": 1.0, "req": 2.5 } },
+                { "harmonic": { "index": [1, 2], "k": 1.0, "req": 2.5 } },
+                { "harmonic": { "index": [2, 3], "k": 1.0, "req": 2.5 } },
+                { "harmonic": { "index": [3, 4], "k": 1.0, "req": 2.5 } },
+                { "harmonic_torsion": { "index": [1, 2, 3], "k": 1.0, "aeq": 120 } }] }}
+    ])"_json.get<decltype(molecules)>();
+
+    Space spc, old_spc;
+    json j_insert = json::array();
+    j_insert.push_back({{"chain", {{"N", 2}}}});
+    for (Space* space : {&spc, &old_spc}) {
+        space->geometry = R"( {"type": "cuboid", "length": 40} )"_json;
+        InsertMoleculesInSpace::insertMolecules(j_insert, *space);
+    }
+    std::copy(spc.particles.begin(), spc.particles.end(), old_spc.particles.begin());
+    const auto j = R"({"bondlist": [{"harmonic": {"index": [0, 9], "k": 1.0, "req": 5.0}}]})"_json;
+    Bonded bonded(j, spc);
+    Bonded old_bonded(j, old_spc);
+
+    // move the middle particle of the first chain and the end particle of the second chain
+    spc.particles.at(2).pos += Point(0.5, 1.0, -0.5);
+    spc.particles.at(9).pos += Point(-1.0, 0.5, 0.0);
+    Change change;
+    for (const auto [group_index, relative_index] : {std::pair{0, 2}, std::pair{1, 4}}) {
+        auto& group_change = change.groups.emplace_back();
+        group_change.group_index = group_index;
+        group_change.internal = true;
+        group_change.relative_atom_indices = {relative_index};
+    }
+    Change everything;
+    everything.everything = true;
+    const auto energy_change = bonded.energy(everything) - old_bonded.energy(everything);
+    CHECK(energy_change != Approx(0.0));
+    CHECK_EQ(bonded.energy(change) - old_bonded.energy(change), Approx(energy_change));
+    const auto [trial_energy, old_energy] = bonded.energyChange(old_bonded, change);
+    CHECK_EQ(trial_energy - old_energy, Approx(energy_change));
+
+    // rigid body move of the second chain affects only the external bond
+    change.groups.resize(1);
+    auto& group_change = change.groups.emplace_back();
+    group_change.group_index = 1;
+    for (auto i = 5; i < 10; ++i) {
+        spc.particles.at(i).pos = old_spc.particles.at(i).pos + Point(0.0, 0.0, 1.0);
+    }
+    const auto rigid_energy_change = bonded.energy(everything) - old_bonded.energy(everything);
+    CHECK_EQ(bonded.energy(change) - old_bonded.energy(change), Approx(rigid_energy_change));
+}
+
 //---------- Hamiltonian ------------
 
 void Hamiltonian::to_json(json& j) const
@@ -1166,8 +1792,15 @@ void Hamiltonian::force(PointVector& forces)
 /**
  * @todo Move addEwald to Nonbonded as it now has access to Hamiltonian and can add
  */
-Hamiltonian::Hamiltonian(Space& spc, const json& j)
-    : energy_terms(this->vec)
+/**
+ * @param spc Space to operate on
+ * @param j Array of energy terms
+ * @param thread_pool Existing thread pool to be used by energy terms requesting one, typically
+ *                    that of the Hamiltonian of the other Monte Carlo state; created if empty
+ */
+Hamiltonian::Hamiltonian(Space& spc, const json& j, std::shared_ptr<ThreadPool> thread_pool)
+    : thread_pool(std::move(thread_pool))
+    , energy_terms(this->vec)
 {
     name = "hamiltonian";
     if (!j.is_array()) {
@@ -1238,6 +1871,45 @@ double Hamiltonian::energy(const Change& change)
     return std::accumulate(latest_energies.begin(), latest_energies.end(), 0.0);
 }
 
+/**
+ * Each energy term is given the chance to evaluate both configurations at once, see
+ * `EnergyTerm::energyChange()`. As for `energy()`, summation of trial energies stops as soon as
+ * a term exceeds the maximum allowed energy; the old energy is always complete.
+ *
+ * @param old_hamiltonian Hamiltonian with identical energy terms operating on the old configuration
+ * @param change Description of the change
+ * @return Energies of the trial (this) and the old configuration
+ */
+EnergyPair Hamiltonian::energyChange(EnergyTerm& old_hamiltonian, const Change& change)
+{
+    auto* old = dynamic_cast<Hamiltonian*>(&old_hamiltonian);
+    if (old == nullptr || old->size() != size()) {
+        throw std::runtime_error("hamiltonian mismatch");
+    }
+    latest_energies.clear();
+    old->latest_energies.clear();
+    auto old_energy_term = old->energy_terms.begin();
+    for (auto& energy_ptr : energy_terms) {
+        energy_ptr->state = state;
+        (*old_energy_term)->state = old->state;
+        energy_ptr->timer.start();
+        const auto [trial_energy, old_energy] = energy_ptr->energyChange(**old_energy_term, change);
+        energy_ptr->timer.stop();
+        latest_energies.push_back(trial_energy);
+        old->latest_energies.push_back(old_energy);
+        std::advance(old_energy_term, 1);
+        if (trial_energy >= maximum_allowed_energy || std::isnan(trial_energy)) {
+            break; // stop summing trial energies
+        }
+    }
+    std::for_each(old_energy_term, old->energy_terms.end(), [&](auto& energy_ptr) {
+        energy_ptr->state = old->state;
+        old->latest_energies.push_back(energy_ptr->energy(change));
+    });
+    return {std::accumulate(latest_energies.begin(), latest_energies.end(), 0.0),
+            std::accumulate(old->latest_energies.begin(), old->latest_energies.end(), 0.0)};
+}
+
 void Hamiltonian::init()
 {
     std::for_each(energy_terms.begin(), energy_terms.end(), [&](auto& energy) { energy->init(); });
@@ -1265,6 +1937,85 @@ void Hamiltonian::sync(EnergyTerm* other_hamiltonian, const Change& change)
     throw std::runtime_error("hamiltonian mismatch");
 }
 
+/**
+ * @brief Creates a nonbonded energy term and hands over the Hamiltonian's thread pool if the
+ * `threads` summation policy is selected
+ */
+template <template <RequirePairEnergy, typename> class TNonbonded, RequirePairEnergy TPairEnergy,
+          typename TPairingPolicy>
+static std::unique_ptr<EnergyTerm> makeNonbondedWithPolicy(const json& j, Space& spc,
+                                                           Hamiltonian& hamiltonian)
+{
+    auto nonbonded = std::make_unique<TNonbonded<TPairEnergy, TPairingPolicy>>(j, spc, hamiltonian);
+    if (j.value("summation_policy", EnergyAccumulatorBase::Scheme::SERIAL) ==
+        EnergyAccumulatorBase::Scheme::THREADS) {
+        nonbonded->setThreadPool(hamiltonian.getThreadPool(j.value("threads", 0U)));
+    }
+    return nonbonded;
+}
+
+/**
+ * @brief Creates a nonbonded energy term with the pairing policy selected in the input
+ *
+ * The group based pairing policy is used by default; the cell list or Verlet list based policies
+ * are used if the `celllist` or `verlet` keywords are present, respectively.
+ *
+ * @tparam TNonbonded  Nonbonded or a NonbondedCached alias
+ * @tparam TPairEnergy  pair energy functor
+ */
+template <template <RequirePairEnergy, typename> class TNonbonded, RequirePairEnergy TPairEnergy>
+static std::unique_ptr<EnergyTerm> makeNonbonded(const json& j, Space& spc,
+                                                 Hamiltonian& hamiltonian)
+{
+    if (j.contains("celllist") && j.contains("verlet")) {
+        throw ConfigurationError("use either 'celllist' or 'verlet'");
+    }
+    if (j.value("soa", false)) {
+        if (j.contains("celllist") || j.contains("verlet")) {
+            throw ConfigurationError("'soa' cannot be combined with 'celllist' or 'verlet'");
+        }
+        if constexpr (!RequireParticleArrayAccumulator<InstantEnergyAccumulator<TPairEnergy>>) {
+            faunus_logger->warn("'soa' is unsupported by the pair potential and is ignored");
+        }
+    }
+    if (j.contains("celllist")) {
+        using PairingPolicy = GroupPairing<CellListPairingPolicy<GroupCutoff>>;
+        faunus_logger->debug("using cell list pairing policy");
+        return makeNonbondedWithPolicy<TNonbonded, TPairEnergy, PairingPolicy>(j, spc, hamiltonian);
+    }
+    if (j.contains("verlet")) {
+        using PairingPolicy = GroupPairing<VerletListPairingPolicy<GroupCutoff>>;
+        faunus_logger->debug("using Verlet list pairing policy");
+        return makeNonbondedWithPolicy<TNonbonded, TPairEnergy, PairingPolicy>(j, spc, hamiltonian);
+    }
+    using PairingPolicy = GroupPairing<GroupPairingPolicy<GroupCutoff>>;
+    return makeNonbondedWithPolicy<TNonbonded, TPairEnergy, PairingPolicy>(j, spc, hamiltonian);
+}
+
+template <RequirePairEnergy TPairEnergy, typename TPairingPolicy>
+using NonbondedCachedDouble = NonbondedCached<TPairEnergy, TPairingPolicy, double>;
+
+template <RequirePairEnergy TPairEnergy, typename TPairingPolicy>
+using NonbondedCachedFloat = NonbondedCached<TPairEnergy, TPairingPolicy, float>;
+
+/**
+ * @brief Creates a cached nonbonded energy term storing energies with the `cache_precision`
+ * given in the input
+ */
+template <RequirePairEnergy TPairEnergy>
+static std::unique_ptr<EnergyTerm> makeNonbondedCached(const json& j, Space& spc,
+                                                       Hamiltonian& hamiltonian)
+{
+    const auto precision = j.value("cache_precision", "double"s);
+    if (precision == "double") {
+        return makeNonbonded<NonbondedCachedDouble, TPairEnergy>(j, spc, hamiltonian);
+    }
+    if (precision == "float") {
+        return makeNonbonded<NonbondedCachedFloat, TPairEnergy>(j, spc, hamiltonian);
+    }
+    throw ConfigurationError("cache_precision must be 'double' or 'float'");
+}
+
 /**
  * @brief Factory function to generate energy instances based on their name and json input
  * @param spc Space to use
@@ -1284,44 +2035,30 @@ std::unique_ptr<EnergyTerm> Hamiltonian::createEnergy(Space& spc, const std::str
     using PrimitiveModelWCA = CombinedPairPotential<Coulomb, WeeksChandlerAndersen>;
     using PrimitiveModel = CombinedPairPotential<Coulomb, HardSphere>;
 
-    // only a single pairing policy and cutoff scheme so far
-    using PairingPolicy = GroupPairing<GroupPairingPolicy<GroupCutoff>>;
-
     try {
         if (name == "nonbonded_coulomblj" || name == "nonbonded_newcoulomblj") {
-            return std::make_unique<Nonbonded<PairEnergy<CoulombLJ, false>, PairingPolicy>>(j, spc,
-                                                                                            *this);
+            return makeNonbonded<Nonbonded, PairEnergy<CoulombLJ, false>>(j, spc, *this);
         }
         if (name == "nonbonded_coulomblj_EM") {
-            return std::make_unique<NonbondedCached<PairEnergy<CoulombLJ, false>, PairingPolicy>>(
-                j, spc, *this);
+            return makeNonbondedCached<PairEnergy<CoulombLJ, false>>(j, spc, *this);
         }
         if (name == "nonbonded_splined") {
-            return std::make_unique<
-                Nonbonded<PairEnergy<pairpotential::SplinedPotential, false>, PairingPolicy>>(
-                j, spc, *this);
+            return makeNonbonded<Nonbonded, PairEnergy<SplinedPotential, false>>(j, spc, *this);
         }
         if (name == "nonbonded" || name == "nonbonded_exact") {
-            return std::make_unique<
-                Nonbonded<PairEnergy<pairpotential::FunctorPotential, true>, PairingPolicy>>(j, spc,
-                                                                                             *this);
+            return makeNonbonded<Nonbonded, PairEnergy<VariantPotential, true>>(j, spc, *this);
         }
         if (name == "nonbonded_cached") {
-            return std::make_unique<
-                NonbondedCached<PairEnergy<pairpotential::SplinedPotential>, PairingPolicy>>(j, spc,
-                                                                                             *this);
+            return makeNonbondedCached<PairEnergy<SplinedPotential>>(j, spc, *this);
         }
         if (name == "nonbonded_coulombwca") {
-            return std::make_unique<Nonbonded<PairEnergy<CoulombWCA, false>, PairingPolicy>>(j, spc,
-                                                                                             *this);
+            return makeNonbonded<Nonbonded, PairEnergy<CoulombWCA, false>>(j, spc, *this);
         }
         if (name == "nonbonded_pm" || name == "nonbonded_coulombhs") {
-            return std::make_unique<Nonbonded<PairEnergy<PrimitiveModel, false>, PairingPolicy>>(
-                j, spc, *this);
+            return makeNonbonded<Nonbonded, PairEnergy<PrimitiveModel, false>>(j, spc, *this);
         }
         if (name == "nonbonded_pmwca") {
-            return std::make_unique<Nonbonded<PairEnergy<PrimitiveModelWCA, false>, PairingPolicy>>(
-                j, spc, *this);
+            return makeNonbonded<Nonbonded, PairEnergy<PrimitiveModelWCA, false>>(j, spc, *this);
         }
         if (name == "bonded") {
             return std::make_unique<Bonded>(j, spc);
@@ -1361,11 +2098,21 @@ std::unique_ptr<EnergyTerm> Hamiltonian::createEnergy(Space& spc, const std::str
             throw ConfigurationError("faunus not compiled with sasa support");
 #endif
         }
-        if (name == "sasa_reference") {
-            return std::make_unique<SASAEnergyReference>(j, spc);
+        if (name == "sasa_voronoi") {
+            return std::make_unique<SASAVoronoi>(j, spc);
         }
-        if (name == "sasa") {
-            return std::make_unique<SASAEnergy>(j, spc);
+        if (name == "sasa_reference" || name == "sasa") {
+            std::unique_ptr<SASAEnergyReference> sasa;
+            if (name == "sasa") {
+                sasa = std::make_unique<SASAEnergy>(j, spc);
+            }
+            else {
+                sasa = std::make_unique<SASAEnergyReference>(j, spc);
+            }
+            if (j.contains("threads")) {
+                sasa->setThreadPool(getThreadPool(j.at("threads").get<unsigned int>()));
+            }
+            return sasa;
         }
         throw ConfigurationError("'{}' unknown", name);
     }
@@ -1376,6 +2123,24 @@ std::unique_ptr<EnergyTerm> Hamiltonian::createEnergy(Space& spc, const std::str
     }
 }
 
+/**
+ * The pool is shared by all energy terms requesting one and lives as long as the Hamiltonian
+ * or any of its terms. Only the first call determines the number of threads, unless a pool was
+ * passed to the constructor.
+ *
+ * @param number_of_threads Number of threads; zero selects the number of hardware threads
+ */
+std::shared_ptr<ThreadPool> Hamiltonian::getThreadPool(const unsigned int number_of_threads)
+{
+    if (!thread_pool) {
+        thread_pool = std::make_shared<ThreadPool>(number_of_threads);
+        faunus_logger->debug("{}: created thread pool with {} threads", name, thread_pool->size());
+    }
+    return thread_pool;
+}
+
+const std::shared_ptr<ThreadPool>& Hamiltonian::threadPool() const { return thread_pool; }
+
 const std::vector<double>& Hamiltonian::latestEnergies() const
 {
     return latest_energies;
@@ -1578,6 +2343,12 @@ SASAEnergyReference::SASAEnergyReference(const json& j, const Space& spc)
                           j.value("radius", 1.4) * 1.0_angstrom, j.value("slices", 25),
                           j.value("dense", true))
 {
+    sasa->setMethod(j.value("method", SASA::SASABase::Method::SLICES), j.value("points", 400));
+}
+
+void SASAEnergyReference::setThreadPool(std::shared_ptr<ThreadPool> pool)
+{
+    sasa->setThreadPool(std::move(pool));
 }
 
 void SASAEnergyReference::init()
@@ -1611,6 +2382,7 @@ SASAEnergy::SASAEnergy(const json& j, const Space& spc)
                  j.value("radius", 1.4) * 1.0_angstrom, j.value("slices", 25),
                  j.value("dense", true))
 {
+    sasa->setMethod(j.value("method", SASA::SASABase::Method::SLICES), j.value("points", 400));
 }
 
 void SASAEnergy::init()
@@ -1635,8 +2407,7 @@ double SASAEnergyReference::energy(const Change& change)
     auto to_index = [this](const auto& particle) { return indexOf(particle); };
     target_indices = particles | std::views::transform(to_index) | ranges::to<std::vector>;
 
-    const auto neighbours = sasa->calcNeighbourData(spc, target_indices);
-    sasa->updateSASA(neighbours, target_indices);
+    sasa->updateSASA(spc, target_indices);
 
     const auto& new_areas = sasa->getAreas();
     std::ranges::for_each(target_indices, [this, &new_areas](const auto index) {
@@ -1677,6 +2448,8 @@ const std::vector<double>& SASAEnergyReference::getAreas() const
 /**
  * @brief Finds absolute indices of particles whose SASA has changed
  * @param change Change object
+ *
+ * The result is sorted and unique; buffers are reused to avoid allocations.
  */
 void SASAEnergy::updateChangedIndices(const Change& change)
 {
@@ -1686,14 +2459,12 @@ void SASAEnergy::updateChangedIndices(const Change& change)
         return;
     }
 
-    //!< using set to get rid of repeating target_indices in touched_atoms neighbours lists
-    std::set<index_type> target_indices;
     for (const auto& group_change : change.groups) {
         const auto& group = spc.groups.at(group_change.group_index);
         const auto offset = spc.getFirstParticleIndex(group);
-        auto insert_changed = [this, &target_indices](const auto index) {
-            target_indices.insert(index);
-            insertChangedNeighboursOf(index, target_indices);
+        auto insert_changed = [this](const auto index) {
+            changed_indices.push_back(index);
+            insertChangedNeighboursOf(index, changed_indices);
         };
 
         if (group_change.relative_atom_indices.empty()) {
@@ -1706,7 +2477,9 @@ void SASAEnergy::updateChangedIndices(const Change& change)
             std::ranges::for_each(indices, insert_changed);
         }
     }
-    changed_indices.assign(target_indices.begin(), target_indices.end());
+    std::sort(changed_indices.begin(), changed_indices.end());
+    changed_indices.erase(std::unique(changed_indices.begin(), changed_indices.end()),
+                          changed_indices.end());
 }
 
 /**
@@ -1718,12 +2491,14 @@ void SASAEnergy::updateChangedIndices(const Change& change)
 *      * @param target_indices placeholder to insert changed indices
 **/
 void SASAEnergy::insertChangedNeighboursOf(const index_type index,
-                                           std::set<index_type>& target_indices) const
+                                           std::vector<index_type>& target_indices)
 {
-    const auto& current_neighbour = sasa->calcNeighbourDataOfParticle(spc, index).indices;
+    sasa->calcNeighbourDataOfParticle(spc, index, neighbour_buffer);
+    const auto& current_neighbour = neighbour_buffer.indices;
     const auto& past_neighbour = current_neighbours.at(index);
-    target_indices.insert(past_neighbour.begin(), past_neighbour.end());
-    target_indices.insert(current_neighbour.begin(), current_neighbour.end());
+    target_indices.insert(target_indices.end(), past_neighbour.begin(), past_neighbour.end());
+    target_indices.insert(target_indices.end(), current_neighbour.begin(),
+                          current_neighbour.end());
 }
 
 double SASAEnergy::energy(const Change& change)
@@ -1737,23 +2512,20 @@ double SASAEnergy::energy(const Change& change)
     const auto particles = spc.activeParticles();
     changed_indices.clear();
     if (change.everything) { //! all the active particles will be used for SASA calculation
-        auto to_index = [this](const auto& particle) { return indexOf(particle); };
-        changed_indices = particles | std::views::transform(to_index) | ranges::to<std::vector>;
+        std::ranges::for_each(particles, [this](const auto& particle) {
+            changed_indices.push_back(indexOf(particle));
+        });
     }
     else {
         updateChangedIndices(change);
         sasa->needs_syncing = true;
     }
 
-    const auto neighbours_data = sasa->calcNeighbourData(spc, changed_indices);
-
-    // update sasa areas in sasa object and update
-    sasa->updateSASA(neighbours_data, changed_indices);
+    // update sasa areas and neighbour lists of changed particles
+    sasa->updateSASA(spc, changed_indices, &current_neighbours);
     const auto& new_areas = sasa->getAreas();
-
-    for (const auto& [neighbour, index] : ranges::views::zip(neighbours_data, changed_indices)) {
-        current_neighbours.at(index) = neighbour.indices;
-        areas.at(index) = new_areas.at(index);
+    for (const auto index : changed_indices) {
+        areas[index] = new_areas[index];
     }
 
     auto accumulate_energy = [this, &energy](const auto& particle) {
@@ -1861,6 +2633,671 @@ TEST_CASE_TEMPLATE("[Faunus] SASAEnergy_updates", EnergyTemplate, SASAEnergyRefe
     }
 }
 
+//==================== ParticleCellList ====================
+
+namespace {
+/**
+ * @brief Implements ParticleCellList using one of the cell list types from the SASA module
+ * @tparam TCellList  spatial cell list with size_t members
+ */
+template <typename TCellList> class ParticleCellListImpl : public ParticleCellList
+{
+    using CellCoord = typename TCellList::Grid::CellCoord;
+    TCellList cell_list;
+    Point half_box;                      //!< shift from the simulation cell to the grid frame
+    std::vector<CellCoord> cell_offsets; //!< 3x3x3 cube around the central cell
+
+  public:
+    ParticleCellListImpl(const Point& box, const double cell_length)
+        : cell_list(box, cell_length)
+        , half_box(0.5 * box)
+    {
+        for (auto i = -1; i <= 1; ++i) {
+            for (auto j = -1; j <= 1; ++j) {
+                for (auto k = -1; k <= 1; ++k) {
+                    cell_offsets.emplace_back(i, j, k);
+                }
+            }
+        }
+    }
+
+    void insertOrUpdate(const index_type index, const Point& position) override
+    {
+        const Point grid_position = position + half_box;
+        if (!cell_list.getGrid().isCellAt(grid_position)) {
+            remove(index); // outside of a non-periodic grid
+        }
+        else if (cell_list.containsMember(index)) {
+            cell_list.updateMemberAt(index, grid_position);
+        }
+        else {
+            cell_list.insertMember(index, grid_position);
+        }
+    }
+
+    void remove(const index_type index) override
+    {
+        if (cell_list.containsMember(index)) {
+            cell_list.removeMember(index);
+        }
+    }
+
+    void neighbourCells(const Point& position, std::vector<const Members*>& cells) override
+    {
+        const Point grid_position = position + half_box;
+        if (cell_list.getGrid().isCellAt(grid_position)) {
+            const auto center_cell = cell_list.getGrid().coordinatesAt(grid_position);
+            for (const auto& offset : cell_offsets) {
+                cells.push_back(&cell_list.getNeighborMembers(center_cell, offset));
+            }
+        }
+    }
+};
+} // namespace
+
+std::unique_ptr<ParticleCellList>
+ParticleCellList::create(const Space::GeometryType& geometry, const double cell_length,
+                         const bool dense)
+{
+    const Point box = geometry.getLength();
+    switch (geometry.asSimpleGeometry()->boundary_conditions.isPeriodic().count()) {
+    case 3:
+        if (dense) {
+            return std::make_unique<ParticleCellListImpl<SASA::DensePeriodicCellList>>(
+                box, cell_length);
+        }
+        return std::make_unique<ParticleCellListImpl<SASA::SparsePeriodicCellList>>(box,
+                                                                                    cell_length);
+    case 0:
+        if (dense) {
+            return std::make_unique<ParticleCellListImpl<SASA::DenseFixedCellList>>(box,
+                                                                                   cell_length);
+        }
+        return std::make_unique<ParticleCellListImpl<SASA::SparseFixedCellList>>(box,
+                                                                                cell_length);
+    default:
+        throw ConfigurationError("cell list requires a fully periodic or non-periodic geometry");
+    }
+}
+
+CellListNeighbours::CellListNeighbours(const Space& spc)
+    : spc(spc)
+{
+}
+
+void CellListNeighbours::from_json(const json& j)
+{
+    const auto& j_celllist = j.at("celllist");
+    const auto cutoff = j_celllist.at("cutoff").get<double>();
+    if (cutoff <= 0.0) {
+        throw ConfigurationError("celllist cutoff must be positive");
+    }
+    cutoff_squared = cutoff * cutoff;
+    dense = j_celllist.value("dense", true);
+}
+
+void CellListNeighbours::to_json(json& j) const
+{
+    j["celllist"] = {{"cutoff", std::sqrt(cutoff_squared)}, {"dense", dense}};
+}
+
+void CellListNeighbours::reset()
+{
+    cell_list = ParticleCellList::create(spc.geometry, std::sqrt(cutoff_squared), dense);
+}
+
+void CellListNeighbours::insertOrUpdate(const index_type i)
+{
+    cell_list->insertOrUpdate(i, spc.particles[i].pos);
+}
+
+void CellListNeighbours::remove(const index_type i) { cell_list->remove(i); }
+
+VerletListNeighbours::VerletListNeighbours(const Space& spc)
+    : spc(spc)
+{
+}
+
+void VerletListNeighbours::from_json(const json& j)
+{
+    const auto& j_verlet = j.at("verlet");
+    const auto cutoff = j_verlet.at("cutoff").get<double>();
+    skin = j_verlet.value("skin", 0.2 * cutoff);
+    if (cutoff <= 0.0 || skin < 0.0) {
+        throw ConfigurationError("verlet cutoff must be positive and skin non-negative");
+    }
+    cutoff_squared = cutoff * cutoff;
+    list_cutoff_squared = std::pow(cutoff + skin, 2);
+    max_displacement_squared = std::pow(0.5 * skin, 2);
+    dense = j_verlet.value("dense", true);
+}
+
+void VerletListNeighbours::to_json(json& j) const
+{
+    j["verlet"] = {{"cutoff", std::sqrt(cutoff_squared)},
+                   {"skin", skin},
+                   {"dense", dense},
+                   {"list updates", list_updates}};
+}
+
+void VerletListNeighbours::reset()
+{
+    cell_list = ParticleCellList::create(spc.geometry, std::sqrt(list_cutoff_squared), dense);
+    neighbours.assign(spc.particles.size(), {});
+    reference_positions.resize(spc.particles.size());
+    is_listed.assign(spc.particles.size(), false);
+}
+
+/**
+ * The list is kept if the particle is still within half the skin from its reference position.
+ * Otherwise the particle is taken out of all lists and its list is rebuilt from the reference
+ * positions of the other particles found in the cell list.
+ */
+void VerletListNeighbours::insertOrUpdate(const index_type i)
+{
+    const auto& position = spc.particles[i].pos;
+    if (is_listed[i] &&
+        spc.geometry.sqdist(position, reference_positions[i]) < max_displacement_squared) {
+        return;
+    }
+    remove(i);
+    reference_positions[i] = position;
+    neighbour_cells.clear();
+    cell_list->neighbourCells(position, neighbour_cells);
+    for (const auto* members : neighbour_cells) {
+        for (const auto j : *members) {
+            if (spc.geometry.sqdist(position, reference_positions[j]) < list_cutoff_squared) {
+                neighbours[i].push_back(j);
+                neighbours[j].push_back(i);
+            }
+        }
+    }
+    cell_list->insertOrUpdate(i, position);
+    is_listed[i] = true;
+    list_updates++;
+}
+
+void VerletListNeighbours::remove(const index_type i)
+{
+    if (!is_listed[i]) {
+        return;
+    }
+    for (const auto j : neighbours[i]) {
+        auto& other_neighbours = neighbours[j];
+        const auto it = std::find(other_neighbours.begin(), other_neighbours.end(), i);
+        assert(it != other_neighbours.end());
+        *it = other_neighbours.back();
+        other_neighbours.pop_back();
+    }
+    neighbours[i].clear();
+    cell_list->remove(i);
+    is_listed[i] = false;
+}
+
+/**
+ * @brief Test setup with `number_of_salt` A⁺B⁻ pairs in a single group in a 40 Å cube
+ *
+ * Replaces the atom list with A and B (σ = 2 Å, q = ±1, plus `atom_properties`) and the
+ * molecule list with the atomic molecules `salt` (A, B) and `cations` (A). Molecules in
+ * `other_insertions` are inserted after the salt.
+ */
+static Space makeSaltSpace(const int number_of_salt, const json& atom_properties = json::object(),
+                           const json& other_insertions = json::array())
+{
+    pc::temperature = 300.0_K;
+    auto atom_list = R"([
+        { "A": { "sigma": 2.0, "q": 1.0 } },
+        { "B": { "sigma": 2.0, "q": -1.0 } }
+    ])"_json;
+    for (auto& atom : atom_list) {
+        atom.begin().value().update(atom_properties);
+    }
+    atoms = atom_list.get<decltype(atoms)>();
+    molecules = R"([
+        { "salt": { "atomic": true, "atoms": ["A", "B"] } },
+        { "cations": { "atomic": true, "atoms": ["A"] } }
+    ])"_json.get<decltype(molecules)>();
+
+    Space spc;
+    spc.geometry = R"( {"type": "cuboid", "length": 40} )"_json;
+    json j_insert = json::array();
+    j_insert.push_back({{"salt", {{"N", number_of_salt}}}});
+    j_insert.insert(j_insert.end(), other_insertions.begin(), other_insertions.end());
+    InsertMoleculesInSpace::insertMolecules(j_insert, spc);
+    return spc;
+}
+
+TEST_CASE_TEMPLATE("[Faunus] CellListPairingPolicy", TPairingPolicy,
+                   CellListPairingPolicy<GroupCutoff>, VerletListPairingPolicy<GroupCutoff>)
+{
+    using doctest::Approx;
+    Space spc = makeSaltSpace(100);
+
+    const auto j = R"({"coulomb": {"type": "yukawa", "epsr": 80, "debyelength": 5,
+                                   "shift": true, "cutoff": 9},
+                       "wca": {"mixing": "LB"}, "celllist": {"cutoff": 9},
+                       "verlet": {"cutoff": 9, "skin": 2}})"_json;
+    using PairEnergyType = PairEnergy<pairpotential::CombinedPairPotential<
+                                          pairpotential::NewCoulombGalore,
+                                          pairpotential::WeeksChandlerAndersen>,
+                                      false>;
+    BasePointerVector<EnergyTerm> potentials;
+    Nonbonded<PairEnergyType, GroupPairing<GroupPairingPolicy<GroupCutoff>>> reference(
+        j, spc, potentials);
+    Nonbonded<PairEnergyType, GroupPairing<TPairingPolicy>> celllist(j, spc, potentials);
+
+    Change change;
+    change.everything = true;
+    CHECK_EQ(celllist.energy(change), Approx(reference.energy(change)));
+
+    SUBCASE("Single particle move")
+    {
+        change.everything = false;
+        auto& group_change = change.groups.emplace_back();
+        group_change.group_index = 0;
+        group_change.relative_atom_indices = {3};
+        spc.particles.at(3).pos = {1.0, -2.0, 19.5};
+        CHECK_EQ(celllist.energy(change), Approx(reference.energy(change)));
+        group_change.internal = true;
+        CHECK_EQ(celllist.energy(change), Approx(reference.energy(change)));
+        group_change.relative_atom_indices = {3, 7, 8};
+        spc.particles.at(7).pos = {-19.9, 0.0, 0.0};
+        CHECK_EQ(celllist.energy(change), Approx(reference.energy(change)));
+        // small steps within and beyond the Verlet skin
+        for (int step = 0; step < 10; ++step) {
+            spc.particles.at(8).pos.x() += 0.4;
+            spc.geometry.boundary(spc.particles.at(8).pos);
+            CHECK_EQ(celllist.energy(change), Approx(reference.energy(change)));
+        }
+        change.clear();
+        change.everything = true;
+        CHECK_EQ(celllist.energy(change), Approx(reference.energy(change)));
+    }
+}
+
+TEST_CASE("[Faunus] GroupPairingPolicy with particle arrays")
+{
+    using doctest::Approx;
+    Space spc = makeSaltSpace(100);
+
+    auto j = R"({"coulomb": {"type": "yukawa", "epsr": 80, "debyelength": 5},
+                 "wca": {"mixing": "LB"}})"_json;
+    using PairEnergyType = PairEnergy<pairpotential::CombinedPairPotential<
+                                          pairpotential::NewCoulombGalore,
+                                          pairpotential::WeeksChandlerAndersen>,
+                                      false>;
+    using NonbondedType = Nonbonded<PairEnergyType, GroupPairing<GroupPairingPolicy<GroupCutoff>>>;
+    BasePointerVector<EnergyTerm> potentials;
+    NonbondedType reference(j, spc, potentials);
+    j["soa"] = true;
+    NonbondedType nonbonded(j, spc, potentials);
+
+    Change change;
+    change.everything = true;
+    CHECK_EQ(nonbonded.energy(change), Approx(reference.energy(change)));
+
+    change.everything = false;
+    auto& group_change = change.groups.emplace_back();
+    group_change.group_index = 0;
+    group_change.internal = true;
+    group_change.relative_atom_indices = {3};
+    spc.particles.at(3).pos = {1.0, -2.0, 19.5};
+    CHECK_EQ(nonbonded.energy(change), Approx(reference.energy(change)));
+    group_change.relative_atom_indices = {3, 7};
+    spc.particles.at(7).pos = {-19.9, 0.0, 0.0};
+    CHECK_EQ(nonbonded.energy(change), Approx(reference.energy(change)));
+
+    SUBCASE("Groups outside space")
+    {
+        // as in AngularScan, groups may be formed from particles not stored in the space
+        ParticleVector particles(spc.particles.begin(), spc.particles.begin() + 20);
+        for (auto& particle : particles) {
+            particle.pos += Point(0.5, 0.5, 0.5);
+        }
+        Group group1(0, particles.begin(), particles.begin() + 10);
+        Group group2(0, particles.begin() + 10, particles.end());
+        CHECK_EQ(nonbonded.groupGroupEnergy(group1, group2),
+                 Approx(reference.groupGroupEnergy(group1, group2)));
+        CHECK_EQ(nonbonded.groupGroupEnergy(group1, spc.groups.front()),
+                 Approx(reference.groupGroupEnergy(group1, spc.groups.front())));
+        CHECK_EQ(nonbonded.groupGroupEnergy(spc.groups.front(), group2),
+                 Approx(reference.groupGroupEnergy(spc.groups.front(), group2)));
+    }
+}
+
+TEST_CASE("[Faunus] ThreadPoolEnergyAccumulator")
+{
+    using doctest::Approx;
+    Space spc = makeSaltSpace(400);
+
+    auto j = R"({"coulomb": {"type": "plain", "epsr": 80}, "wca": {"mixing": "LB"}})"_json;
+    using PairEnergyType = PairEnergy<pairpotential::CombinedPairPotential<
+                                          pairpotential::NewCoulombGalore,
+                                          pairpotential::WeeksChandlerAndersen>,
+                                      false>;
+    using NonbondedType = Nonbonded<PairEnergyType, GroupPairing<GroupPairingPolicy<GroupCutoff>>>;
+    BasePointerVector<EnergyTerm> potentials;
+    NonbondedType reference(j, spc, potentials);
+    j["summation_policy"] = "threads";
+    NonbondedType single_thread(j, spc, potentials);
+    NonbondedType multiple_threads(j, spc, potentials);
+    single_thread.setThreadPool(std::make_shared<ThreadPool>(1));
+    multiple_threads.setThreadPool(std::make_shared<ThreadPool>(4));
+
+    auto check_energies = [&](const Change& change) {
+        const auto energy = single_thread.energy(change);
+        CHECK_EQ(energy, Approx(reference.energy(change)));
+        CHECK_EQ(energy, multiple_threads.energy(change)); // bitwise reproducible
+    };
+
+    Change change;
+    change.everything = true;
+    check_energies(change);
+
+    change.everything = false;
+    auto& group_change = change.groups.emplace_back();
+    group_change.group_index = 0;
+    group_change.internal = true;
+    group_change.relative_atom_indices = {3};
+    spc.particles.at(3).pos = {1.0, -2.0, 19.5};
+    check_energies(change);
+}
+
+TEST_CASE("[Faunus] Nonbonded::force")
+{
+    Space spc = makeSaltSpace(200);
+    auto& group = spc.groups.at(0);
+    group.deactivate(group.end() - 10, group.end());
+
+    auto j = R"({"coulomb": {"type": "plain", "epsr": 80}, "wca": {"mixing": "LB"}})"_json;
+    using PairPotentialType = pairpotential::CombinedPairPotential<
+        pairpotential::NewCoulombGalore, pairpotential::WeeksChandlerAndersen>;
+    using NonbondedType = Nonbonded<PairEnergy<PairPotentialType, false>,
+                                    GroupPairing<GroupPairingPolicy<GroupCutoff>>>;
+    BasePointerVector<EnergyTerm> potentials;
+    NonbondedType serial(j, spc, potentials);
+    j["summation_policy"] = "threads";
+    NonbondedType threaded(j, spc, potentials);
+    threaded.setThreadPool(std::make_shared<ThreadPool>(3));
+
+    // reference: all pairs of active particles
+    auto pair_potential = pairpotential::makePairPotential<PairPotentialType>(j);
+    PointVector reference_forces(spc.particles.size(), Point::Zero());
+    for (auto i = group.begin(); i != group.end(); ++i) {
+        for (auto k = std::next(i); k != group.end(); ++k) {
+            const Point distance = spc.geometry.vdist(i->pos, k->pos);
+            const Point force = pair_potential.force(*i, *k, distance.squaredNorm(), distance);
+            reference_forces[std::distance(group.begin(), i)] += force;
+            reference_forces[std::distance(group.begin(), k)] -= force;
+        }
+    }
+
+    for (auto* nonbonded : {&serial, &threaded}) {
+        PointVector forces(spc.particles.size(), Point::Zero());
+        nonbonded->force(forces);
+        for (size_t i = 0; i < forces.size(); ++i) {
+            CHECK_LT((forces[i] - reference_forces[i]).norm(), 1e-8);
+        }
+        CHECK_EQ(forces.back().norm(), 0.0); // inactive
+    }
+}
+
+TEST_CASE("[Faunus] GroupPairingPolicy with particle arrays - Benchmarks")
+{
+    using PairEnergyType =
+        PairEnergy<pairpotential::CombinedPairPotential<pairpotential::NewCoulombGalore,
+                                                        pairpotential::LennardJones>,
+                   false>;
+    using NonbondedType = Nonbonded<PairEnergyType, GroupPairing<GroupPairingPolicy<GroupCutoff>>>;
+    const auto j = R"({"coulomb": {"type": "fanourgakis", "epsr": 1, "cutoff": 14},
+                       "lennardjones": {"mixing": "LB"}})"_json;
+
+    // benchmarks a full energy and a single particle displacement with and without `soa`
+    auto run_benchmarks = [&](Space& spc, const std::string& name) {
+        BasePointerVector<EnergyTerm> potentials;
+        NonbondedType aos(j, spc, potentials);
+        auto j_soa = j;
+        j_soa["soa"] = true;
+        NonbondedType soa(j_soa, spc, potentials);
+        Change everything;
+        everything.everything = true;
+        Change single;
+        auto& group_change = single.groups.emplace_back();
+        group_change.group_index = 0;
+        group_change.internal = true;
+        group_change.relative_atom_indices = {0};
+        CHECK_EQ(soa.energy(everything), doctest::Approx(aos.energy(everything)));
+
+        ankerl::nanobench::Bench bench;
+        bench.title(name).minEpochIterations(5);
+        bench.run("all AoS", [&] { ankerl::nanobench::doNotOptimizeAway(aos.energy(everything)); });
+        bench.run("all SoA", [&] { ankerl::nanobench::doNotOptimizeAway(soa.energy(everything)); });
+        bench.minEpochIterations(100);
+        bench.run("particle AoS",
+                  [&] { ankerl::nanobench::doNotOptimizeAway(aos.energy(single)); });
+        bench.run("particle SoA",
+                  [&] { ankerl::nanobench::doNotOptimizeAway(soa.energy(single)); });
+    };
+
+    SUBCASE("bulk")
+    {
+        // as examples/bulk
+        pc::temperature = 1100.0_K;
+        atoms = R"([
+            { "Na": { "sigma": 3.33, "eps": 0.01158968, "q": 1.0 } },
+            { "Cl": { "sigma": 4.4, "eps": 0.4184, "q": -1.0 } }
+        ])"_json.get<decltype(atoms)>();
+        molecules = R"([
+            { "salt": { "atomic": true, "atoms": ["Na", "Cl"] } }
+        ])"_json.get<decltype(molecules)>();
+        Space spc;
+        spc.geometry = R"( {"type": "cuboid", "length": 42.5} )"_json;
+        json j_insert = json::array();
+        j_insert.push_back({{"salt", {{"N", 1152}}}});
+        InsertMoleculesInSpace::insertMolecules(j_insert, spc);
+        run_benchmarks(spc, "bulk");
+    }
+
+    SUBCASE("water")
+    {
+        // SPC/E water as examples/water, at roughly the same density
+        Space spc;
+        SpaceFactory::makeWater(spc, 1000, R"( {"type": "cuboid", "length": 31.0} )"_json);
+        run_benchmarks(spc, "water");
+    }
+}
+
+TEST_CASE("[Faunus] Nonbonded::energyChange")
+{
+    using doctest::Approx;
+    Space spc = makeSaltSpace(20);
+    Space old_spc = makeSaltSpace(20);
+    std::copy(spc.particles.begin(), spc.particles.end(), old_spc.particles.begin());
+
+    const auto j = R"({"coulomb": {"type": "plain", "epsr": 80},
+                       "wca": {"mixing": "LB"}})"_json;
+    using PairEnergyType = PairEnergy<pairpotential::CombinedPairPotential<
+                                          pairpotential::NewCoulombGalore,
+                                          pairpotential::WeeksChandlerAndersen>,
+                                      false>;
+    BasePointerVector<EnergyTerm> potentials;
+    Nonbonded<PairEnergyType, GroupPairing<GroupPairingPolicy<GroupCutoff>>> nonbonded(
+        j, spc, potentials);
+    Nonbonded<PairEnergyType, GroupPairing<GroupPairingPolicy<GroupCutoff>>> old_nonbonded(
+        j, old_spc, potentials);
+
+    Change change;
+    auto& group_change = change.groups.emplace_back();
+    group_change.group_index = 0;
+    group_change.relative_atom_indices = {3, 8};
+    spc.particles.at(3).pos = {1.0, -2.0, 19.5};
+    spc.particles.at(8).pos = {-4.0, 2.0, 0.5};
+
+    const auto [trial_energy, old_energy] = nonbonded.energyChange(old_nonbonded, change);
+    CHECK_EQ(trial_energy, Approx(nonbonded.energy(change)));
+    CHECK_EQ(old_energy, Approx(old_nonbonded.energy(change)));
+    CHECK(trial_energy != Approx(old_energy));
+}
+
+TEST_CASE("[Faunus] Nonbonded::energyChange with homogeneous terms")
+{
+    using doctest::Approx;
+    const auto epsilon = R"({"eps": 0.2})"_json;
+    Space spc = makeSaltSpace(20, epsilon);
+    Space old_spc = makeSaltSpace(20, epsilon);
+    std::copy(spc.particles.begin(), spc.particles.end(), old_spc.particles.begin());
+
+    const auto j = R"({"coulomb": {"type": "plain", "epsr": 80},
+                       "lennardjones": {"mixing": "LB"}})"_json;
+    using PairEnergyType = PairEnergy<pairpotential::CombinedPairPotential<
+                                          pairpotential::NewCoulombGalore,
+                                          pairpotential::LennardJones>,
+                                      false>;
+    using NonbondedType = Nonbonded<PairEnergyType, GroupPairing<GroupPairingPolicy<GroupCutoff>>>;
+    BasePointerVector<EnergyTerm> potentials;
+    NonbondedType nonbonded(j, spc, potentials);
+    NonbondedType old_nonbonded(j, old_spc, potentials);
+    NonbondedType reference(j, spc, potentials);
+    NonbondedType old_reference(j, old_spc, potentials);
+
+    Change volume_change;
+    volume_change.everything = true;
+    volume_change.volume_change = true;
+    volume_change.positions_only = true;
+    const auto volume_move = [&](const double volume) {
+        nonbonded.updateState(volume_change);
+        spc.scaleVolume(volume, Geometry::VolumeMethod::ISOTROPIC);
+        const auto [trial_energy, old_energy] =
+            nonbonded.energyChange(old_nonbonded, volume_change);
+        CHECK_EQ(trial_energy, Approx(reference.energy(volume_change)));
+        CHECK_EQ(old_energy, Approx(old_reference.energy(volume_change)));
+        CHECK(trial_energy != Approx(old_energy));
+    };
+
+    volume_move(50000.0); // unknown terms: a single evaluation of the trial configuration
+    spc.sync(old_spc, volume_change); // reject
+    nonbonded.sync(&old_nonbonded, volume_change);
+    volume_move(80000.0); // scaling of known terms
+    old_spc.sync(spc, volume_change); // accept
+    old_nonbonded.sync(&nonbonded, volume_change);
+
+    Change change; // partial update of known terms
+    auto& group_change = change.groups.emplace_back();
+    group_change.group_index = 0;
+    group_change.relative_atom_indices = {3, 8};
+    nonbonded.updateState(change);
+    spc.particles.at(3).pos = {1.0, -2.0, 19.5};
+    spc.particles.at(8).pos = {-4.0, 2.0, 0.5};
+    const auto [trial_energy, old_energy] = nonbonded.energyChange(old_nonbonded, change);
+    CHECK_EQ(trial_energy, Approx(reference.energy(change)));
+    CHECK_EQ(old_energy, Approx(old_reference.energy(change)));
+    old_spc.sync(spc, change); // accept
+    old_nonbonded.sync(&nonbonded, change);
+
+    volume_move(60000.0); // scaling of known, partially updated terms
+}
+
+TEST_CASE_TEMPLATE("[Faunus] GroupEnergyMatrix", T, float, double)
+{
+    GroupEnergyMatrix<T> matrix;
+    matrix.reset(4);
+    matrix.set(0, 0, 1.0);
+    matrix.set(0, 2, -2.0);
+    matrix.set(3, 1, 4.0);
+    matrix.set(1, 2, 0.0);
+    CHECK_EQ(matrix.size(), 4);
+    CHECK_EQ(matrix.nonZeros(), 3);
+    CHECK_EQ(matrix(2, 0), -2.0);
+    CHECK_EQ(matrix(1, 3), 4.0);
+    CHECK_EQ(matrix(1, 2), 0.0);
+    CHECK_EQ(matrix.sum(), doctest::Approx(3.0));
+
+    GroupEnergyMatrix<T> other = matrix;
+    other.set(0, 2, 0.0);
+    other.set(0, 1, 0.5);
+    matrix.copyRow(other, 0);
+    CHECK_EQ(matrix(2, 0), 0.0);
+    CHECK_EQ(matrix(1, 0), 0.5);
+    CHECK_EQ(matrix.nonZeros(), 3);
+    matrix.set(3, 1, 0.0);
+    CHECK_EQ(matrix.nonZeros(), 2);
+}
+
+TEST_CASE("[Faunus] NonbondedCached")
+{
+    using doctest::Approx;
+    const auto cations = R"([{"cations": {"N": 4}}, {"cations": {"N": 3}}])"_json;
+    Space spc = makeSaltSpace(10, json::object(), cations);
+    Space old_spc = makeSaltSpace(10, json::object(), cations);
+    std::copy(spc.particles.begin(), spc.particles.end(), old_spc.particles.begin());
+
+    const auto j = R"({"coulomb": {"type": "plain", "epsr": 80},
+                       "wca": {"mixing": "LB"}})"_json;
+    using PairEnergyType = PairEnergy<pairpotential::CombinedPairPotential<
+                                          pairpotential::NewCoulombGalore,
+                                          pairpotential::WeeksChandlerAndersen>,
+                                      false>;
+    using PairingType = GroupPairing<GroupPairingPolicy<GroupCutoff>>;
+    BasePointerVector<EnergyTerm> potentials;
+    NonbondedCached<PairEnergyType, PairingType> cached(j, spc, potentials);
+    NonbondedCached<PairEnergyType, PairingType> old_cached(j, old_spc, potentials);
+    Nonbonded<PairEnergyType, PairingType> reference(j, spc, potentials);
+    Nonbonded<PairEnergyType, PairingType> old_reference(j, old_spc, potentials);
+    cached.state = EnergyTerm::MonteCarloState::TRIAL;
+    old_cached.state = EnergyTerm::MonteCarloState::ACCEPTED;
+
+    // compares the energy change with the reference and accepts the move
+    auto check_and_accept = [&](const Change& change) {
+        const auto [trial_energy, old_energy] = cached.energyChange(old_cached, change);
+        const auto [reference_trial, reference_old] =
+            reference.energyChange(old_reference, change);
+        CHECK_EQ(trial_energy - old_energy, Approx(reference_trial - reference_old));
+        CHECK_EQ(trial_energy, Approx(cached.energy(change)));
+        CHECK_EQ(old_energy, Approx(NonbondedCached<PairEnergyType, PairingType>(
+                                        j, old_spc, potentials).energy(change)));
+        old_spc.sync(spc, change);
+        old_cached.sync(&cached, change);
+    };
+
+    SUBCASE("Partial and complete group changes")
+    {
+        Change change;
+        auto& group_change = change.groups.emplace_back();
+        group_change.group_index = 0;
+        group_change.internal = true;
+        group_change.relative_atom_indices = {3, 8};
+        spc.particles.at(3).pos = {1.0, -2.0, 19.5};
+        spc.particles.at(8).pos = {-4.0, 2.0, 0.5};
+        check_and_accept(change);
+
+        group_change.group_index = 1;
+        group_change.relative_atom_indices.clear();
+        group_change.all = true;
+        spc.groups.at(1).translate({2.0, 1.0, 0.0}, spc.geometry.getBoundaryFunc());
+        check_and_accept(change);
+
+        group_change.group_index = 0;
+        group_change.all = false;
+        group_change.relative_atom_indices = {5};
+        spc.groups.at(0)[5].pos = {0.0, 0.0, 0.0};
+        check_and_accept(change);
+    }
+
+    SUBCASE("Change in number of particles")
+    {
+        auto& group = spc.groups.at(2);
+        Change change;
+        change.matter_change = true;
+        auto& group_change = change.groups.emplace_back();
+        group_change.group_index = 2;
+        group_change.dNatomic = true;
+        group_change.internal = true;
+        group_change.relative_atom_indices = {group.size() - 1};
+        group.deactivate(group.end() - 1, group.end());
+        check_and_accept(change);
+    }
+}
+
 //==================== GroupCutoff ====================
 
 GroupCutoff::GroupCutoff(Space::GeometryType& geometry)
@@ -1928,6 +3365,14 @@ void from_json(const json& j, GroupCutoff& cutoff)
             }
         }
     }
+    cutoff.has_finite_cutoff = false;
+    for (const auto& molecule1 : Faunus::molecules) {
+        for (const auto& molecule2 : Faunus::molecules) {
+            if (cutoff.cutoff_squared(molecule1.id(), molecule2.id()) < pc::max_value) {
+                cutoff.has_finite_cutoff = true;
+            }
+        }
+    }
 }
 
 void to_json(json& j, const GroupCutoff& cutoff)
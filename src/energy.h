@@ -8,14 +8,17 @@
 #include "aux/iteratorsupport.h"
 #include "aux/pairmatrix.h"
 #include "smart_montecarlo.h"
+#include "threadpool.h"
 #include <range/v3/range/conversion.hpp>
 #include <Eigen/Dense>
+#include <unsupported/Eigen/FFT>
 #include <spdlog/spdlog.h>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
 #include <concepts>
 #include <optional>
+#include <unordered_map>
 
 struct freesasa_parameters_fwd; // workaround for freesasa unnamed struct that cannot be forward
                                 // declared
@@ -90,12 +93,14 @@ class ContainerOverlap : public EnergyTerm
  * Related reading:
  * - PBC Ewald (DOI:10.1063/1.481216)
  * - IPBC Ewald (DOI:10/css8)
+ * - Smooth particle-mesh Ewald (DOI:10.1063/1.470117)
  * - Update optimization (DOI:10.1063/1.481216, Eq. 24)
  */
 struct EwaldData
 {
     using Tcomplex = std::complex<double>;
     Eigen::Matrix3Xd k_vectors; //!< k-vectors, 3xK
+    Eigen::Matrix3Xi k_indices; //!< Integer lattice vectors, n, of the k-vectors, k = 2πn/L, 3xK
     Eigen::VectorXd Aks;        //!< 1xK for update optimization (see Eq.24, DOI:10.1063/1.481216)
     Eigen::VectorXcd Q_ion, Q_dipole;       //!< Complex 1xK vectors
     double r_cutoff = 0;                    //!< Real-space cutoff
@@ -111,12 +116,22 @@ struct EwaldData
     int num_kvectors = 0;
     Point box_length = {0.0, 0.0, 0.0}; //!< Box dimensions
 
+    int mesh_size = 0;              //!< SPME: number of mesh points in each dimension
+    int spline_order = 6;           //!< SPME: order of B-splines used for charge assignment
+    double mesh_tolerance = 0;      //!< SPME: allowed relative deviation from PBC (0 = unchecked)
+    Eigen::VectorXd charge_mesh;    //!< SPME: charges spread on the mesh, K^3
+    std::vector<bool> dirty_mesh_planes; //!< SPME: x-planes of `charge_mesh` changed since sync
+    Eigen::VectorXi mesh_indices;   //!< SPME: mesh index of each k-vector, 1xK
+    Eigen::VectorXcd mesh_moduli;   //!< SPME: Euler exponential spline factor of each k-vector, 1xK
+    static constexpr int max_spline_order = 12;
+
     enum Policies
     {
         PBC,
         PBCEigen,
         IPBC,
         IPBCEigen,
+        SPME,
         INVALID
     }; //!< Possible k-space updating schemes
 
@@ -130,10 +145,61 @@ NLOHMANN_JSON_SERIALIZE_ENUM(EwaldData::Policies, {
                                                       {EwaldData::PBCEigen, "PBCEigen"},
                                                       {EwaldData::IPBC, "IPBC"},
                                                       {EwaldData::IPBCEigen, "IPBCEigen"},
+                                                      {EwaldData::SPME, "SPME"},
                                                   })
 
 void to_json(json& j, const EwaldData& d);
 
+/**
+ * @brief Complex exponentials, exp(ik·r), of a particle position for all k-vectors
+ *
+ * As the k-vectors lie on the lattice k = 2π(nx/Lx, ny/Ly, nz/Lz), the exponential factorizes
+ * into exp(ikx·x) exp(iky·y) exp(ikz·z). For each dimension, the factors for all n are generated
+ * from a single cosine and sine by complex multiplication and stored as contiguous cosine and sine
+ * tables. Each k-vector then costs two complex multiplications instead of a cosine and a sine.
+ */
+class EwaldExponentials
+{
+    int n_max = 0;                                //!< Largest |n| in any dimension
+    Point box_length;                             //!< Box dimensions
+    std::array<std::vector<int>, 3> offsets;      //!< Table offset, n + n_max, of each k-vector
+    std::array<std::vector<double>, 3> cosines;   //!< cos(2πnx/L) for n in [-n_max, n_max]
+    std::array<std::vector<double>, 3> sines;     //!< sin(2πnx/L) for n in [-n_max, n_max]
+
+  public:
+    explicit EwaldExponentials(const EwaldData& data);
+    void update(const Point& position); //!< Generate tables for a new particle position
+
+    //! exp(ik·r) for the k'th k-vector
+    inline EwaldData::Tcomplex operator[](const std::size_t k) const
+    {
+        const auto x = offsets[0][k], y = offsets[1][k], z = offsets[2][k];
+        const auto real_xy = cosines[0][x] * cosines[1][y] - sines[0][x] * sines[1][y];
+        const auto imag_xy = cosines[0][x] * sines[1][y] + sines[0][x] * cosines[1][y];
+        return {real_xy * cosines[2][z] - imag_xy * sines[2][z],
+                real_xy * sines[2][z] + imag_xy * cosines[2][z]};
+    }
+
+    //! Add charge × exp(ik·r) for all k-vectors, see eq. 25 in doi:10.1063/1.481216
+    inline void addTo(Eigen::VectorXcd& structure_factor, const double charge) const
+    {
+        assert(static_cast<std::size_t>(structure_factor.size()) == offsets[0].size());
+        for (std::size_t k = 0; k < offsets[0].size(); k++) {
+            structure_factor[k] += charge * operator[](k);
+        }
+    }
+
+    //! Add charge × cos(kx·x) cos(ky·y) cos(kz·z) for all k-vectors, see eq. 2 in doi:10/css8
+    inline void addCosinesTo(Eigen::VectorXcd& structure_factor, const double charge) const
+    {
+        assert(static_cast<std::size_t>(structure_factor.size()) == offsets[0].size());
+        for (std::size_t k = 0; k < offsets[0].size(); k++) {
+            structure_factor[k] += charge * cosines[0][offsets[0][k]] *
+                                   cosines[1][offsets[1][k]] * cosines[2][offsets[2][k]];
+        }
+    }
+};
+
 /**
  * @brief Base class for Ewald k-space updates policies
  */
@@ -206,6 +272,8 @@ class EwaldPolicyBase
 
 /**
  * @brief Ion-Ion Ewald using periodic boundary conditions (PBC)
+ *
+ * The structure factor is built from the exponentials of `EwaldExponentials`
  */
 struct PolicyIonIon : public EwaldPolicyBase
 {
@@ -238,6 +306,45 @@ struct PolicyIonIonEigen : public PolicyIonIon
     double reciprocalEnergy(const EwaldData&) override;
 };
 
+/**
+ * @brief Ion-Ion Ewald with periodic boundary conditions (PBC) using smooth particle-mesh Ewald
+ *
+ * The k-vectors and `Aks` are those of `PolicyIonIon`, but the structure factor, `Q_ion`, is
+ * interpolated from charges spread onto a K^3 mesh with cardinal B-splines, followed by a
+ * three-dimensional FFT. This scales as N + K^3 log K instead of N times the number of
+ * k-vectors. As the FFT is linear, partial updates skip the transform and instead add the
+ * transformed spline stencil of each changed particle directly to `Q_ion`. The stencil is
+ * separable into one-dimensional sums, so each particle costs O(K + number of k-vectors),
+ * as for `PolicyIonIon`. The deviation from `PolicyIonIon` is controlled by
+ * `EwaldData::mesh_size` and `EwaldData::spline_order`.
+ */
+class PolicySPME : public PolicyIonIon
+{
+  private:
+    mutable Eigen::FFT<double> fft;
+    mutable std::vector<std::complex<double>> fft_input, fft_output; //!< Single mesh line
+    mutable Eigen::VectorXcd transformed_mesh;                        //!< FFT of `charge_mesh`
+    struct SplineStencil
+    {
+        std::array<std::array<double, EwaldData::max_spline_order>, 3> weights;
+        std::array<int, 3> floor_index; //!< Mesh point just below the scaled position
+    };
+    static void splineWeights(double fraction, int order, double* weights);
+    static SplineStencil splineStencil(const EwaldData& d, const Point& position);
+    static void spreadCharge(EwaldData& d, const SplineStencil& stencil, double charge);
+    static void addTransformedStencil(EwaldData& d, const SplineStencil& stencil, double charge);
+    void transformMesh(EwaldData& d) const; //!< FFT of charge mesh to `Q_ion`
+
+  public:
+    PolicySPME();
+    void updateBox(EwaldData& d, const Point& box) const override;
+    void updateComplex(EwaldData& d, const Space::GroupVector& groups) const override;
+    void updateComplex(EwaldData& d, const Change& change, const Space::GroupVector& groups,
+                       const Space::GroupVector& oldgroups) const override;
+    void adjustMeshSize(EwaldData& d, const Point& box, const Space::GroupVector& groups);
+    static int fftFriendlySize(int size); //!< Smallest number >= size with prime factors 2, 3, 5
+};
+
 /**
  * @brief Ion-Ion Ewald with isotropic periodic boundary conditions (IPBC)
  */
@@ -252,13 +359,13 @@ struct PolicyIonIonIPBC : public PolicyIonIon
 };
 
 /**
- * @brief Ion-Ion Ewald with isotropic periodic boundary conditions (IPBC) using Eigen operations
- * @warning Incomplete and under construction
+ * @brief Ion-Ion Ewald with isotropic periodic boundary conditions (IPBC)
+ *
+ * Kept for input compatibility: the cosine tables of `PolicyIonIonIPBC` already make the update
+ * vectorizable, hence this equals `PolicyIonIonIPBC`.
  */
 struct PolicyIonIonIPBCEigen : public PolicyIonIonIPBC
 {
-    using PolicyIonIonIPBC::updateComplex;
-    void updateComplex(EwaldData&, const Space::GroupVector&) const override;
 };
 
 /**
@@ -327,57 +434,41 @@ class Constrain : public EnergyTerm
  * in `inter` which is evaluated for every update of call to
  * `energy`.
  *
- * @todo Optimize.
+ * For partial updates, only bonds involving the changed particles are evaluated. These are
+ * looked up in a particle-to-bond index which for internal bonds is shared by all groups of
+ * the same molecule type. Hence the cost of moving a single particle in a chain is independent
+ * of the chain length.
  */
 class Bonded : public EnergyTerm
 {
   private:
     using BondVector = BasePointerVector<pairpotential::BondData>;
+    using BondIndex = std::vector<std::vector<std::size_t>>; //!< Bonds of each particle
     const Space& spc;
     BondVector external_bonds;                //!< inter-molecular bonds
     std::map<int, BondVector> internal_bonds; //!< intra-molecular bonds; key is group index
+    std::map<MoleculeData::index_type, BondIndex>
+        internal_bond_index; //!< Relative particle index -> internal bonds; key is molecule id
+    std::map<std::size_t, std::vector<std::size_t>>
+        external_bond_index; //!< Absolute particle index -> external bonds
     void updateGroupBonds(const Space::GroupType& group); //!< Update/set bonds internally in group
     double sumBondEnergy(const BondVector& bonds) const;  //!< sum energy in vector of BondData
     double internalGroupEnergy(const Change::GroupChange& changed); //!< Energy from internal bonds
-    double sumEnergy(const BondVector& bonds,
-                     const std::ranges::range auto& particle_indices) const;
+    double externalBondEnergy(const Change& change) const; //!< Energy from affected external bonds
+    std::vector<std::size_t> affectedInternalBonds(
+        const Change::GroupChange& changed) const; //!< Sorted internal bonds of changed atoms
+    double sumEnergy(const BondVector& bonds, const std::vector<std::size_t>& bond_indices) const;
     void updateInternalBonds(); //!< finds and adds all intra-molecular bonds of active molecules
 
   public:
     Bonded(const Space& spc, BondVector external_bonds);
     Bonded(const json& j, const Space& spc);
     void to_json(json& j) const override;
-    double energy(const Change& change) override;    //!< brute force -- refine this!
+    double energy(const Change& change) override;
+    EnergyPair energyChange(EnergyTerm& old_energy, const Change& change) override;
     void force(std::vector<Point>& forces) override; //!< Calculates the forces on all particles
 };
 
-/**
- * @brief Sum energy in vector of BondData for matching particle indices
- * @param bonds List of bonds
- * @param particle_indices Particle indices to calculate the energy for
- *
- * To speed up the bond search, the given indices must be ordered which allows
- * for binary search which on large systems provides superior performance compared
- * to simplistic search which scales as number_of_bonds x number_of_moved_particles
- */
-double Bonded::sumEnergy(const Bonded::BondVector& bonds,
-                         const std::ranges::range auto& particle_indices) const
-{
-    assert(std::is_sorted(particle_indices.begin(), particle_indices.end()));
-
-    auto index_is_included = [&](auto index) {
-        return std::binary_search(particle_indices.begin(), particle_indices.end(), index);
-    };
-    auto affected_bonds = bonds | std::views::filter([&](const auto& bond) {
-                              return std::ranges::any_of(bond->indices, index_is_included);
-                          });
-    auto bond_energy = [dist = spc.geometry.getDistanceFunc()](const auto& bond) {
-        return bond->energyFunc(dist);
-    };
-    return std::transform_reduce(affected_bonds.begin(), affected_bonds.end(), 0.0, std::plus<>(),
-                                 bond_energy);
-}
-
 /**
  * @brief Provides a complementary set of ints with respect to the iota set of a given size.
  * @remark It is used as a helper function for pair interactions.
@@ -440,6 +531,66 @@ class PairEnergy
         }
     }
 
+    /**
+     * @brief Sum of pair potential energies between a particle and a contiguous range of particles
+     *
+     * The minimum image distances are first calculated in chunks by a vectorizable loop over the
+     * structure-of-arrays, whereafter the pair potential is evaluated from ids, charges, and
+     * distances only, for a whole chunk at once if supported by the pair potential. This is
+     * available for isotropic pair potentials in orthogonal geometries.
+     *
+     * @param arrays  particle arrays mirroring `Space::particles`
+     * @param index  index of the particle
+     * @param first  index of the first particle in the range
+     * @param last  index past the last particle in the range; the range must not contain `index`
+     * @return pair potential energy between the particle and the particles in the range
+     */
+    double potential(const ParticleArrays& arrays, const std::size_t index,
+                     const std::size_t first, const std::size_t last) const
+        requires pairpotential::RequireArrayPairPotential<TPairPotential>
+    {
+        assert(index < first || index >= last);
+        assert(geometry.boundaryConditions().coordinates == Geometry::Coordinates::ORTHOGONAL);
+        constexpr std::size_t chunk_size = 64;
+        alignas(64) std::array<double, chunk_size> squared_distances;
+        const Point box = geometry.getLength().cwiseProduct(
+            geometry.boundaryConditions().isPeriodic().cast<double>());
+        const double box_x = box.x(), box_y = box.y(), box_z = box.z();
+        const double half_x = 0.5 * box_x, half_y = 0.5 * box_y, half_z = 0.5 * box_z;
+        const double x = arrays.x[index], y = arrays.y[index], z = arrays.z[index];
+        const double charge = arrays.charge[index];
+        const int id = arrays.id[index];
+        double energy = 0.0;
+        for (auto chunk_begin = first; chunk_begin < last; chunk_begin += chunk_size) {
+            const auto size = std::min(chunk_size, last - chunk_begin);
+            const double* other_x = arrays.x.data() + chunk_begin;
+            const double* other_y = arrays.y.data() + chunk_begin;
+            const double* other_z = arrays.z.data() + chunk_begin;
+#pragma omp simd
+            for (std::size_t k = 0; k < size; ++k) { // minimum image convention; see sqdist()
+                auto dx = std::fabs(other_x[k] - x);
+                auto dy = std::fabs(other_y[k] - y);
+                auto dz = std::fabs(other_z[k] - z);
+                dx -= box_x * static_cast<double>(dx > half_x);
+                dy -= box_y * static_cast<double>(dy > half_y);
+                dz -= box_z * static_cast<double>(dz > half_z);
+                squared_distances[k] = dx * dx + dy * dy + dz * dz;
+            }
+            if constexpr (pairpotential::RequireBatchPairPotential<TPairPotential>) {
+                energy += pair_potential.batchEnergy(id, charge, arrays.id.data() + chunk_begin,
+                                                     arrays.charge.data() + chunk_begin,
+                                                     squared_distances.data(), size);
+            }
+            else {
+                for (std::size_t k = 0; k < size; ++k) {
+                    energy += pair_potential(id, arrays.id[chunk_begin + k], charge,
+                                             arrays.charge[chunk_begin + k], squared_distances[k]);
+                }
+            }
+        }
+        return energy;
+    }
+
     // just a temporary placement until PairForce class template will be implemented
     template <typename ParticleType>
     inline Point force(const ParticleType& a, const ParticleType& b) const
@@ -449,6 +600,28 @@ class PairEnergy
         return pair_potential.force(a, b, b_towards_a.squaredNorm(), b_towards_a);
     }
 
+    /**
+     * @brief Pair potential energy split into terms homogeneous in the distance
+     * @see pairpotential::HomogeneousTerms
+     */
+    template <typename ParticleType>
+    inline pairpotential::HomogeneousTerms homogeneousTerms(const ParticleType& a,
+                                                            const ParticleType& b) const
+        requires pairpotential::RequireHomogeneousPairPotential<TPairPotential>
+    {
+        assert(&a != &b); // a and b cannot be the same particle
+        return pair_potential.homogeneousTerms(a, b, geometry.sqdist(a.pos, b.pos));
+    }
+
+    //! True if the energy can be split into homogeneous terms, see `homogeneousTerms()`
+    bool isHomogeneous() const
+    {
+        if constexpr (pairpotential::RequireHomogeneousPairPotential<TPairPotential>) {
+            return pair_potential.isHomogeneous();
+        }
+        return false;
+    }
+
     /**
      * @brief A functor alias for potential().
      * @see potential()
@@ -514,6 +687,7 @@ class EnergyAccumulatorBase
         SERIAL,
         OPENMP,
         PARALLEL,
+        THREADS,
         INVALID
     };
     Scheme scheme = Scheme::SERIAL;
@@ -542,11 +716,41 @@ NLOHMANN_JSON_SERIALIZE_ENUM(EnergyAccumulatorBase::Scheme,
                              {{EnergyAccumulatorBase::Scheme::INVALID, nullptr},
                               {EnergyAccumulatorBase::Scheme::SERIAL, "serial"},
                               {EnergyAccumulatorBase::Scheme::OPENMP, "openmp"},
-                              {EnergyAccumulatorBase::Scheme::PARALLEL, "parallel"}})
+                              {EnergyAccumulatorBase::Scheme::PARALLEL, "parallel"},
+                              {EnergyAccumulatorBase::Scheme::THREADS, "threads"}})
 
 template <class T>
 concept RequireEnergyAccumulator = std::is_base_of_v<EnergyAccumulatorBase, T>;
 
+/**
+ * Concept matching a pair energy that can split the energy into homogeneous terms
+ * @see PairEnergy::homogeneousTerms
+ */
+template <class T>
+concept RequireHomogeneousPairEnergy = RequirePairEnergy<T> && requires(const T& instance) {
+    { instance.homogeneousTerms(Particle(), Particle()) };
+};
+
+/**
+ * Concept matching an energy accumulator which can defer the summation of a group of pairs as an
+ * independent task. The pairs of a task are added to a `TaskAccumulator` given to the task.
+ */
+template <class T>
+concept RequireTaskAccumulator = RequireEnergyAccumulator<T> && requires {
+    typename T::TaskAccumulator;
+};
+
+/**
+ * Concept matching an energy accumulator able to sum energies between a particle and a range of
+ * particles stored as `ParticleArrays`
+ */
+template <class T>
+concept RequireParticleArrayAccumulator =
+    RequireEnergyAccumulator<T> &&
+    requires(T& accumulator, const ParticleArrays& arrays, std::size_t index) {
+        accumulator.addParticleRange(arrays, index, index, index);
+    };
+
 /**
  * @brief A basic accumulator which immediately computes and adds energy of a pair of particles upon
  * addition using the PairEnergy templated class.
@@ -590,6 +794,19 @@ class InstantEnergyAccumulator : public EnergyAccumulatorBase
         return *this;
     }
 
+    /**
+     * @brief Adds energies between a particle and a contiguous range of particles
+     * @see PairEnergy::potential(const ParticleArrays&, std::size_t, std::size_t, std::size_t)
+     */
+    inline void addParticleRange(const ParticleArrays& arrays, const std::size_t index,
+                                 const std::size_t first, const std::size_t last)
+        requires requires(const PairEnergy& energy, const ParticleArrays& a, std::size_t i) {
+            energy.potential(a, i, i, i);
+        }
+    {
+        value += pair_energy.potential(arrays, index, first, last);
+    }
+
     void from_json(const json& j) override
     {
         EnergyAccumulatorBase::from_json(j);
@@ -718,616 +935,1742 @@ class DelayedEnergyAccumulator : public EnergyAccumulatorBase
     }
 };
 
-template <RequirePairEnergy TPairEnergy>
-std::unique_ptr<EnergyAccumulatorBase>
-createEnergyAccumulator(const json& j, const TPairEnergy& pair_energy, double initial_value)
-{
-    std::unique_ptr<EnergyAccumulatorBase> accumulator;
-    if (j.value("summation_policy", EnergyAccumulatorBase::Scheme::SERIAL) !=
-        EnergyAccumulatorBase::Scheme::SERIAL) {
-        accumulator =
-            std::make_unique<DelayedEnergyAccumulator<TPairEnergy>>(pair_energy, initial_value);
-        faunus_logger->debug("activated delayed energy summation");
-    }
-    else {
-        accumulator =
-            std::make_unique<InstantEnergyAccumulator<TPairEnergy>>(pair_energy, initial_value);
-        faunus_logger->debug("activated instant energy summation");
-    }
-    accumulator->from_json(j);
-    return accumulator;
-}
-
 /**
- * @brief Determines if two groups are separated beyond the cutoff distance.
+ * @brief Sums independent tasks of pair energies on a thread pool.
  *
- * The distance between centers of mass is considered. The cutoff distance can be specified
- * independently for each group pair to override the default value.
+ * The pairing policy submits groups of pairs, e.g., all pairs between two molecules, as tasks
+ * which are stored and evaluated only when `operator double()` is called. Each task sums its
+ * pairs into a private `InstantEnergyAccumulator` and the task sums are finally reduced in the
+ * order of submission. The result is therefore independent of the number of threads and of the
+ * scheduling. Pairs added individually, i.e., not as a part of a task, are summed immediately.
  *
- * @see GroupPairingPolicy
+ * @tparam PairEnergy  pair energy implementing a potential(a, b) method for particles a and b
+ * @see ThreadPool, GroupPairingPolicy::submit
  */
-class GroupCutoff
+template <RequirePairEnergy PairEnergy>
+class ThreadPoolEnergyAccumulator : public EnergyAccumulatorBase
 {
-    double default_cutoff_squared = pc::max_value;
-    PairMatrix<double>
-        cutoff_squared; //!< matrix with group-to-group cutoff distances squared in angstrom squared
-    Space::GeometryType& geometry; //!< geometry to compute the inter group distance with
-    friend void from_json(const json&, GroupCutoff&);
-    friend void to_json(json&, const GroupCutoff&);
-    void setSingleCutoff(double cutoff);
+  public:
+    using TaskAccumulator = InstantEnergyAccumulator<PairEnergy>;
+
+  private:
+    const PairEnergy&
+        pair_energy; //!< recipe to compute non-bonded energy between two particles, see PairEnergy
+    std::shared_ptr<ThreadPool> thread_pool;      //!< evaluates the tasks; serial if empty
+    std::vector<std::function<double()>> tasks;   //!< submitted tasks returning their energy
+    std::vector<double> task_energies;            //!< energy of each task in order of submission
+    std::vector<ThreadPool::Task> pool_tasks;     //!< batches of consecutive tasks
+    static constexpr std::size_t batches_per_thread = 8; //!< load balance vs scheduling overhead
 
   public:
-    /**
-     * @brief Determines if two groups are separated beyond the cutoff distance.
-     * @return true if the group-to-group distance is beyond the cutoff distance, false otherwise
-     */
-    inline bool cut(const Group& group1, const Group& group2)
+    explicit ThreadPoolEnergyAccumulator(const PairEnergy& pair_energy, const double value = 0.0)
+        : EnergyAccumulatorBase(value)
+        , pair_energy(pair_energy)
     {
-        if (group1.isAtomic() || group2.isAtomic()) {
-            return false; // atomic groups have ill-defined mass centers
-        }
-        return geometry.sqdist(group1.mass_center, group2.mass_center) >=
-               cutoff_squared(group1.id, group2.id);
     }
 
-    double getCutoff(size_t id1, size_t id2) const;
+    void setThreadPool(std::shared_ptr<ThreadPool> pool) { thread_pool = std::move(pool); }
 
     /**
-     * @brief A functor alias for cut().
-     * @see cut()
+     * @brief Defers a pairing as a task
+     * @param pairing  function adding pairs to the `TaskAccumulator` passed as its argument
      */
-    template <typename... Args> inline auto operator()(Args&&... args)
+    template <typename TPairing> void addTask(TPairing&& pairing)
     {
-        return cut(std::forward<Args>(args)...);
+        tasks.emplace_back([this, pairing = std::forward<TPairing>(pairing)]() {
+            TaskAccumulator accumulator(pair_energy);
+            pairing(accumulator);
+            return static_cast<double>(accumulator);
+        });
     }
 
-    /**
-     * @brief Sets the geometry.
-     * @param geometry  geometry to compute the inter group distance with
-     */
-    explicit GroupCutoff(Space::GeometryType& geometry);
-};
+    void clear() override
+    {
+        value = 0.0;
+        tasks.clear();
+    }
 
-void from_json(const json&, GroupCutoff&);
-void to_json(json&, const GroupCutoff&);
+    ThreadPoolEnergyAccumulator& operator=(const double new_value) override
+    {
+        clear();
+        value = new_value;
+        return *this;
+    }
+
+    inline ThreadPoolEnergyAccumulator& operator+=(const double new_value) override
+    {
+        value += new_value;
+        return *this;
+    }
+
+    inline ThreadPoolEnergyAccumulator& operator+=(ParticlePair&& pair) override
+    {
+        value += pair_energy.potential(pair.first.get(), pair.second.get());
+        return *this;
+    }
+
+    explicit operator double() override
+    {
+        if (!tasks.empty()) {
+            task_energies.assign(tasks.size(), 0.0);
+            const auto number_of_threads = thread_pool ? thread_pool->size() : 1;
+            const auto batch_size =
+                std::max<std::size_t>(1, tasks.size() / (batches_per_thread * number_of_threads));
+            pool_tasks.clear();
+            for (std::size_t first = 0; first < tasks.size(); first += batch_size) {
+                const auto last = std::min(first + batch_size, tasks.size());
+                pool_tasks.emplace_back([this, first, last]() {
+                    for (auto i = first; i < last; ++i) {
+                        task_energies[i] = tasks[i]();
+                    }
+                });
+            }
+            if (thread_pool) {
+                thread_pool->run(pool_tasks);
+            }
+            else {
+                std::for_each(pool_tasks.begin(), pool_tasks.end(), [](auto& task) { task(); });
+            }
+            value = std::accumulate(task_energies.begin(), task_energies.end(), value);
+            tasks.clear();
+        }
+        return value;
+    }
+};
 
 /**
- * @brief Particle pairing to calculate pairẃise interaction using particles' groups internally.
- * Depending on the accumulator provided, raw particle pairs, energy sum, etc. can be obtained.
- *
- * Accumulator is used as the first argument in all methods. Accumulator shall overload '+='
- * operator to accept a pair of particle references as used in particle2particle method.
+ * @brief Accumulates pair energies in two configurations at once.
  *
- * @remark Method arguments are generally not checked for correctness because of performance
- * reasons.
+ * Pairs are added as references to particles of the trial configuration. The energy of the very
+ * same pair in the old configuration is evaluated immediately thereafter using the particles at
+ * the same indices in the old particle vector. Hence a single enumeration of pairs yields both the
+ * trial and the old energy. The pairing must therefore not depend on the particle positions.
  *
- * @tparam TCutoff  a cutoff scheme between groups
- * @see InstantEnergyAccumulator, GroupCutoff
+ * @tparam PairEnergy  pair energy implementing a potential(a, b) method for particles a and b
+ * @see Nonbonded::energyChange
  */
-template <typename TCutoff> class GroupPairingPolicy
+template <RequirePairEnergy PairEnergy>
+class DualEnergyAccumulator : public EnergyAccumulatorBase
 {
-  protected:
-    const Space& spc; //!< a space to operate on
-    TCutoff cut; //!< a cutoff functor that determines if energy between two groups can be ignored
+  private:
+    const PairEnergy& pair_energy;       //!< pair energy in the trial configuration
+    const PairEnergy& old_pair_energy;   //!< pair energy in the old configuration
+    const ParticleVector& particles;     //!< particles in the trial configuration
+    const ParticleVector& old_particles; //!< particles in the old configuration
+    double old_value = 0.0;              //!< accumulated energy of the old configuration
 
-  public:
-    /**
-     * @param spc
-     */
-    explicit GroupPairingPolicy(Space& spc)
-        : spc(spc)
-        , cut(spc.geometry)
+    inline const Particle& oldParticle(const Particle& particle) const
     {
+        return old_particles[std::addressof(particle) - particles.data()];
     }
 
-    void from_json(const json& j) { Energy::from_json(j, cut); }
-
-    void to_json(json& j) const { Energy::to_json(j, cut); }
+  public:
+    DualEnergyAccumulator(const PairEnergy& pair_energy, const PairEnergy& old_pair_energy,
+                          const ParticleVector& particles, const ParticleVector& old_particles)
+        : EnergyAccumulatorBase(0.0)
+        , pair_energy(pair_energy)
+        , old_pair_energy(old_pair_energy)
+        , particles(particles)
+        , old_particles(old_particles)
+    {
+    }
 
-    /**
-     * @brief Add two interacting particles to the accumulator.
-     *
-     * Due to compiler optimization, the '+=' operator and this function itself may be inlined to
-     * significantly improve performance.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam T  an interacting particle
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param a  first particle
-     * @param b  second particle
-     */
-    template <RequireEnergyAccumulator TAccumulator, typename T>
-    inline void particle2particle(TAccumulator& pair_accumulator, const T& a, const T& b) const
+    inline DualEnergyAccumulator& operator=(const double new_value) override
     {
-        pair_accumulator += {std::cref(a), std::cref(b)};
+        value = new_value;
+        old_value = new_value;
+        return *this;
     }
 
-    /**
-     * @brief All pairings within a group.
-     *
-     * All pair interaction within the group are accumulated. The pair exclusions defined in the
-     * molecule topology are honoured.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam TGroup
-     * @param group
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     */
-    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
-    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group)
+    inline DualEnergyAccumulator& operator+=(const double new_value) override
     {
-        const auto& moldata = group.traits();
-        if (!moldata.rigid) {
-            const int group_size = group.size();
-            for (int i = 0; i < group_size - 1; ++i) {
-                for (int j = i + 1; j < group_size; ++j) {
-                    // This compound condition is faster than an outer atomic condition;
-                    // tested on bulk example in GCC 9.2.
-                    if (group.isAtomic() || !moldata.isPairExcluded(i, j)) {
-                        particle2particle(pair_accumulator, group[i], group[j]);
-                    }
-                }
-            }
-        }
+        value += new_value;
+        old_value += new_value;
+        return *this;
     }
 
-    /**
+    inline DualEnergyAccumulator& operator+=(ParticlePair&& pair) override
+    {
+        const auto& a = pair.first.get();
+        const auto& b = pair.second.get();
+        value += pair_energy.potential(a, b);
+        old_value += old_pair_energy.potential(oldParticle(a), oldParticle(b));
+        return *this;
+    }
+
+    void clear() override
+    {
+        value = 0.0;
+        old_value = 0.0;
+    }
+
+    double oldValue() const { return old_value; } //!< Accumulated energy of the old configuration
+};
+
+/**
+ * @brief Accumulates pair energies split into terms homogeneous in the distance.
+ *
+ * The terms are summed separately such that the energy after scaling all distances, as in an
+ * isotropic volume move, follows without evaluating any pair, see
+ * `pairpotential::scaleHomogeneousTerms()`. If an old configuration is given, each pair is in
+ * addition evaluated there, as in `DualEnergyAccumulator`.
+ *
+ * @tparam PairEnergy  pair energy implementing a homogeneousTerms(a, b) method
+ * @see Nonbonded::energyChange
+ */
+template <RequireHomogeneousPairEnergy PairEnergy>
+class HomogeneousTermsAccumulator : public EnergyAccumulatorBase
+{
+  private:
+    using HomogeneousTerms = pairpotential::HomogeneousTerms;
+    const PairEnergy& pair_energy;                 //!< pair energy in the trial configuration
+    const PairEnergy* old_pair_energy = nullptr;   //!< pair energy in the old configuration
+    const ParticleVector& particles;               //!< particles in the trial configuration
+    const ParticleVector* old_particles = nullptr; //!< particles in the old configuration
+    HomogeneousTerms terms = {0.0, 0.0, 0.0};      //!< accumulated terms; trial configuration
+    HomogeneousTerms old_terms = {0.0, 0.0, 0.0};  //!< accumulated terms; old configuration
+
+    static inline void add(HomogeneousTerms& sum, const HomogeneousTerms& pair_terms)
+    {
+        std::transform(sum.begin(), sum.end(), pair_terms.begin(), sum.begin(), std::plus<>());
+    }
+
+  public:
+    HomogeneousTermsAccumulator(const PairEnergy& pair_energy, const ParticleVector& particles)
+        : EnergyAccumulatorBase(0.0)
+        , pair_energy(pair_energy)
+        , particles(particles)
+    {
+    }
+
+    HomogeneousTermsAccumulator(const PairEnergy& pair_energy, const PairEnergy& old_pair_energy,
+                                const ParticleVector& particles,
+                                const ParticleVector& old_particles)
+        : EnergyAccumulatorBase(0.0)
+        , pair_energy(pair_energy)
+        , old_pair_energy(&old_pair_energy)
+        , particles(particles)
+        , old_particles(&old_particles)
+    {
+    }
+
+    //! Only zero can be assigned as energies that are not split cannot be represented
+    inline HomogeneousTermsAccumulator& operator=(const double new_value) override
+    {
+        if (new_value != 0.0) {
+            throw std::logic_error("energy cannot be split into homogeneous terms");
+        }
+        clear();
+        return *this;
+    }
+
+    inline HomogeneousTermsAccumulator& operator+=(const double new_value) override
+    {
+        if (new_value != 0.0) {
+            throw std::logic_error("energy cannot be split into homogeneous terms");
+        }
+        return *this;
+    }
+
+    inline HomogeneousTermsAccumulator& operator+=(ParticlePair&& pair) override
+    {
+        const auto& a = pair.first.get();
+        const auto& b = pair.second.get();
+        add(terms, pair_energy.homogeneousTerms(a, b));
+        if (old_pair_energy != nullptr) {
+            const auto& old_a = (*old_particles)[std::addressof(a) - particles.data()];
+            const auto& old_b = (*old_particles)[std::addressof(b) - particles.data()];
+            add(old_terms, old_pair_energy->homogeneousTerms(old_a, old_b));
+        }
+        return *this;
+    }
+
+    void clear() override
+    {
+        terms.fill(0.0);
+        old_terms.fill(0.0);
+    }
+
+    explicit operator double() override { return std::accumulate(terms.begin(), terms.end(), 0.0); }
+
+    const HomogeneousTerms& homogeneousTerms() const { return terms; } //!< Trial configuration
+    const HomogeneousTerms& oldHomogeneousTerms() const { return old_terms; } //!< Old configuration
+};
+
+/**
+ * @brief Adds the force between each pair of particles to a force vector.
+ *
+ * The force vector is indexed as the particle vector and the pair forces are added with opposite
+ * signs to the two particles. The energy value is not used.
+ *
+ * @tparam PairEnergy  pair energy implementing a force(a, b) method for particles a and b
+ * @see Nonbonded::force
+ */
+template <RequirePairEnergy PairEnergy>
+class ForceAccumulator : public EnergyAccumulatorBase
+{
+  protected:
+    const PairEnergy& pair_energy;   //!< pair energy providing the pair force
+    const ParticleVector& particles; //!< particles referenced by the added pairs
+    PointVector& forces;             //!< destination force on each particle
+
+  public:
+    ForceAccumulator(const PairEnergy& pair_energy, const ParticleVector& particles,
+                     PointVector& forces)
+        : EnergyAccumulatorBase(0.0)
+        , pair_energy(pair_energy)
+        , particles(particles)
+        , forces(forces)
+    {
+    }
+
+    inline ForceAccumulator& operator=(const double new_value) override
+    {
+        value = new_value;
+        return *this;
+    }
+
+    inline ForceAccumulator& operator+=(const double new_value) override
+    {
+        value += new_value;
+        return *this;
+    }
+
+    inline ForceAccumulator& operator+=(ParticlePair&& pair) override
+    {
+        const auto& a = pair.first.get();
+        const auto& b = pair.second.get();
+        const Point force = pair_energy.force(a, b);
+        forces[std::addressof(a) - particles.data()] += force;
+        forces[std::addressof(b) - particles.data()] -= force;
+        return *this;
+    }
+};
+
+/**
+ * @brief Adds pair forces to a force vector by evaluating independent tasks on a thread pool.
+ *
+ * Tasks submitted by the pairing policy are evaluated by `evaluateTasks()`. Each thread adds to
+ * a private force buffer which is summed into the force vector at the end. The tasks are
+ * statically distributed over the threads, so that the result is reproducible for a given
+ * number of threads.
+ *
+ * @see ThreadPoolEnergyAccumulator
+ */
+template <RequirePairEnergy PairEnergy>
+class ThreadPoolForceAccumulator : public ForceAccumulator<PairEnergy>
+{
+  public:
+    using TaskAccumulator = ForceAccumulator<PairEnergy>;
+
+  private:
+    using Base = ForceAccumulator<PairEnergy>;
+    std::shared_ptr<ThreadPool> thread_pool;                  //!< serial if empty
+    std::vector<std::function<void(TaskAccumulator&)>> tasks; //!< submitted pairings
+    std::vector<PointVector> thread_forces;                   //!< force buffer of each thread
+    std::vector<ThreadPool::Task> pool_tasks;                 //!< one task per thread
+
+  public:
+    ThreadPoolForceAccumulator(const PairEnergy& pair_energy, const ParticleVector& particles,
+                               PointVector& forces, std::shared_ptr<ThreadPool> thread_pool)
+        : Base(pair_energy, particles, forces)
+        , thread_pool(std::move(thread_pool))
+    {
+    }
+
+    /**
+     * @brief Defers a pairing as a task
+     * @param pairing  function adding pairs to the `TaskAccumulator` passed as its argument
+     */
+    template <typename TPairing> void addTask(TPairing&& pairing)
+    {
+        tasks.emplace_back(std::forward<TPairing>(pairing));
+    }
+
+    void clear() override
+    {
+        Base::clear();
+        tasks.clear();
+    }
+
+    /**
+     * @brief Evaluates all submitted tasks and adds their forces to the force vector
+     */
+    void evaluateTasks()
+    {
+        if (tasks.empty()) {
+            return;
+        }
+        const auto number_of_threads = thread_pool ? thread_pool->size() : 1;
+        thread_forces.resize(number_of_threads);
+        pool_tasks.clear();
+        for (std::size_t thread = 0; thread < number_of_threads; ++thread) {
+            thread_forces[thread].assign(this->forces.size(), Point::Zero());
+            pool_tasks.emplace_back([this, thread, number_of_threads]() {
+                TaskAccumulator accumulator(this->pair_energy, this->particles,
+                                            thread_forces[thread]);
+                for (auto i = thread; i < tasks.size(); i += number_of_threads) {
+                    tasks[i](accumulator);
+                }
+            });
+        }
+        if (thread_pool) {
+            thread_pool->run(pool_tasks);
+        }
+        else {
+            std::for_each(pool_tasks.begin(), pool_tasks.end(), [](auto& task) { task(); });
+        }
+        for (const auto& buffer : thread_forces) {
+            std::transform(buffer.begin(), buffer.end(), this->forces.begin(),
+                           this->forces.begin(), std::plus<>());
+        }
+        tasks.clear();
+    }
+};
+
+template <RequirePairEnergy TPairEnergy>
+std::unique_ptr<EnergyAccumulatorBase>
+createEnergyAccumulator(const json& j, const TPairEnergy& pair_energy, double initial_value)
+{
+    std::unique_ptr<EnergyAccumulatorBase> accumulator;
+    const auto scheme = j.value("summation_policy", EnergyAccumulatorBase::Scheme::SERIAL);
+    if (scheme == EnergyAccumulatorBase::Scheme::THREADS) {
+        accumulator =
+            std::make_unique<ThreadPoolEnergyAccumulator<TPairEnergy>>(pair_energy, initial_value);
+        faunus_logger->debug("activated thread pool energy summation");
+    }
+    else if (scheme != EnergyAccumulatorBase::Scheme::SERIAL) {
+        accumulator =
+            std::make_unique<DelayedEnergyAccumulator<TPairEnergy>>(pair_energy, initial_value);
+        faunus_logger->debug("activated delayed energy summation");
+    }
+    else {
+        accumulator =
+            std::make_unique<InstantEnergyAccumulator<TPairEnergy>>(pair_energy, initial_value);
+        faunus_logger->debug("activated instant energy summation");
+    }
+    accumulator->from_json(j);
+    return accumulator;
+}
+
+/**
+ * @brief Determines if two groups are separated beyond the cutoff distance.
+ *
+ * The distance between centers of mass is considered. The cutoff distance can be specified
+ * independently for each group pair to override the default value.
+ *
+ * @see GroupPairingPolicy
+ */
+class GroupCutoff
+{
+    double default_cutoff_squared = pc::max_value;
+    PairMatrix<double>
+        cutoff_squared; //!< matrix with group-to-group cutoff distances squared in angstrom squared
+    Space::GeometryType& geometry; //!< geometry to compute the inter group distance with
+    bool has_finite_cutoff = false; //!< true if any group pair is subject to a cutoff
+    friend void from_json(const json&, GroupCutoff&);
+    friend void to_json(json&, const GroupCutoff&);
+    void setSingleCutoff(double cutoff);
+
+  public:
+    /**
+     * @brief Determines if two groups are separated beyond the cutoff distance.
+     * @return true if the group-to-group distance is beyond the cutoff distance, false otherwise
+     */
+    inline bool cut(const Group& group1, const Group& group2)
+    {
+        if (group1.isAtomic() || group2.isAtomic()) {
+            return false; // atomic groups have ill-defined mass centers
+        }
+        return geometry.sqdist(group1.mass_center, group2.mass_center) >=
+               cutoff_squared(group1.id, group2.id);
+    }
+
+    double getCutoff(size_t id1, size_t id2) const;
+
+    /**
+     * @brief Determines if any group pair may be cut, i.e., if cut() depends on group positions.
+     */
+    bool isEnabled() const { return has_finite_cutoff; }
+
+    /**
+     * @brief A functor alias for cut().
+     * @see cut()
+     */
+    template <typename... Args> inline auto operator()(Args&&... args)
+    {
+        return cut(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Sets the geometry.
+     * @param geometry  geometry to compute the inter group distance with
+     */
+    explicit GroupCutoff(Space::GeometryType& geometry);
+};
+
+void from_json(const json&, GroupCutoff&);
+void to_json(json&, const GroupCutoff&);
+
+/**
+ * @brief Particle pairing to calculate pairẃise interaction using particles' groups internally.
+ * Depending on the accumulator provided, raw particle pairs, energy sum, etc. can be obtained.
+ *
+ * Accumulator is used as the first argument in all methods. Accumulator shall overload '+='
+ * operator to accept a pair of particle references as used in particle2particle method.
+ *
+ * @remark Method arguments are generally not checked for correctness because of performance
+ * reasons.
+ *
+ * @tparam TCutoff  a cutoff scheme between groups
+ * @see InstantEnergyAccumulator, GroupCutoff
+ */
+template <typename TCutoff> class GroupPairingPolicy
+{
+  protected:
+    const Space& spc; //!< a space to operate on
+    Space& mutable_space; //!< This reference to space can be changed; used for particle arrays
+    TCutoff cut; //!< a cutoff functor that determines if energy between two groups can be ignored
+    const ParticleArrays* particle_arrays = nullptr; //!< mirror of `Space::particles` if enabled
+    static constexpr std::size_t pairs_per_task = 1024; //!< approximate task size; see `submit()`
+
+    inline std::size_t indexOf(const Particle& particle) const
+    {
+        return static_cast<std::size_t>(std::addressof(particle) - spc.particles.data());
+    }
+
+    /**
+     * @brief Determines if a particle is mirrored by the particle arrays
+     *
+     * Groups may also be formed from particles outside the space, e.g. in `AngularScan`, and
+     * those cannot be looked up in the mirror.
+     */
+    inline bool isMirrored(const Particle& particle) const
+    {
+        const auto size = std::min(spc.particles.size(), particle_arrays->size());
+        const std::less<const Particle*> less;
+        const auto* address = std::addressof(particle);
+        return !less(address, spc.particles.data()) && less(address, spc.particles.data() + size);
+    }
+
+  public:
+    /**
+     * @param spc
+     */
+    explicit GroupPairingPolicy(Space& spc)
+        : spc(spc)
+        , mutable_space(spc)
+        , cut(spc.geometry)
+    {
+    }
+
+    void from_json(const json& j)
+    {
+        Energy::from_json(j, cut);
+        if (j.value("soa", false)) {
+            if (spc.geometry.boundaryConditions().coordinates !=
+                Geometry::Coordinates::ORTHOGONAL) {
+                throw ConfigurationError("'soa' requires an orthogonal geometry");
+            }
+            particle_arrays = &mutable_space.enableParticleArrays();
+        }
+    }
+
+    void to_json(json& j) const
+    {
+        Energy::to_json(j, cut);
+        if (particle_arrays != nullptr) {
+            j["soa"] = true;
+        }
+    }
+
+    /**
+     * @brief Updates internal data structures to reflect the current state of the space.
+     *
+     * Only the optional particle arrays have a state. They are maintained by the space, but moves
+     * modify particles directly, so rows of the changed particles are refreshed here.
+     *
+     * @see Space::updateParticleArrays
+     */
+    void updateState(const Change& change)
+    {
+        if (particle_arrays != nullptr) {
+            mutable_space.updateParticleArrays(change);
+        }
+    }
+
+    /**
+     * @brief Determines if the same particle pairs are visited in any configuration with the same
+     * number of particles, i.e., if the pairing does not depend on particle positions.
+     */
+    bool isPositionIndependent() const { return !cut.isEnabled(); }
+
+    /**
+     * @brief Determines if the group-to-group cutoff between two groups does not depend on
+     * particle positions. Pair sums between the two groups are then additive over particles.
+     */
+    bool isCutPositionIndependent(const Group& group1, const Group& group2) const
+    {
+        return !cut.isEnabled() || group1.isAtomic() || group2.isAtomic();
+    }
+
+    /**
+     * @brief Add two interacting particles to the accumulator.
+     *
+     * Due to compiler optimization, the '+=' operator and this function itself may be inlined to
+     * significantly improve performance.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam T  an interacting particle
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param a  first particle
+     * @param b  second particle
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename T>
+    inline void particle2particle(TAccumulator& pair_accumulator, const T& a, const T& b) const
+    {
+        pair_accumulator += {std::cref(a), std::cref(b)};
+    }
+
+    /**
+     * @brief Evaluates a pairing immediately or, if supported by the accumulator, as a task.
+     *
+     * Tasks are summed later on, possibly in parallel; see `ThreadPoolEnergyAccumulator`.
+     *
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param pairing  function taking an accumulator as the only argument
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TPairing>
+    inline void submit(TAccumulator& pair_accumulator, TPairing&& pairing) const
+    {
+        if constexpr (RequireTaskAccumulator<TAccumulator>) {
+            pair_accumulator.addTask(std::forward<TPairing>(pairing));
+        }
+        else {
+            pairing(pair_accumulator);
+        }
+    }
+
+    /**
+     * @brief Add a particle interacting with a contiguous range of particles to the accumulator.
+     *
+     * If enabled and supported by the accumulator, the pairs are summed by a vectorizable kernel
+     * operating on the particle arrays. Otherwise each pair is added separately. A task
+     * accumulator receives the range split into tasks of at most `pairs_per_task` pairs.
+     *
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param particle  a particle not contained in the range
+     * @param first  first particle of the range
+     * @param last  end of the range
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename T, typename TIterator>
+    inline void particle2range(TAccumulator& pair_accumulator, const T& particle,
+                               const TIterator first, const TIterator last) const
+    {
+        if constexpr (RequireTaskAccumulator<TAccumulator>) {
+            // split long ranges into several tasks
+            constexpr auto max_chunk_size = static_cast<std::ptrdiff_t>(pairs_per_task);
+            for (auto chunk_first = first; chunk_first != last;) {
+                const auto chunk_size = std::min(max_chunk_size, std::distance(chunk_first, last));
+                const auto chunk_last = std::next(chunk_first, chunk_size);
+                pair_accumulator.addTask(
+                    [this, &particle, chunk_first, chunk_last](auto& accumulator) {
+                        particle2range(accumulator, particle, chunk_first, chunk_last);
+                    });
+                chunk_first = chunk_last;
+            }
+            return;
+        }
+        if (first == last) {
+            return;
+        }
+        if constexpr (RequireParticleArrayAccumulator<TAccumulator>) {
+            if (particle_arrays != nullptr && isMirrored(particle) && isMirrored(*first) &&
+                isMirrored(*std::prev(last))) {
+                const auto first_index = indexOf(*first);
+                pair_accumulator.addParticleRange(*particle_arrays, indexOf(particle), first_index,
+                                                  first_index + std::distance(first, last));
+                return;
+            }
+        }
+        std::for_each(first, last, [&](const auto& other) {
+            particle2particle(pair_accumulator, particle, other);
+        });
+    }
+
+    /**
+     * @brief All pairings within a group.
+     *
+     * All pair interaction within the group are accumulated. The pair exclusions defined in the
+     * molecule topology are honoured.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @param group
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group)
+    {
+        const auto& moldata = group.traits();
+        if (!moldata.rigid) {
+            const int group_size = group.size();
+            if (group.isAtomic()) {
+                for (int i = 0; i < group_size - 1; ++i) {
+                    particle2range(pair_accumulator, group[i], group.begin() + i + 1, group.end());
+                }
+                return;
+            }
+            submit(pair_accumulator, [this, &group, &moldata, group_size](auto& accumulator) {
+                for (int i = 0; i < group_size - 1; ++i) {
+                    moldata.forEachNonExcludedPartner(i, i + 1, group_size, [&](int j) {
+                        particle2particle(accumulator, group[i], group[j]);
+                    });
+                }
+            });
+        }
+    }
+
+    /**
      * @brief Pairings of a single particle within the group.
      *
-     * The pair exclusions defined in the molecule topology are honoured.
+     * The pair exclusions defined in the molecule topology are honoured.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group
+     * @param index  internal index of the selected particle within the group
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group, const std::size_t index)
+    {
+        const auto& moldata = group.traits();
+        if (!moldata.rigid) {
+            if (group.isAtomic()) {
+                // speed optimization: non-bonded interaction exclusions do not need to be checked
+                // for atomic groups
+                particle2range(pair_accumulator, group[index], group.begin(),
+                               group.begin() + index);
+                particle2range(pair_accumulator, group[index], group.begin() + index + 1,
+                               group.end());
+            }
+            else {
+                // molecular group
+                const auto i = static_cast<int>(index);
+                auto pair_with_index = [&](const int j) {
+                    particle2particle(pair_accumulator, group[i], group[j]);
+                };
+                moldata.forEachNonExcludedPartner(i, 0, static_cast<int>(group.size()),
+                                                  pair_with_index);
+            }
+        }
+    }
+
+    /**
+     * @brief Pairing in the group involving only the particles present in the index.
+     *
+     * Only such non-bonded pair interactions within the group are considered if at least one
+     * particle is present in the index. The pair exclusions defined in the molecule topology are
+     * honoured.
+     *
+     * For a particle i in the (sorted) index, all non-excluded particles j > i are paired, while
+     * particles j < i are paired only if absent from the index, i.e., only the gaps between the
+     * preceding runs of consecutive indices are visited. Hence a contiguous index as generated by
+     * pivot and crankshaft moves requires no index lookup at all.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @tparam TIndex
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group
+     * @param index  internal indices of particles within the group
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup, typename TIndex>
+    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group, const TIndex& index)
+    {
+        auto& moldata = group.traits();
+        if (!moldata.rigid) {
+            if (index.size() == 1) {
+                groupInternal(pair_accumulator, group, index[0]);
+            }
+            else {
+                const auto group_size = static_cast<int>(group.size());
+                auto pair_with = [&](const int i) {
+                    return [&, i](const int j) {
+                        particle2particle(pair_accumulator, group[i], group[j]);
+                    };
+                };
+                std::vector<std::pair<int, int>> gaps; // [first, last) of preceding static ranges
+                int gap_first = 0;
+                for (auto it = index.begin(); it != index.end(); ++it) {
+                    const auto i = static_cast<int>(*it);
+                    if (i > gap_first) {
+                        gaps.emplace_back(gap_first, i); // new run of consecutive indices
+                    }
+                    gap_first = i + 1;
+                    for (const auto [first, last] : gaps) { // static j < i
+                        moldata.forEachNonExcludedPartner(i, first, last, pair_with(i));
+                    }
+                    // all j > i, static or moved
+                    moldata.forEachNonExcludedPartner(i, i + 1, group_size, pair_with(i));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Complete cartesian pairing of particles in two groups.
+     *
+     * group1 × group2
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, no
+     * calculation is performed. The group intersection must be an empty set, i.e., no particle is
+     * included in both groups. This is not verified for performance reason.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group1
+     * @param group2
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void group2group(TAccumulator& pair_accumulator, const TGroup& group1, const TGroup& group2)
+    {
+        if (!cut(group1, group2)) {
+            if constexpr (RequireTaskAccumulator<TAccumulator>) {
+                if (group1.size() * group2.size() <= pairs_per_task) { // small groups: one task
+                    submit(pair_accumulator, [this, &group1, &group2](auto& accumulator) {
+                        group2group(accumulator, group1, group2);
+                    });
+                    return;
+                }
+            }
+            for (auto& particle1 : group1) {
+                particle2range(pair_accumulator, particle1, group2.begin(), group2.end());
+            }
+        }
+    }
+
+    /**
+     * @brief Cross pairing of particles in two groups. Only a cartesian subset of the complete
+     cartesian product is
+     * considered as the particles in the first group must be also present in the index. The aim is
+     to capture only
+     * interactions that involve changing (indexed) particles.
+     *
+     * ⊕group1 × group2, where ⊕ denotes a filter by an index
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, no
+     calculation is performed.
+     * The group intersection must be an empty set, i.e., no particle is included in both groups.
+     This is not verified
+     * for performance reason.
+
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     as references
+     *                       {T&, T&}
+     * @tparam TGroup
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group1
+     * @param group2
+     * @param index1  list of particle indices in group1 relative to the group beginning
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void group2group(TAccumulator& pair_accumulator, const TGroup& group1, const TGroup& group2,
+                     const std::vector<std::size_t>& index1)
+    {
+        if (!cut(group1, group2)) {
+            if constexpr (RequireTaskAccumulator<TAccumulator>) {
+                if (index1.size() * group2.size() <= pairs_per_task) { // small groups: one task
+                    // the index may be a temporary, hence copied
+                    submit(pair_accumulator, [this, &group1, &group2, index1](auto& accumulator) {
+                        group2group(accumulator, group1, group2, index1);
+                    });
+                    return;
+                }
+            }
+            for (auto particle1_ndx : index1) {
+                particle2range(pair_accumulator, *(group1.begin() + particle1_ndx),
+                               group2.begin(), group2.end());
+            }
+        }
+    }
+
+    /**
+     * @brief Cross pairing of particles in two groups. Only a non-cartesian subset of the complete
+     * cartesian product is considered as at least one particles in the pair must be also present in
+     * the respective index. The aim is to capture only interactions that involve changing (indexed)
+     * particles, i.e., to avoid pairs containing only non-indexed particles.
+     *
+     * (⊕group1 × ∁⊕group2) + (∁⊕group1 × ⊕group2) + (⊕group1 × ⊕group2) =
+     * = group1 × group2 − (∁⊕group2 × ∁⊕group2), where ⊕ denotes a filter by an index and ∁ a
+     * complement
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, no
+     * calculation is performed. The group intersection must be an empty set, i.e., no particle is
+     * included in both groups. This is not verified for performance reason.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group1
+     * @param group2
+     * @param index1  list of particle indices in group1 relative to the group beginning
+     * @param index2  list of particle indices in group2 relative to the group beginning
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void group2group(TAccumulator& pair_accumulator, const TGroup& group1, const TGroup& group2,
+                     const std::vector<std::size_t>& index1, const std::vector<std::size_t>& index2)
+    {
+        if (!cut(group1, group2)) {
+            if (!index2.empty()) {
+                // (∁⊕group1 × ⊕group2) + (⊕group1 × ⊕group2) = group1 × ⊕group2
+                group2group(pair_accumulator, group2, group1, index2);
+                // + (⊕group1 × ∁⊕group2)
+                auto index2_complement = indexComplement(group2.size(), index2);
+                for (auto particle1_ndx : index1) {
+                    for (auto particle2_ndx : index2_complement) {
+                        particle2particle(pair_accumulator, group2[particle2_ndx],
+                                          group1[particle1_ndx]);
+                    }
+                }
+            }
+            else if (!index1.empty()) {
+                // (⊕group1 × ∁⊕group2) + (⊕group1 × ⊕group2) = ⊕group1 × group2
+                group2group(pair_accumulator, group1, group2, index1);
+                // + (∁⊕group1 × ⊕group2) = Ø as ⊕group2 is empty
+            }
+            else {
+                // both indices empty hence nothing to do
+            }
+        }
+    }
+
+    /**
+     * @brief Complete cartesian pairing between particles in a group and a union of groups.
+     *
+     * group × (∪ groups)
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, the
+     * particle pairing between them is skipped. The internal energy of the group is not computed
+     * even if the group is also present in the union of groups.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @tparam TGroups
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group
+     * @param groups
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup, typename TGroups>
+    void group2groups(TAccumulator& pair_accumulator, const TGroup& group, const TGroups& groups)
+    {
+        for (auto& other_group : groups) {
+            if (&other_group != &group) {
+                group2group(pair_accumulator, group, other_group);
+            }
+        }
+    }
+
+    /**
+     * @brief Cross pairing of particles in a group and a union of groups. Only a cartesian subset
+     * of the complete cartesian product is considered as the particles of the first group must be
+     * also present in the index. The aim is to capture only interactions that involve changing
+     * (indexed) particles.
+     *
+     * ⊕group × (∪ groups), where ⊕ denotes a filter by an index
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, the
+     * particle pairing between them is skipped. The internal energy of the group is not computed
+     * even if the group is also present in the union of groups.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @tparam TGroups
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group
+     * @param group_index  groups as indices in Space::groups
+     * @param index  list of particle indices in the group relative to the group beginning
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup, typename TGroups>
+    void group2groups(TAccumulator& pair_accumulator, const TGroup& group,
+                      const TGroups& group_index, const std::vector<std::size_t>& index)
+    {
+        for (auto other_group_ndx : group_index) {
+            const auto& other_group = spc.groups[other_group_ndx];
+            if (&other_group != &group) {
+                group2group(pair_accumulator, group, other_group, index);
+            }
+        }
+    }
+
+    /**
+     * @brief Complete cartesian pairing between particles in a group and particles in other groups
+     * in space.
+     *
+     * group × (space ∖ group)
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, the
+     * particle pairing between them is skipped.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename Tgroup>
+    void group2all(TAccumulator& pair_accumulator, const Tgroup& group)
+    {
+        for (auto& other_group : spc.groups) {
+            if (&other_group != &group) {
+                group2group(pair_accumulator, group, other_group);
+            }
+        }
+    }
+
+    /**
+     * @brief Complete cartesian pairing between a single particle in a group and particles in other
+     * groups in space.
+     *
+     * ⊕group × (space ∖ group), where ⊕ denotes a filter by an index (here a single particle)
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, the
+     * particle pairing between them is skipped. This method is performance-optimized version of the
+     * multiple indices method.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @tparam TGroup
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group
+     * @param index  a particle index relative to the group beginning
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void group2all(TAccumulator& pair_accumulator, const TGroup& group, const int index)
+    {
+        const auto& particle = group[index];
+        for (auto& other_group : spc.groups) {
+            if (&other_group != &group) {                      // avoid self-interaction
+                if (!cut(other_group, group)) { // check g2g cut-off
+                    particle2range(pair_accumulator, particle, other_group.begin(),
+                                   other_group.end());
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Complete cartesian pairing between selected particles in a group and particles in
+     * other groups in space.
+     *
+     * ⊕group × (space ∖ group), where ⊕ denotes a filter by an index
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, the
+     * particle pairing between them is skipped.
+     *
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param group
+     * @param index  list of particle indices in the group relative to the group beginning
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename Tgroup>
+    void group2all(TAccumulator& pair_accumulator, const Tgroup& group,
+                   const std::vector<std::size_t>& index)
+    {
+        if (index.size() == 1) {
+            group2all(pair_accumulator, group, index[0]);
+        }
+        else {
+            for (auto& other_group : spc.groups) {
+                if (&other_group != &group) {
+                    group2group(pair_accumulator, group, other_group, index);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Cross pairing of particles among a union of groups. No internal pairs within any group
+     * are considered.
+     *
+     * If the distance between any two groups is greater or equal to the group cutoff distance, the
+     * particle pairing between them is skipped.
      *
      * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
      * as references {T&, T&}
-     * @tparam TGroup
+     * @tparam T
      * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group
-     * @param index  internal index of the selected particle within the group
+     * @param group_index  list of groups
      */
-    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
-    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group, const std::size_t index)
+    template <RequireEnergyAccumulator TAccumulator, typename T>
+    void groups2self(TAccumulator& pair_accumulator, const T& group_index)
     {
-        const auto& moldata = group.traits();
-        if (!moldata.rigid) {
-            if (group.isAtomic()) {
-                // speed optimization: non-bonded interaction exclusions do not need to be checked
-                // for atomic groups
-                for (int i = 0; i < index; ++i) {
-                    particle2particle(pair_accumulator, group[index], group[i]);
-                }
-                for (int i = index + 1; i < group.size(); ++i) {
-                    particle2particle(pair_accumulator, group[index], group[i]);
-                }
-            }
-            else {
-                // molecular group
-                for (int i = 0; i < index; ++i) {
-                    if (!moldata.isPairExcluded(index, i)) {
-                        particle2particle(pair_accumulator, group[index], group[i]);
-                    }
-                }
-                for (int i = index + 1; i < group.size(); ++i) {
-                    if (!moldata.isPairExcluded(index, i)) {
-                        particle2particle(pair_accumulator, group[index], group[i]);
-                    }
-                }
+        for (auto group1_ndx_it = group_index.begin(); group1_ndx_it < group_index.end();
+             ++group1_ndx_it) {
+            // no such move exists that the internal energy has to be recalculated
+            // groupInternal(pair_accumulator, spc.groups[*group1_ndx_it]);
+            for (auto group2_ndx_it = std::next(group1_ndx_it); group2_ndx_it < group_index.end();
+                 group2_ndx_it++) {
+                group2group(pair_accumulator, spc.groups[*group1_ndx_it],
+                            spc.groups[*group2_ndx_it]);
             }
         }
     }
 
     /**
-     * @brief Pairing in the group involving only the particles present in the index.
+     * @brief Cross pairing of particles between a union of groups and its complement in space.
      *
-     * Only such non-bonded pair interactions within the group are considered if at least one
-     * particle is present in the index. The pair exclusions defined in the molecule topology are
-     * honoured.
+     * If the distance between any two groups is greater or equal to the group cutoff distance, the
+     * particle pairing between them is skipped.
      *
      * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
      * as references {T&, T&}
-     * @tparam TGroup
-     * @tparam TIndex
+     * @tparam T
      * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group
-     * @param index  internal indices of particles within the group
+     * @param group_index  list of groups
      */
-    template <RequireEnergyAccumulator TAccumulator, typename TGroup, typename TIndex>
-    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group, const TIndex& index)
+    template <RequireEnergyAccumulator TAccumulator, typename T>
+    void groups2all(TAccumulator& pair_accumulator, const T& group_index)
     {
-        auto& moldata = group.traits();
-        if (!moldata.rigid) {
-            if (index.size() == 1) {
-                groupInternal(pair_accumulator, group, index[0]);
-            }
-            else {
-                // TODO investigate overhead of `index_complement` filtering;
-                // TODO perhaps allow different strategies based on the index-size/group-size ratio
-                auto index_complement = indexComplement(group.size(), index);
-                // moved <-> static
-                for (int i : index) {
-                    for (int j : index_complement) {
-                        if (!moldata.isPairExcluded(i, j)) {
-                            particle2particle(pair_accumulator, group[i], group[j]);
-                        }
-                    }
-                }
-                // moved <-> moved
-                for (auto i_it = index.begin(); i_it < index.end(); ++i_it) {
-                    for (auto j_it = std::next(i_it); j_it < index.end(); ++j_it) {
-                        if (!moldata.isPairExcluded(*i_it, *j_it)) {
-                            particle2particle(pair_accumulator, group[*i_it], group[*j_it]);
-                        }
-                    }
-                }
+        groups2self(pair_accumulator, group_index);
+        auto index_complement = indexComplement(spc.groups.size(), group_index);
+        for (auto group1_ndx : group_index) {
+            for (auto group2_ndx : index_complement) {
+                group2group(pair_accumulator, spc.groups[group1_ndx], spc.groups[group2_ndx]);
             }
         }
     }
 
     /**
-     * @brief Complete cartesian pairing of particles in two groups.
+     * @brief Cross pairing between all particles in the space.
      *
-     * group1 × group2
+     * If the distance between particles' groups is greater or equal to the group cutoff distance,
+     * no calculation is performed.
      *
-     * If the distance between the groups is greater or equal to the group cutoff distance, no
-     * calculation is performed. The group intersection must be an empty set, i.e., no particle is
-     * included in both groups. This is not verified for performance reason.
+     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
+     * as references {T&, T&}
+     * @param pair_accumulator  accumulator of interacting pairs of particles
+     */
+    template <RequireEnergyAccumulator TAccumulator> void all(TAccumulator& pair_accumulator)
+    {
+        for (auto group_it = spc.groups.begin(); group_it < spc.groups.end(); ++group_it) {
+            groupInternal(pair_accumulator, *group_it);
+            for (auto other_group_it = std::next(group_it); other_group_it < spc.groups.end();
+                 other_group_it++) {
+                group2group(pair_accumulator, *group_it, *other_group_it);
+            }
+        }
+    }
+
+    /**
+     * @brief Cross pairing between all particles in the space.
+     *
+     * If the distance between particles' groups is greater or equal to the group cutoff distance,
+     * no calculation is performed.
      *
      * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
      * as references {T&, T&}
-     * @tparam TGroup
+     * @tparam TCondition  a function returning bool and having a group as an argument
      * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group1
-     * @param group2
+     * @param condition  a group filter if internal energy of the group shall be added
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename TCondition>
+    void all(TAccumulator& pair_accumulator, TCondition condition)
+    {
+        for (auto group_it = spc.groups.begin(); group_it < spc.groups.end(); ++group_it) {
+            if (condition(*group_it)) {
+                groupInternal(pair_accumulator, *group_it);
+            }
+            for (auto other_group_it = std::next(group_it); other_group_it < spc.groups.end();
+                 other_group_it++) {
+                group2group(pair_accumulator, *group_it, *other_group_it);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Spatial cell list of particle indices hiding the actual grid and container types.
+ *
+ * Positions are given in the simulation cell frame, i.e., centered at the origin. Only fully
+ * periodic or fully non-periodic geometries are supported. Particles outside of a non-periodic
+ * grid are not stored.
+ *
+ * @see CellListPairingPolicy
+ */
+class ParticleCellList
+{
+  public:
+    using index_type = std::size_t;
+    using Members = std::vector<index_type>;
+    virtual ~ParticleCellList() = default;
+    virtual void insertOrUpdate(index_type index, const Point& position) = 0; //!< Add or move
+    virtual void remove(index_type index) = 0; //!< Remove particle if present
+
+    /**
+     * @brief Collects members of cells neighbouring the given position, including its own cell.
+     *
+     * Each cell is collected at most once, even for small periodic grids.
+     *
+     * @param position  position in the simulation cell
+     * @param cells  output buffer; pointers are appended and valid until the next modification
+     */
+    virtual void neighbourCells(const Point& position, std::vector<const Members*>& cells) = 0;
+
+    /**
+     * @brief Creates an empty cell list matching the boundary conditions of the geometry
+     * @param geometry  geometry to take the box dimensions and periodicity from
+     * @param cell_length  minimal length of the cell edge
+     * @param dense  dense (vector based) or sparse (map based) cell container
+     * @throw ConfigurationError  if the geometry is only partially periodic
+     */
+    static std::unique_ptr<ParticleCellList> create(const Space::GeometryType& geometry,
+                                                    double cell_length, bool dense = true);
+};
+
+/**
+ * @brief Neighbour search for CellListPairingPolicy looking up the surrounding cells directly.
+ *
+ * Configured by the `celllist` keyword; the cell length equals the cutoff distance.
+ */
+class CellListNeighbours
+{
+  public:
+    using index_type = ParticleCellList::index_type;
+
+  protected:
+    const Space& spc;
+    double cutoff_squared = 0.0; //!< squared particle-particle cutoff distance
+    bool dense = true;           //!< dense or sparse cell container
+    std::unique_ptr<ParticleCellList> cell_list;
+    std::vector<const ParticleCellList::Members*> neighbour_cells; //!< buffer of neighbour cells
+
+  public:
+    explicit CellListNeighbours(const Space& spc);
+    void from_json(const json& j);
+    void to_json(json& j) const;
+    double cutoffSquared() const { return cutoff_squared; }
+    void reset();                      //!< Empty structure and adapt it to the current geometry
+    void insertOrUpdate(index_type i); //!< Add or move particle to its current position
+    void remove(index_type i);         //!< Remove particle if present
+
+    /**
+     * @brief Calls `function(j)` for every particle j within the cutoff distance of the particle i
+     * @param i  absolute index of the particle
+     */
+    template <typename TFunction> void forEachNeighbour(const index_type i, TFunction&& function)
+    {
+        const auto& position = spc.particles[i].pos;
+        neighbour_cells.clear();
+        cell_list->neighbourCells(position, neighbour_cells);
+        for (const auto* members : neighbour_cells) {
+            for (const auto j : *members) {
+                if (j != i &&
+                    spc.geometry.sqdist(position, spc.particles[j].pos) < cutoff_squared) {
+                    function(j);
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief Neighbour search for CellListPairingPolicy using Verlet lists with a skin.
+ *
+ * Each particle keeps a list of neighbours found within `cutoff + skin` from its reference
+ * position, i.e., the position at the time its list was built. A list is rebuilt only when the
+ * particle moves more than half the skin from the reference position; other particles are merely
+ * updated in the lists of the offender. As the lists are symmetric and the candidate pairs are
+ * selected using the reference positions of both particles, any pair within the cutoff is always
+ * present in the lists. Configured by the `verlet` keyword.
+ */
+class VerletListNeighbours
+{
+  public:
+    using index_type = ParticleCellList::index_type;
+
+  private:
+    const Space& spc;
+    double cutoff_squared = 0.0;           //!< squared particle-particle cutoff distance
+    double skin = 0.0;                     //!< Verlet skin thickness
+    double list_cutoff_squared = 0.0;      //!< squared cutoff including the skin
+    double max_displacement_squared = 0.0; //!< squared displacement triggering a list rebuild
+    bool dense = true;                     //!< dense or sparse cell container
+    std::unique_ptr<ParticleCellList> cell_list; //!< reference positions for building lists
+    std::vector<const ParticleCellList::Members*> neighbour_cells; //!< buffer of neighbour cells
+    std::vector<std::vector<index_type>> neighbours;               //!< Verlet list of each particle
+    PointVector reference_positions; //!< positions at the time the lists were built
+    std::vector<bool> is_listed;     //!< particle is present in the Verlet lists
+    std::size_t list_updates = 0;    //!< number of individual list rebuilds (statistics)
+
+  public:
+    explicit VerletListNeighbours(const Space& spc);
+    void from_json(const json& j);
+    void to_json(json& j) const;
+    double cutoffSquared() const { return cutoff_squared; }
+    void reset();                       //!< Empty the lists and adapt them to the current geometry
+    void insertOrUpdate(index_type i);  //!< Rebuild the list of particle if displaced too much
+    void remove(index_type i);          //!< Remove particle from all lists if present
+
+    /**
+     * @brief Calls `function(j)` for every particle j within the cutoff distance of the particle i
+     * @param i  absolute index of the particle
+     */
+    template <typename TFunction> void forEachNeighbour(const index_type i, TFunction&& function)
+    {
+        const auto& position = spc.particles[i].pos;
+        for (const auto j : neighbours[i]) {
+            if (spc.geometry.sqdist(position, spc.particles[j].pos) < cutoff_squared) {
+                function(j);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Particle pairing based on a spatial neighbour search.
+ *
+ * Instead of looping over all particles in all other groups, only particles in the neighbouring
+ * cells (or in the Verlet lists) are considered. Hence the cost of a single particle move does not
+ * depend on the system size. Only pairs closer than a spherical `cutoff` are accumulated and the
+ * pair potential shall thus vanish at the cutoff distance. The group-to-group cutoff, the pair
+ * exclusions and the rigid molecules are honoured the same way as in GroupPairingPolicy.
+ *
+ * The neighbour search is synchronized with the space by updateState() before every accumulation
+ * and after every sync. Particles rebinned during the last update are always rebinned again, so
+ * that temporary perturbations of the space, e.g., by analysis, are healed automatically. Pairings
+ * of two explicitly given groups are evaluated directly without the neighbour search, as these are
+ * also used on perturbed configurations without any change being announced.
+ *
+ * @tparam TCutoff  a cutoff scheme between groups
+ * @tparam TNeighbours  neighbour search, i.e., CellListNeighbours or VerletListNeighbours
+ * @see GroupPairingPolicy, ParticleCellList
+ */
+template <typename TCutoff, typename TNeighbours = CellListNeighbours>
+class CellListPairingPolicy : public GroupPairingPolicy<TCutoff>
+{
+    using Base = GroupPairingPolicy<TCutoff>;
+    using index_type = typename TNeighbours::index_type;
+    using Base::cut;
+    using Base::spc;
+
+    TNeighbours neighbours;                          //!< neighbour search
+    bool is_built = false;                           //!< neighbour search has been initialized
+    std::vector<index_type> group_of_particle;       //!< group index of each particle
+    std::vector<index_type> first_particle_of_group; //!< first particle index of each group
+    std::vector<index_type> touched;                 //!< particles rebinned during last update
+    Point box_length = Point::Zero();                //!< box dimensions at the last rebuild
+
+    inline index_type indexOf(const Particle& particle) const
+    {
+        return static_cast<index_type>(std::addressof(particle) - spc.particles.data());
+    }
+
+    inline index_type indexOf(const Space::GroupType& group) const
+    {
+        return static_cast<index_type>(std::addressof(group) - spc.groups.data());
+    }
+
+    inline const Space::GroupType& groupOf(const index_type particle_index) const
+    {
+        return spc.groups[group_of_particle[particle_index]];
+    }
+
+    /**
+     * @brief Checks if a pair of particles from the same group interacts, i.e., is not excluded.
+     * @param group  group of both particles
+     * @param i  absolute index of the first particle
+     * @param j  absolute index of the second particle
+     */
+    inline bool isInternalPair(const Space::GroupType& group, const index_type i,
+                               const index_type j) const
+    {
+        if (group.isAtomic()) {
+            return true;
+        }
+        const auto first = first_particle_of_group[group_of_particle[i]];
+        return !group.traits().isPairExcluded(static_cast<int>(i - first),
+                                              static_cast<int>(j - first));
+    }
+
+    //! Calls `function(j)` for every particle j within the cutoff distance of the particle i
+    template <typename TFunction>
+    inline void forEachNeighbour(const index_type i, TFunction&& function)
+    {
+        neighbours.forEachNeighbour(i, std::forward<TFunction>(function));
+    }
+
+    /**
+     * @brief Inserts, moves or removes a particle depending on its activity
+     */
+    void rebin(const index_type i)
+    {
+        const auto group_index = group_of_particle[i];
+        if (i - first_particle_of_group[group_index] < spc.groups[group_index].size()) {
+            neighbours.insertOrUpdate(i);
+        }
+        else {
+            neighbours.remove(i);
+        }
+    }
+
+    /**
+     * @brief Creates the neighbour search from scratch and inserts all active particles
+     */
+    void rebuild()
+    {
+        neighbours.reset();
+        is_built = true;
+        box_length = spc.geometry.getLength();
+        group_of_particle.resize(spc.particles.size());
+        first_particle_of_group.clear();
+        touched.clear();
+        for (index_type group_index = 0; group_index < spc.groups.size(); ++group_index) {
+            const auto& group = spc.groups[group_index];
+            const auto first = spc.getFirstParticleIndex(group);
+            first_particle_of_group.push_back(first);
+            std::fill_n(std::next(group_of_particle.begin(), first), group.capacity(),
+                        group_index);
+            for (index_type i = first; i < first + group.size(); ++i) {
+                neighbours.insertOrUpdate(i);
+            }
+        }
+    }
+
+  public:
+    explicit CellListPairingPolicy(Space& spc)
+        : Base(spc)
+        , neighbours(spc)
+    {
+    }
+
+    void from_json(const json& j)
+    {
+        Base::from_json(j);
+        neighbours.from_json(j);
+    }
+
+    void to_json(json& j) const
+    {
+        Base::to_json(j);
+        neighbours.to_json(j);
+    }
+
+    /**
+     * @brief The visited pairs always depend on particle positions.
+     * @see GroupPairingPolicy::isPositionIndependent
+     */
+    bool isPositionIndependent() const { return false; }
+
+    /**
+     * @brief Updates the neighbour search to reflect the current state of the space.
+     *
+     * The neighbour search is rebuilt if everything or the volume has changed. Otherwise
+     * particles of the previous update and particles of the current change are rebinned. All
+     * particles of a changed group are rebinned on matter changes as deactivation may swap
+     * unlisted particles.
+     *
+     * @param change  the change the space has undergone
+     */
+    void updateState(const Change& change)
+    {
+        if (!is_built || change.everything || change.volume_change ||
+            first_particle_of_group.size() != spc.groups.size() ||
+            !box_length.isApprox(spc.geometry.getLength())) {
+            rebuild();
+            return;
+        }
+        std::ranges::for_each(touched, [&](auto i) { rebin(i); });
+        touched.clear();
+        for (const auto& group_change : change.groups) {
+            const auto& group = spc.groups.at(group_change.group_index);
+            const auto first = first_particle_of_group[group_change.group_index];
+            if (change.matter_change || group_change.all ||
+                group_change.relative_atom_indices.empty()) {
+                for (index_type i = first; i < first + group.capacity(); ++i) {
+                    touched.push_back(i);
+                }
+            }
+            else {
+                for (const auto relative_index : group_change.relative_atom_indices) {
+                    touched.push_back(first + relative_index);
+                }
+            }
+        }
+        std::ranges::for_each(touched, [&](auto i) { rebin(i); });
+    }
+
+    /**
+     * @brief Add two interacting particles to the accumulator if within the cutoff distance.
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename T>
+    inline void particle2particle(TAccumulator& pair_accumulator, const T& a, const T& b) const
+    {
+        if (spc.geometry.sqdist(a.pos, b.pos) < neighbours.cutoffSquared()) {
+            Base::particle2particle(pair_accumulator, a, b);
+        }
+    }
+
+    /**
+     * @brief All pairings within a group.
+     * @see GroupPairingPolicy::groupInternal
      */
     template <RequireEnergyAccumulator TAccumulator, typename TGroup>
-    void group2group(TAccumulator& pair_accumulator, const TGroup& group1, const TGroup& group2)
+    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group)
     {
-        if (!cut(group1, group2)) {
-            for (auto& particle1 : group1) {
-                for (auto& particle2 : group2) {
-                    particle2particle(pair_accumulator, particle1, particle2);
-                }
+        if (!group.traits().rigid) {
+            const auto group_index = indexOf(group);
+            const auto first = first_particle_of_group[group_index];
+            for (index_type i = first; i < first + group.size(); ++i) {
+                forEachNeighbour(i, [&](const auto j) {
+                    if (j > i && group_of_particle[j] == group_index &&
+                        isInternalPair(group, i, j)) {
+                        Base::particle2particle(pair_accumulator, spc.particles[i],
+                                                spc.particles[j]);
+                    }
+                });
             }
         }
     }
 
     /**
-     * @brief Cross pairing of particles in two groups. Only a cartesian subset of the complete
-     cartesian product is
-     * considered as the particles in the first group must be also present in the index. The aim is
-     to capture only
-     * interactions that involve changing (indexed) particles.
-     *
-     * ⊕group1 × group2, where ⊕ denotes a filter by an index
-     *
-     * If the distance between the groups is greater or equal to the group cutoff distance, no
-     calculation is performed.
-     * The group intersection must be an empty set, i.e., no particle is included in both groups.
-     This is not verified
-     * for performance reason.
-
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     as references
-     *                       {T&, T&}
-     * @tparam TGroup
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group1
-     * @param group2
-     * @param index1  list of particle indices in group1 relative to the group beginning
+     * @brief Pairings of a single particle within the group.
+     * @see GroupPairingPolicy::groupInternal
      */
     template <RequireEnergyAccumulator TAccumulator, typename TGroup>
-    void group2group(TAccumulator& pair_accumulator, const TGroup& group1, const TGroup& group2,
-                     const std::vector<std::size_t>& index1)
+    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group, const std::size_t index)
     {
-        if (!cut(group1, group2)) {
-            for (auto particle1_ndx : index1) {
-                for (auto& particle2 : group2) {
-                    particle2particle(pair_accumulator, *(group1.begin() + particle1_ndx),
-                                      particle2);
+        if (!group.traits().rigid) {
+            const auto group_index = indexOf(group);
+            const auto i = first_particle_of_group[group_index] + index;
+            forEachNeighbour(i, [&](const auto j) {
+                if (group_of_particle[j] == group_index && isInternalPair(group, i, j)) {
+                    Base::particle2particle(pair_accumulator, spc.particles[i], spc.particles[j]);
                 }
-            }
+            });
         }
     }
 
     /**
-     * @brief Cross pairing of particles in two groups. Only a non-cartesian subset of the complete
-     * cartesian product is considered as at least one particles in the pair must be also present in
-     * the respective index. The aim is to capture only interactions that involve changing (indexed)
-     * particles, i.e., to avoid pairs containing only non-indexed particles.
-     *
-     * (⊕group1 × ∁⊕group2) + (∁⊕group1 × ⊕group2) + (⊕group1 × ⊕group2) =
-     * = group1 × group2 − (∁⊕group2 × ∁⊕group2), where ⊕ denotes a filter by an index and ∁ a
-     * complement
-     *
-     * If the distance between the groups is greater or equal to the group cutoff distance, no
-     * calculation is performed. The group intersection must be an empty set, i.e., no particle is
-     * included in both groups. This is not verified for performance reason.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam TGroup
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group1
-     * @param group2
-     * @param index1  list of particle indices in group1 relative to the group beginning
-     * @param index2  list of particle indices in group2 relative to the group beginning
+     * @brief Pairing in the group involving only the particles present in the (sorted) index.
+     * @see GroupPairingPolicy::groupInternal
      */
-    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
-    void group2group(TAccumulator& pair_accumulator, const TGroup& group1, const TGroup& group2,
-                     const std::vector<std::size_t>& index1, const std::vector<std::size_t>& index2)
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup, typename TIndex>
+    void groupInternal(TAccumulator& pair_accumulator, const TGroup& group, const TIndex& index)
     {
-        if (!cut(group1, group2)) {
-            if (!index2.empty()) {
-                // (∁⊕group1 × ⊕group2) + (⊕group1 × ⊕group2) = group1 × ⊕group2
-                group2group(pair_accumulator, group2, group1, index2);
-                // + (⊕group1 × ∁⊕group2)
-                auto index2_complement = indexComplement(group2.size(), index2);
-                for (auto particle1_ndx : index1) {
-                    for (auto particle2_ndx : index2_complement) {
-                        particle2particle(pair_accumulator, group2[particle2_ndx],
-                                          group1[particle1_ndx]);
+        if (!group.traits().rigid) {
+            const auto group_index = indexOf(group);
+            const auto first = first_particle_of_group[group_index];
+            for (const auto relative_index : index) {
+                const index_type i = first + relative_index;
+                forEachNeighbour(i, [&](const auto j) {
+                    if (group_of_particle[j] == group_index &&
+                        (j > i || !std::ranges::binary_search(index, j - first)) &&
+                        isInternalPair(group, i, j)) {
+                        Base::particle2particle(pair_accumulator, spc.particles[i],
+                                                spc.particles[j]);
                     }
-                }
-            }
-            else if (!index1.empty()) {
-                // (⊕group1 × ∁⊕group2) + (⊕group1 × ⊕group2) = ⊕group1 × group2
-                group2group(pair_accumulator, group1, group2, index1);
-                // + (∁⊕group1 × ⊕group2) = Ø as ⊕group2 is empty
-            }
-            else {
-                // both indices empty hence nothing to do
+                });
             }
         }
     }
 
     /**
-     * @brief Complete cartesian pairing between particles in a group and a union of groups.
-     *
-     * group × (∪ groups)
-     *
-     * If the distance between the groups is greater or equal to the group cutoff distance, the
-     * particle pairing between them is skipped. The internal energy of the group is not computed
-     * even if the group is also present in the union of groups.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam TGroup
-     * @tparam TGroups
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group
-     * @param groups
+     * @brief Complete cartesian pairing of particles in two groups evaluated without the cell list.
+     * @see GroupPairingPolicy::group2group
      */
-    template <RequireEnergyAccumulator TAccumulator, typename TGroup, typename TGroups>
-    void group2groups(TAccumulator& pair_accumulator, const TGroup& group, const TGroups& groups)
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void group2group(TAccumulator& pair_accumulator, const TGroup& group1, const TGroup& group2)
     {
-        for (auto& other_group : groups) {
-            if (&other_group != &group) {
-                group2group(pair_accumulator, group, other_group);
+        if (!cut(group1, group2)) {
+            for (auto& particle1 : group1) {
+                for (auto& particle2 : group2) {
+                    particle2particle(pair_accumulator, particle1, particle2);
+                }
             }
         }
     }
 
     /**
-     * @brief Cross pairing of particles in a group and a union of groups. Only a cartesian subset
-     * of the complete cartesian product is considered as the particles of the first group must be
-     * also present in the index. The aim is to capture only interactions that involve changing
-     * (indexed) particles.
-     *
-     * ⊕group × (∪ groups), where ⊕ denotes a filter by an index
-     *
-     * If the distance between the groups is greater or equal to the group cutoff distance, the
-     * particle pairing between them is skipped. The internal energy of the group is not computed
-     * even if the group is also present in the union of groups.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam TGroup
-     * @tparam TGroups
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group
-     * @param group_index  groups as indices in Space::groups
-     * @param index  list of particle indices in the group relative to the group beginning
+     * @brief Cross pairing of particles in two groups where at least one particle of the pair is
+     * present in the respective index. Evaluated without the cell list.
+     * @see GroupPairingPolicy::group2group
      */
-    template <RequireEnergyAccumulator TAccumulator, typename TGroup, typename TGroups>
-    void group2groups(TAccumulator& pair_accumulator, const TGroup& group,
-                      const TGroups& group_index, const std::vector<std::size_t>& index)
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void group2group(TAccumulator& pair_accumulator, const TGroup& group1, const TGroup& group2,
+                     const std::vector<std::size_t>& index1, const std::vector<std::size_t>& index2)
     {
-        for (auto other_group_ndx : group_index) {
-            const auto& other_group = spc.groups[other_group_ndx];
-            if (&other_group != &group) {
-                group2group(pair_accumulator, group, other_group, index);
+        if (!cut(group1, group2)) {
+            for (const auto particle1_ndx : index1) {
+                for (const auto& particle2 : group2) {
+                    particle2particle(pair_accumulator, group1[particle1_ndx], particle2);
+                }
+            }
+            const auto index1_complement = indexComplement(group1.size(), index1);
+            for (const auto particle2_ndx : index2) {
+                for (const auto particle1_ndx : index1_complement) {
+                    particle2particle(pair_accumulator, group2[particle2_ndx],
+                                      group1[particle1_ndx]);
+                }
             }
         }
     }
 
     /**
-     * @brief Complete cartesian pairing between particles in a group and particles in other groups
-     * in space.
-     *
-     * group × (space ∖ group)
-     *
-     * If the distance between the groups is greater or equal to the group cutoff distance, the
-     * particle pairing between them is skipped.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam TGroup
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group
+     * @brief Cross pairing of indexed particles in a group and particles of the listed groups.
+     * @param group_index  sorted indices of other groups in Space::groups
+     * @see GroupPairingPolicy::group2groups
      */
-    template <RequireEnergyAccumulator TAccumulator, typename Tgroup>
-    void group2all(TAccumulator& pair_accumulator, const Tgroup& group)
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup, typename TGroups>
+    void group2groups(TAccumulator& pair_accumulator, const TGroup& group,
+                      const TGroups& group_index, const std::vector<std::size_t>& index)
     {
-        for (auto& other_group : spc.groups) {
-            if (&other_group != &group) {
-                group2group(pair_accumulator, group, other_group);
-            }
+        const auto this_group_index = indexOf(group);
+        const auto first = first_particle_of_group[this_group_index];
+        for (const auto relative_index : index) {
+            const index_type i = first + relative_index;
+            forEachNeighbour(i, [&](const auto j) {
+                const auto other_group_index = group_of_particle[j];
+                if (other_group_index != this_group_index &&
+                    std::ranges::binary_search(group_index, other_group_index) &&
+                    !cut(groupOf(j), group)) {
+                    Base::particle2particle(pair_accumulator, spc.particles[i], spc.particles[j]);
+                }
+            });
         }
     }
 
     /**
-     * @brief Complete cartesian pairing between a single particle in a group and particles in other
-     * groups in space.
-     *
-     * ⊕group × (space ∖ group), where ⊕ denotes a filter by an index (here a single particle)
-     *
-     * If the distance between the groups is greater or equal to the group cutoff distance, the
-     * particle pairing between them is skipped. This method is performance-optimized version of the
-     * multiple indices method.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam TGroup
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group
-     * @param index  a particle index relative to the group beginning
+     * @brief Pairing between a single particle in a group and particles in other groups.
+     * @see GroupPairingPolicy::group2all
      */
     template <RequireEnergyAccumulator TAccumulator, typename TGroup>
     void group2all(TAccumulator& pair_accumulator, const TGroup& group, const int index)
     {
-        const auto& particle = group[index];
-        for (auto& other_group : spc.groups) {
-            if (&other_group != &group) {                      // avoid self-interaction
-                if (!cut(other_group, group)) {                // check g2g cut-off
-                    for (auto& other_particle : other_group) { // loop over particles in other group
-                        particle2particle(pair_accumulator, particle, other_particle);
-                    }
-                }
+        const auto group_index = indexOf(group);
+        const index_type i = first_particle_of_group[group_index] + index;
+        forEachNeighbour(i, [&](const auto j) {
+            if (group_of_particle[j] != group_index && !cut(groupOf(j), group)) {
+                Base::particle2particle(pair_accumulator, spc.particles[i], spc.particles[j]);
             }
-        }
+        });
     }
 
     /**
-     * @brief Complete cartesian pairing between selected particles in a group and particles in
-     * other groups in space.
-     *
-     * ⊕group × (space ∖ group), where ⊕ denotes a filter by an index
-     *
-     * If the distance between the groups is greater or equal to the group cutoff distance, the
-     * particle pairing between them is skipped.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group
-     * @param index  list of particle indices in the group relative to the group beginning
+     * @brief Pairing between all particles in a group and particles in other groups.
+     * @see GroupPairingPolicy::group2all
      */
-    template <RequireEnergyAccumulator TAccumulator, typename Tgroup>
-    void group2all(TAccumulator& pair_accumulator, const Tgroup& group,
-                   const std::vector<std::size_t>& index)
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void group2all(TAccumulator& pair_accumulator, const TGroup& group)
     {
-        if (index.size() == 1) {
-            group2all(pair_accumulator, group, index[0]);
-        }
-        else {
-            for (auto& other_group : spc.groups) {
-                if (&other_group != &group) {
-                    group2group(pair_accumulator, group, other_group, index);
-                }
-            }
+        for (std::size_t index = 0; index < group.size(); ++index) {
+            group2all(pair_accumulator, group, static_cast<int>(index));
         }
     }
 
     /**
-     * @brief Cross pairing of particles among a union of groups. No internal pairs within any group
-     * are considered.
-     *
-     * If the distance between any two groups is greater or equal to the group cutoff distance, the
-     * particle pairing between them is skipped.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam T
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group_index  list of groups
+     * @brief Pairing between selected particles in a group and particles in other groups.
+     * @see GroupPairingPolicy::group2all
      */
-    template <RequireEnergyAccumulator TAccumulator, typename T>
-    void groups2self(TAccumulator& pair_accumulator, const T& group_index)
+    template <RequireEnergyAccumulator TAccumulator, typename TGroup>
+    void group2all(TAccumulator& pair_accumulator, const TGroup& group,
+                   const std::vector<std::size_t>& index)
     {
-        for (auto group1_ndx_it = group_index.begin(); group1_ndx_it < group_index.end();
-             ++group1_ndx_it) {
-            // no such move exists that the internal energy has to be recalculated
-            // groupInternal(pair_accumulator, spc.groups[*group1_ndx_it]);
-            for (auto group2_ndx_it = std::next(group1_ndx_it); group2_ndx_it < group_index.end();
-                 group2_ndx_it++) {
-                group2group(pair_accumulator, spc.groups[*group1_ndx_it],
-                            spc.groups[*group2_ndx_it]);
-            }
+        for (const auto relative_index : index) {
+            group2all(pair_accumulator, group, static_cast<int>(relative_index));
         }
     }
 
     /**
-     * @brief Cross pairing of particles between a union of groups and its complement in space.
-     *
-     * If the distance between any two groups is greater or equal to the group cutoff distance, the
-     * particle pairing between them is skipped.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam T
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param group_index  list of groups
+     * @brief Cross pairing of particles between a union of (sorted) groups and all other groups.
+     * Pairs between two groups from the union are counted once.
+     * @see GroupPairingPolicy::groups2all
      */
     template <RequireEnergyAccumulator TAccumulator, typename T>
     void groups2all(TAccumulator& pair_accumulator, const T& group_index)
     {
-        groups2self(pair_accumulator, group_index);
-        auto index_complement = indexComplement(spc.groups.size(), group_index);
-        for (auto group1_ndx : group_index) {
-            for (auto group2_ndx : index_complement) {
-                group2group(pair_accumulator, spc.groups[group1_ndx], spc.groups[group2_ndx]);
+        for (const auto this_group_index : group_index) {
+            const auto& group = spc.groups[this_group_index];
+            const auto first = first_particle_of_group[this_group_index];
+            for (index_type i = first; i < first + group.size(); ++i) {
+                forEachNeighbour(i, [&](const auto j) {
+                    const auto other_group_index = group_of_particle[j];
+                    if (other_group_index == this_group_index) {
+                        return;
+                    }
+                    if (other_group_index < this_group_index &&
+                        std::ranges::binary_search(group_index, other_group_index)) {
+                        return; // already counted from the other group
+                    }
+                    if (!cut(groupOf(j), group)) {
+                        Base::particle2particle(pair_accumulator, spc.particles[i],
+                                                spc.particles[j]);
+                    }
+                });
             }
         }
     }
 
     /**
      * @brief Cross pairing between all particles in the space.
-     *
-     * If the distance between particles' groups is greater or equal to the group cutoff distance,
-     * no calculation is performed.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @param pair_accumulator  accumulator of interacting pairs of particles
+     * @param condition  a group filter if internal energy of the group shall be added
+     * @see GroupPairingPolicy::all
      */
-    template <RequireEnergyAccumulator TAccumulator> void all(TAccumulator& pair_accumulator)
+    template <RequireEnergyAccumulator TAccumulator, typename TCondition>
+    void all(TAccumulator& pair_accumulator, TCondition condition)
     {
-        for (auto group_it = spc.groups.begin(); group_it < spc.groups.end(); ++group_it) {
-            groupInternal(pair_accumulator, *group_it);
-            for (auto other_group_it = std::next(group_it); other_group_it < spc.groups.end();
-                 other_group_it++) {
-                group2group(pair_accumulator, *group_it, *other_group_it);
+        for (index_type group_index = 0; group_index < spc.groups.size(); ++group_index) {
+            const auto& group = spc.groups[group_index];
+            const bool add_internal = !group.traits().rigid && condition(group);
+            const auto first = first_particle_of_group[group_index];
+            for (index_type i = first; i < first + group.size(); ++i) {
+                forEachNeighbour(i, [&](const auto j) {
+                    if (j < i) {
+                        return;
+                    }
+                    if (group_of_particle[j] == group_index) {
+                        if (add_internal && isInternalPair(group, i, j)) {
+                            Base::particle2particle(pair_accumulator, spc.particles[i],
+                                                    spc.particles[j]);
+                        }
+                    }
+                    else if (!cut(groupOf(j), group)) {
+                        Base::particle2particle(pair_accumulator, spc.particles[i],
+                                                spc.particles[j]);
+                    }
+                });
             }
         }
     }
 
     /**
      * @brief Cross pairing between all particles in the space.
-     *
-     * If the distance between particles' groups is greater or equal to the group cutoff distance,
-     * no calculation is performed.
-     *
-     * @tparam TAccumulator  an accumulator with '+=' operator overloaded to add a pair of particles
-     * as references {T&, T&}
-     * @tparam TCondition  a function returning bool and having a group as an argument
-     * @param pair_accumulator  accumulator of interacting pairs of particles
-     * @param condition  a group filter if internal energy of the group shall be added
+     * @see GroupPairingPolicy::all
      */
-    template <RequireEnergyAccumulator TAccumulator, typename TCondition>
-    void all(TAccumulator& pair_accumulator, TCondition condition)
+    template <RequireEnergyAccumulator TAccumulator> void all(TAccumulator& pair_accumulator)
     {
-        for (auto group_it = spc.groups.begin(); group_it < spc.groups.end(); ++group_it) {
-            if (condition(*group_it)) {
-                groupInternal(pair_accumulator, *group_it);
-            }
-            for (auto other_group_it = std::next(group_it); other_group_it < spc.groups.end();
-                 other_group_it++) {
-                group2group(pair_accumulator, *group_it, *other_group_it);
-            }
-        }
+        all(pair_accumulator, []([[maybe_unused]] const auto& group) { return true; });
     }
 };
 
+/**
+ * @brief Particle pairing using Verlet lists with a skin.
+ * @see CellListPairingPolicy, VerletListNeighbours
+ */
+template <typename TCutoff>
+using VerletListPairingPolicy = CellListPairingPolicy<TCutoff, VerletListNeighbours>;
+
 /**
  * @brief Computes pair quantity difference for a systen perturbation. Such quantity can be energy
  * using nonponded pair potential
@@ -1451,6 +2794,7 @@ template <typename TPolicy> class GroupPairing
     void accumulate(TAccumulator& pair_accumulator, const Change& change)
     {
         assert(std::is_sorted(change.groups.begin(), change.groups.end()));
+        pairing.updateState(change);
         if (change.everything) {
             pairing.all(pair_accumulator);
         }
@@ -1487,14 +2831,39 @@ template <typename TPolicy> class GroupPairing
 
     void to_json(json& j) const { pairing.to_json(j); }
 
-    // FIXME a temporal fix for non-refactorized NonbondedCached
-    template <typename Accumulator>
-    void group2group(Accumulator& pair_accumulator, const Space::GroupType& group1,
-                     const Space::GroupType& group2)
+    /**
+     * @brief Lets the pairing policy catch up with the space after a change
+     * @param change
+     */
+    void updateState(const Change& change) { pairing.updateState(change); }
+
+    //! True if the visited pairs do not depend on particle positions
+    bool isPositionIndependent() const { return pairing.isPositionIndependent(); }
+
+    //! True if the group-to-group cutoff between the two groups does not depend on positions
+    bool isCutPositionIndependent(const Group& group1, const Group& group2) const
+    {
+        return pairing.isCutPositionIndependent(group1, group2);
+    }
+
+    /**
+     * @brief Pairing of two explicitly given groups
+     * @see GroupPairingPolicy::group2group
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename... TArgs>
+    void group2group(TAccumulator& pair_accumulator, TArgs&&... args)
+    {
+        pairing.group2group(pair_accumulator, std::forward<TArgs>(args)...);
+    }
+
+    /**
+     * @brief Pairing within an explicitly given group
+     * @see GroupPairingPolicy::groupInternal
+     */
+    template <RequireEnergyAccumulator TAccumulator, typename... TArgs>
+    void groupInternal(TAccumulator& pair_accumulator, TArgs&&... args)
     {
-        pairing.group2group(std::forward<Accumulator&>(pair_accumulator),
-                            std::forward<const Space::GroupType&>(group1),
-                            std::forward<const Space::GroupType&>(group2));
+        pairing.groupInternal(pair_accumulator, std::forward<TArgs>(args)...);
     }
 };
 
@@ -1523,6 +2892,77 @@ class Nonbonded : public NonbondedBase
         pairing; //!< pairing policy to effectively sum up the pairwise additive non-bonded energy
     std::shared_ptr<EnergyAccumulatorBase>
         energy_accumulator; //!< energy accumulator used for storing and summing pair-wise energies
+    std::shared_ptr<ThreadPool> thread_pool; //!< used for forces with the `threads` policy
+    std::optional<pairpotential::HomogeneousTerms>
+        homogeneous_terms; //!< terms of the current configuration, if known; see energyChange()
+
+    //! Isotropic scaling factor of the volume move from the old configuration, if all particles
+    //! were scaled, i.e., with only atomic and compressible molecules
+    std::optional<double> isotropicScaling(const Nonbonded& old_nonbonded) const
+    {
+        const bool all_scaled = std::ranges::all_of(spc.groups, [](const auto& group) {
+            return group.empty() || group.isAtomic() || group.traits().compressible;
+        });
+        const Point ratio =
+            spc.geometry.getLength().cwiseQuotient(old_nonbonded.spc.geometry.getLength());
+        const auto scale = ratio.x();
+        if (!all_scaled || !ratio.allFinite() ||
+            (ratio.array() - scale).abs().maxCoeff() > 1e-10 * scale) {
+            return std::nullopt;
+        }
+        return scale;
+    }
+
+    /**
+     * @brief Energy change from terms homogeneous in the distance, see `HomogeneousTerms`
+     *
+     * In an isotropic volume move where only positions have changed, the trial terms follow from
+     * the old terms in constant time; if these are unknown, only the trial configuration is
+     * evaluated and the old terms follow by inverse scaling. For partial changes, the trial terms
+     * are the old terms plus the change of the moved pairs. The terms are stored for the
+     * configurations of both instances and copied upon `sync()`.
+     *
+     * @return Trial and old energies, or `std::nullopt` if not applicable
+     */
+    std::optional<EnergyPair> homogeneousEnergyChange(Nonbonded& old_nonbonded,
+                                                      const Change& change)
+        requires RequireHomogeneousPairEnergy<TPairEnergy>
+    {
+        using pairpotential::scaleHomogeneousTerms;
+        const auto sum = [](const auto& terms) {
+            return std::accumulate(terms.begin(), terms.end(), 0.0);
+        };
+        auto& old_terms = old_nonbonded.homogeneous_terms;
+        if (change.volume_change && change.positions_only) {
+            const auto scale = isotropicScaling(old_nonbonded);
+            if (!scale) {
+                return std::nullopt;
+            }
+            if (old_terms) {
+                homogeneous_terms = scaleHomogeneousTerms(*old_terms, *scale);
+            }
+            else {
+                HomogeneousTermsAccumulator<TPairEnergy> accumulator(pair_energy, spc.particles);
+                pairing.accumulate(accumulator, change);
+                homogeneous_terms = accumulator.homogeneousTerms();
+                old_terms = scaleHomogeneousTerms(*homogeneous_terms, 1.0 / *scale);
+            }
+            return EnergyPair{sum(*homogeneous_terms), sum(*old_terms)};
+        }
+        if (change.everything || change.volume_change || !old_terms) {
+            return std::nullopt;
+        }
+        HomogeneousTermsAccumulator<TPairEnergy> accumulator(
+            pair_energy, old_nonbonded.pair_energy, spc.particles, old_nonbonded.spc.particles);
+        pairing.accumulate(accumulator, change);
+        const auto& trial_change = accumulator.homogeneousTerms();
+        const auto& old_change = accumulator.oldHomogeneousTerms();
+        homogeneous_terms = old_terms;
+        for (std::size_t i = 0; i < homogeneous_terms->size(); ++i) {
+            (*homogeneous_terms)[i] += trial_change[i] - old_change[i];
+        }
+        return EnergyPair{sum(trial_change), sum(old_change)};
+    }
 
   public:
     Nonbonded(const json& j, Space& spc, BasePointerVector<EnergyTerm>& pot)
@@ -1536,6 +2976,18 @@ class Nonbonded : public NonbondedBase
         energy_accumulator->reserve(spc.numParticles()); // attempt to reduce memory fragmentation
     }
 
+    /**
+     * @brief Sets the thread pool used by the `threads` summation policy; ignored otherwise
+     */
+    void setThreadPool(std::shared_ptr<ThreadPool> thread_pool)
+    {
+        if (auto ptr = std::dynamic_pointer_cast<ThreadPoolEnergyAccumulator<TPairEnergy>>(
+                energy_accumulator)) {
+            ptr->setThreadPool(thread_pool);
+            this->thread_pool = std::move(thread_pool);
+        }
+    }
+
     double particleParticleEnergy(const Particle& particle1, const Particle& particle2) override
     {
         return pair_energy(particle1, particle2);
@@ -1563,6 +3015,7 @@ class Nonbonded : public NonbondedBase
 
     double energy(const Change& change) override
     {
+        homogeneous_terms.reset();
         energy_accumulator->clear();
         // down-cast to avoid slow, virtual function calls:
         if (auto ptr = std::dynamic_pointer_cast<InstantEnergyAccumulator<TPairEnergy>>(
@@ -1573,76 +3026,376 @@ class Nonbonded : public NonbondedBase
                      energy_accumulator)) {
             pairing.accumulate(*ptr, change);
         }
+        else if (auto ptr = std::dynamic_pointer_cast<ThreadPoolEnergyAccumulator<TPairEnergy>>(
+                     energy_accumulator)) {
+            pairing.accumulate(*ptr, change);
+        }
         else {
             pairing.accumulate(*energy_accumulator, change);
         }
         return static_cast<double>(*energy_accumulator);
     }
 
+    /**
+     * @brief Energies of the trial (this) and the old configuration in a single pass.
+     *
+     * The particle pairs are enumerated only once, in the trial space, and each pair is evaluated
+     * in both configurations. This requires that the visited pairs do not depend on particle
+     * positions, that the particle count is unchanged, and serial summation; otherwise the two
+     * energies are calculated separately. If the pair potential is homogeneous in the distance,
+     * e.g., Lennard-Jones and plain Coulomb, the energy is split into terms whereby volume moves
+     * become cheap, see `homogeneousEnergyChange()`.
+     *
+     * @param old_energy  nonbonded energy of the same type operating on the old configuration
+     * @param change
+     */
+    EnergyPair energyChange(EnergyTerm& old_energy, const Change& change) override
+    {
+        homogeneous_terms.reset();
+        auto* old_nonbonded = dynamic_cast<Nonbonded*>(&old_energy);
+        if (old_nonbonded == nullptr || change.matter_change ||
+            !pairing.isPositionIndependent() ||
+            !std::dynamic_pointer_cast<InstantEnergyAccumulator<TPairEnergy>>(
+                energy_accumulator)) {
+            return EnergyTerm::energyChange(old_energy, change);
+        }
+        if constexpr (RequireHomogeneousPairEnergy<TPairEnergy>) {
+            if (pair_energy.isHomogeneous()) {
+                if (const auto energies = homogeneousEnergyChange(*old_nonbonded, change)) {
+                    return *energies;
+                }
+            }
+        }
+        DualEnergyAccumulator<TPairEnergy> accumulator(
+            pair_energy, old_nonbonded->pair_energy, spc.particles, old_nonbonded->spc.particles);
+        pairing.accumulate(accumulator, change);
+        return {static_cast<double>(accumulator), accumulator.oldValue()};
+    }
+
+    void updateState([[maybe_unused]] const Change& change) override
+    {
+        homogeneous_terms.reset(); // the configuration is about to be modified
+    }
+
+    void sync(EnergyTerm* other_energy, const Change& change) override
+    {
+        if (const auto* other = dynamic_cast<const Nonbonded*>(other_energy)) {
+            homogeneous_terms = other->homogeneous_terms;
+        }
+        pairing.updateState(change);
+    }
+
     /**
      * @brief Calculates the force on all particles.
      *
-     * @todo A stub. Change to reflect only active particle, see Space::activeParticles().
+     * The interacting pairs are enumerated by the pairing policy exactly as for the energy of all
+     * particles, i.e., only active particles are included and group cutoffs, cell or Verlet lists,
+     * and pair exclusions are honoured. With the `threads` summation policy, the pairs are
+     * evaluated on the thread pool.
+     *
+     * @param forces  destination force vector indexed as `Space::particles`; forces are added
      */
     void force(std::vector<Point>& forces) override
     {
-        // just a temporary hack; perhaps better to allow PairForce instead of the PairEnergy
-        // template
         assert(forces.size() == spc.particles.size() &&
                "the forces size must match the particle size");
-        for (size_t i = 0; i < spc.particles.size() - 1; ++i) {
-            for (size_t j = i + 1; j < spc.particles.size(); ++j) {
-                const Point f = pair_energy.force(spc.particles[i], spc.particles[j]);
-                forces[i] += f;
-                forces[j] -= f;
-            }
+        Change change;
+        change.everything = true;
+        if (thread_pool) {
+            ThreadPoolForceAccumulator<TPairEnergy> accumulator(pair_energy, spc.particles,
+                                                                forces, thread_pool);
+            pairing.accumulate(accumulator, change);
+            accumulator.evaluateTasks();
+        }
+        else {
+            ForceAccumulator<TPairEnergy> accumulator(pair_energy, spc.particles, forces);
+            pairing.accumulate(accumulator, change);
+        }
+    }
+};
+
+/**
+ * @brief Sparse, symmetric matrix of group-to-group energies
+ *
+ * Only non-zero elements are stored, i.e., typically only group pairs within the group cutoff
+ * distance. Each row is a hash map so that an element is found and updated in constant time. The
+ * diagonal holds the internal energies of the groups.
+ *
+ * @tparam T  floating point type used for storage
+ */
+template <std::floating_point T> class GroupEnergyMatrix
+{
+    std::vector<std::unordered_map<std::size_t, T>> rows; //!< non-zero elements of each row
+
+  public:
+    using value_type = T;
+
+    void reset(std::size_t size) { rows.assign(size, {}); } //!< Resize and set all elements to zero
+    std::size_t size() const { return rows.size(); }        //!< Number of rows
+    std::size_t nonZeros() const; //!< Number of non-zero elements on or above the diagonal
+    double sum() const;           //!< Sum of all elements on or above the diagonal
+
+    //! Element (i, j)
+    double operator()(const std::size_t i, const std::size_t j) const
+    {
+        const auto& row = rows[i];
+        const auto it = row.find(j);
+        return it == row.end() ? 0.0 : static_cast<double>(it->second);
+    }
+
+    //! Set elements (i, j) and (j, i); zero values are not stored
+    void set(const std::size_t i, const std::size_t j, const double value)
+    {
+        if (value == 0.0) {
+            rows[i].erase(j);
+            rows[j].erase(i);
+        }
+        else {
+            rows[i][j] = static_cast<T>(value);
+            rows[j][i] = static_cast<T>(value);
         }
     }
+
+    //! Copy row and column `i` from another matrix of the same size
+    void copyRow(const GroupEnergyMatrix& other, std::size_t i);
 };
 
+template <std::floating_point T> std::size_t GroupEnergyMatrix<T>::nonZeros() const
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        count += std::ranges::count_if(rows[i], [i](const auto& element) {
+            return element.first >= i;
+        });
+    }
+    return count;
+}
+
+template <std::floating_point T> double GroupEnergyMatrix<T>::sum() const
+{
+    double energy_sum = 0.0;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        for (const auto& [j, value] : rows[i]) {
+            if (j >= i) {
+                energy_sum += static_cast<double>(value);
+            }
+        }
+    }
+    return energy_sum;
+}
+
+template <std::floating_point T>
+void GroupEnergyMatrix<T>::copyRow(const GroupEnergyMatrix& other, const std::size_t i)
+{
+    for (const auto& [j, value] : rows[i]) {
+        if (j != i) {
+            rows[j].erase(i);
+        }
+    }
+    rows[i] = other.rows[i];
+    for (const auto& [j, value] : rows[i]) {
+        rows[j][i] = value;
+    }
+}
+
 /**
- * @brief Computes non-bonded energy contribution from changed particles. Cache group2group energy
- * once calculated, until a new trial configuration is provided. Not for general use as only
- * partially implemented!
+ * @brief Computes the non-bonded energy from cached group-to-group and internal group energies.
  *
- * Original implementation, only refurbished. Generally suboptimal as only
- * PairingPolicy::group2group method may be called. No internal energy is ever computed. Cannot deal
- * with particle count changes. And other unmentioned constrains.
+ * The energies between all pairs of groups and within each group are kept in a sparse matrix, see
+ * `GroupEnergyMatrix`. A trial move re-evaluates and stores only the elements affected by the
+ * change, i.e., the rows of the changed groups, while the energy of the old configuration is
+ * looked up in the cache of the old energy term, see `energyChange()`. If only a subset of the
+ * particles in a group changes, and the affected pair sums are additive over particles, an element
+ * is updated by the difference of the changed particles' contributions in the old and the trial
+ * configuration. This applies also to changes in the number of particles. Volume changes and
+ * changes of everything re-evaluate all elements. The caches are synchronized by copying the rows
+ * of the changed groups in `sync()`.
+ *
+ * The accepted state never alters its cache in `energy()` as analyses may evaluate temporarily
+ * perturbed configurations.
  *
  * @tparam TPairEnergy  a functor to compute non-bonded energy between two particles
  * @tparam TPairingPolicy  pairing policy to effectively sum up the pairwise additive non-bonded
  * energy
+ * @tparam TCacheValue  floating point type used to store the cached energies
  */
-template <RequirePairEnergy TPairEnergy, typename TPairingPolicy>
+template <RequirePairEnergy TPairEnergy, typename TPairingPolicy,
+          std::floating_point TCacheValue = double>
 class NonbondedCached : public Nonbonded<TPairEnergy, TPairingPolicy>
 {
     using Base = Nonbonded<TPairEnergy, TPairingPolicy>;
     using TAccumulator = InstantEnergyAccumulator<TPairEnergy>;
-    Eigen::MatrixXf energy_cache;
+    using index_type = Change::index_type;
+    using Base::pair_energy;
+    using Base::pairing;
     using Base::spc;
 
-    template <typename TGroup> double g2g(const TGroup& g1, const TGroup& g2)
+    GroupEnergyMatrix<TCacheValue> energy_cache; //!< group-to-group and internal group energies
+
+    //! True if only the indexed particles of the group have changed
+    static bool isPartial(const Change::GroupChange& group_change)
+    {
+        return !group_change.all && !group_change.relative_atom_indices.empty();
+    }
+
+    //! Indices of changed particles which are active in the group
+    static std::vector<index_type> activeIndex(const Group& group,
+                                               const Change::GroupChange& group_change)
+    {
+        std::vector<index_type> index;
+        std::ranges::copy_if(group_change.relative_atom_indices, std::back_inserter(index),
+                             [size = group.size()](auto i) { return i < size; });
+        return index;
+    }
+
+    /**
+     * @brief Calls a function for each element of the energy matrix affected by a change
+     *
+     * The function is called as `visitor(i, j, group_change_i, group_change_j)` where the
+     * group changes are `nullptr` if the change is global or the group is unchanged. Internal
+     * energies are visited as `i == j`.
+     */
+    template <typename TVisitor> void forEachElement(const Change& change, TVisitor&& visitor) const
+    {
+        const auto number_of_groups = spc.groups.size();
+        if (change.everything || change.volume_change) {
+            const Change::GroupChange* no_group_change = nullptr;
+            for (index_type i = 0; i < number_of_groups; ++i) {
+                for (index_type j = i; j < number_of_groups; ++j) {
+                    visitor(i, j, no_group_change, no_group_change);
+                }
+            }
+            return;
+        }
+        std::vector<const Change::GroupChange*> group_changes(number_of_groups, nullptr);
+        for (const auto& group_change : change.groups) {
+            group_changes[group_change.group_index] = &group_change;
+        }
+        for (const auto& group_change : change.groups) {
+            const auto i = group_change.group_index;
+            visitor(i, i, &group_change, &group_change);
+            for (index_type j = 0; j < number_of_groups; ++j) {
+                const auto* other_group_change = group_changes[j];
+                if (j == i || (other_group_change != nullptr &&
+                               (j < i || !change.moved_to_moved_interactions))) {
+                    continue; // moved<->moved visited once or not at all
+                }
+                visitor(i, j, &group_change, other_group_change);
+            }
+        }
+    }
+
+    //! Energy between two groups (i ≠ j) or internal energy of a group (i = j)
+    double elementEnergy(const index_type i, const index_type j)
+    {
+        TAccumulator accumulator(pair_energy);
+        if (i == j) {
+            pairing.groupInternal(accumulator, spc.groups[i]);
+        }
+        else {
+            pairing.group2group(accumulator, spc.groups[i], spc.groups[j]);
+        }
+        return static_cast<double>(accumulator);
+    }
+
+    //! Contribution to `elementEnergy()` from pairs involving active changed particles
+    double partialElementEnergy(const index_type i, const index_type j,
+                                const Change::GroupChange& group_change_i,
+                                const Change::GroupChange* group_change_j)
     {
-        int i = &g1 - spc.groups.data();
-        int j = &g2 - spc.groups.data();
-        if (j < i) {
-            std::swap(i, j);
+        TAccumulator accumulator(pair_energy);
+        const auto& group_i = spc.groups[i];
+        const auto index_i = activeIndex(group_i, group_change_i);
+        if (i == j) {
+            if (!index_i.empty()) {
+                pairing.groupInternal(accumulator, group_i, index_i);
+            }
+        }
+        else {
+            const auto& group_j = spc.groups[j];
+            const auto index_j = group_change_j ? activeIndex(group_j, *group_change_j)
+                                                : std::vector<index_type>();
+            pairing.group2group(accumulator, group_i, group_j, index_i, index_j);
+        }
+        return static_cast<double>(accumulator);
+    }
+
+    //! True if the element cannot have changed
+    bool isUnchanged(const Change& change, const index_type i, const index_type j,
+                     const Change::GroupChange* group_change_i) const
+    {
+        if (i != j || change.everything) {
+            return false;
         }
-        if (EnergyTerm::state ==
-            EnergyTerm::MonteCarloState::TRIAL) { // if this is from the trial system
-            TAccumulator energy_accumulator(Base::pair_energy);
-            Base::pairing.group2group(energy_accumulator, g1, g2);
-            energy_cache(i, j) = static_cast<double>(energy_accumulator); // update the cache
+        if (change.volume_change) { // incompressible molecules keep their internal energy
+            const auto& group = spc.groups[i];
+            return !group.isAtomic() && !group.traits().compressible;
+        }
+        return !change.matter_change && !group_change_i->internal;
+    }
+
+    //! True if the element can be updated by the contributions of the changed particles only
+    bool isAdditive(const Change& change, const index_type i, const index_type j,
+                    const Change::GroupChange* group_change_i,
+                    const Change::GroupChange* group_change_j) const
+    {
+        if (group_change_i == nullptr || !isPartial(*group_change_i)) {
+            return false;
+        }
+        if (i == j) {
+            return true;
+        }
+        return (group_change_j == nullptr || isPartial(*group_change_j)) &&
+               pairing.isCutPositionIndependent(spc.groups[i], spc.groups[j]);
+    }
+
+    /**
+     * @brief Energy of the affected elements in the current configuration
+     * @param change
+     * @param old_energy  term of the old configuration with a valid cache, or `nullptr`
+     * @param store  store the evaluated elements in the cache
+     */
+    double evaluate(const Change& change, NonbondedCached* old_energy, const bool store)
+    {
+        pairing.updateState(change);
+        if (old_energy != nullptr) {
+            old_energy->pairing.updateState(change);
         }
-        return energy_cache(i, j); // return (cached) value
+        double energy_sum = 0.0;
+        forEachElement(change, [&](const auto i, const auto j, const auto* group_change_i,
+                                   const auto* group_change_j) {
+            double value = 0.0;
+            if (isUnchanged(change, i, j, group_change_i)) {
+                value = energy_cache(i, j);
+            }
+            else if (old_energy != nullptr &&
+                     isAdditive(change, i, j, group_change_i, group_change_j)) {
+                value = old_energy->energy_cache(i, j) -
+                        old_energy->partialElementEnergy(i, j, *group_change_i, group_change_j) +
+                        partialElementEnergy(i, j, *group_change_i, group_change_j);
+            }
+            else {
+                value = elementEnergy(i, j);
+            }
+            if (store) {
+                energy_cache.set(i, j, value);
+            }
+            energy_sum += value;
+        });
+        return energy_sum;
     }
 
-    template <typename TGroup>
-    double g2g(const TGroup& g1, const TGroup& g2,
-               [[maybe_unused]] const std::vector<std::size_t>& index)
+    //! Energy of the affected elements looked up in the cache
+    double cachedEnergy(const Change& change) const
     {
-        // index not implemented
-        return g2g(g1, g2);
+        if (change.everything || change.volume_change) {
+            return energy_cache.sum();
+        }
+        double energy_sum = 0.0;
+        forEachElement(change, [&](const auto i, const auto j, const auto*, const auto*) {
+            energy_sum += energy_cache(i, j);
+        });
+        return energy_sum;
     }
 
   public:
@@ -1654,110 +3407,68 @@ class NonbondedCached : public Nonbonded<TPairEnergy, TPairingPolicy>
     }
 
     /**
-     * @brief Cache pair interactions in matrix.
+     * @brief Evaluate and cache all group-to-group and internal energies
      */
     void init() override
     {
-        const auto groups_size = spc.groups.size();
-        energy_cache.resize(groups_size, groups_size);
-        energy_cache.setZero();
-        TAccumulator u(Base::pair_energy);
-        for (auto i = 0; i < groups_size - 1; ++i) {
-            for (auto j = i + 1; j < groups_size; ++j) {
-                u = 0.0;
-                Base::pairing.group2group(u, spc.groups.at(i), spc.groups.at(j));
-                energy_cache(i, j) = static_cast<double>(u);
-            }
-        }
+        energy_cache.reset(spc.groups.size());
+        Change change;
+        change.everything = true;
+        evaluate(change, nullptr, true);
     }
 
+    /**
+     * @brief Energy of the groups affected by the change, including their internal energies
+     *
+     * The affected elements are re-evaluated and, unless in the accepted state, stored.
+     */
     double energy(const Change& change) override
     {
         if (!change) {
             return 0.0;
         }
-        // Only g2g may be called there to compute (and cache) energy!
-        double energy_sum = 0.0;
-        if (change.everything || change.volume_change) {
-            for (auto i = spc.groups.begin(); i < spc.groups.end(); ++i) {
-                for (auto j = std::next(i); j < Base::spc.groups.end(); ++j) {
-                    energy_sum += g2g(*i, *j);
-                }
-            }
-            return energy_sum;
-        };
-
-        if (change.groups.size() == 1) { // if exactly ONE molecule is changed
-            const auto& d = change.groups[0];
-            const auto& g1 = spc.groups.at(d.group_index);
-            for (auto g2_it = spc.groups.begin(); g2_it < spc.groups.end(); ++g2_it) {
-                if (&g1 != &(*g2_it)) {
-                    energy_sum += g2g(g1, *g2_it, d.relative_atom_indices);
-                }
-            }
-            return energy_sum;
-        }
-
-        // many molecules are changed:
+        const bool store = EnergyTerm::state != EnergyTerm::MonteCarloState::ACCEPTED;
+        return evaluate(change, nullptr, store);
+    }
 
-        auto moved = change.touchedGroupIndex(); // index of moved groups
-        // moved<->moved
-        if (change.moved_to_moved_interactions) {
-            for (auto i = moved.begin(); i < moved.end(); ++i) {
-                for (auto j = std::next(i); j < moved.end(); ++j) {
-                    energy_sum += g2g(spc.groups[*i], spc.groups[*j]);
-                }
-            }
-        }
-        // moved<->static
-#if true
-        // classic version
-        const auto fixed =
-            indexComplement(spc.groups.size(), moved) | ranges::to_vector; // static groups
-        for (auto i : moved) {
-            for (auto j : fixed) {
-                energy_sum += g2g(spc.groups[i], spc.groups[j]);
-            }
-        }
-#else
-        // OMP-ready version
-        auto fixed = indexComplement(spc.groups.size(), moved) |
-                     ranges::to<std::vector>; // index of static groups
-        const size_t moved_size = moved.size();
-        const size_t fixed_size = fixed.size();
-        for (auto i = 0; i < moved_size; ++i) {
-            for (auto j = 0; j < fixed_size; ++j) {
-                energy_sum += g2g(spc.groups[moved[i]], spc.groups[fixed[j]]);
-            }
+    /**
+     * @brief Trial energy from updated cache elements and old energy from the old cache
+     */
+    EnergyPair energyChange(EnergyTerm& old_energy, const Change& change) override
+    {
+        auto* old_cached = dynamic_cast<NonbondedCached*>(&old_energy);
+        if (old_cached == nullptr || !change || change.everything) {
+            return EnergyTerm::energyChange(old_energy, change);
         }
-#endif
-        return energy_sum;
+        return {evaluate(change, old_cached, true), old_cached->cachedEnergy(change)};
     }
 
     /**
-     * @brief Copy energy matrix from other
+     * @brief Copy the cache elements of the changed groups from other
      * @param base_ptr
      * @param change
      */
     void sync(EnergyTerm* base_ptr, const Change& change) override
     {
+        Base::sync(base_ptr, change);
         auto other = dynamic_cast<decltype(this)>(base_ptr);
         assert(other);
         if (change.everything || change.volume_change) {
-            energy_cache.triangularView<Eigen::StrictlyUpper>() =
-                (other->energy_cache).template triangularView<Eigen::StrictlyUpper>();
+            energy_cache = other->energy_cache;
         }
         else {
-            for (const auto& d : change.groups) {
-                for (int i = 0; i < d.group_index; i++) {
-                    energy_cache(i, d.group_index) = other->energy_cache(i, d.group_index);
-                }
-                for (size_t i = d.group_index + 1; i < spc.groups.size(); i++) {
-                    energy_cache(d.group_index, i) = other->energy_cache(d.group_index, i);
-                }
+            for (const auto& group_change : change.groups) {
+                energy_cache.copyRow(other->energy_cache, group_change.group_index);
             }
         }
     }
+
+    void to_json(json& j) const override
+    {
+        Base::to_json(j);
+        j["cache_precision"] = std::is_same_v<TCacheValue, float> ? "float" : "double";
+        j["cached_elements"] = energy_cache.nonZeros();
+    }
 };
 
 #ifdef ENABLE_FREESASA
@@ -1867,6 +3578,7 @@ class SASAEnergyReference : public EnergyTerm
                         int slices_per_atom = 25, bool dense_container = true);
     SASAEnergyReference(const json& j, const Space& spc);
     const std::vector<double>& getAreas() const;
+    void setThreadPool(std::shared_ptr<ThreadPool> pool); //!< Calculate areas in parallel
     double energy(const Change& change) override;
 };
 
@@ -1881,12 +3593,13 @@ class SASAEnergy : public SASAEnergyReference
         current_neighbours; //!< holds cached neighbour indices for each particle in ParticleVector
     std::vector<index_type>
         changed_indices; //!< paritcle indices whose SASA changed based on change object
+    SASA::SASABase::Neighbours neighbour_buffer; //!< reused when finding changed neighbours
 
     void sync(EnergyTerm* energybase_ptr, const Change& change) override;
     void init() override;
 
     void updateChangedIndices(const Change& change);
-    void insertChangedNeighboursOf(index_type index, std::set<index_type>& target_indices) const;
+    void insertChangedNeighboursOf(index_type index, std::vector<index_type>& target_indices);
 
   public:
     SASAEnergy(const Space& spc, double cosolute_molarity, double probe_radius,
@@ -1895,6 +3608,44 @@ class SASAEnergy : public SASAEnergyReference
     double energy(const Change& change) override;
 };
 
+/**
+ * @brief SASA energy from an updateable radical (Laguerre) tessellation using Voronota-LT
+ *
+ * The surface areas are exact for the given set of spheres of radius `sigma/2 + probe`. The
+ * tessellation is updated locally around particles in the `Change` object and per-particle
+ * energies are updated only for spheres whose cells were affected. Inactive particles are
+ * excluded from the tessellation. Trial and accepted instances each keep their own
+ * tessellation which is brought in sync by replaying the change in `sync()`.
+ *
+ * https://doi.org/10/mq8k
+ */
+class SASAVoronoi : public EnergyTerm
+{
+  private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl;
+    const Space& spc;                //!< Space to operate on
+    double cosolute_molarity = 0.0;  //!< co-solute concentration (mol/l)
+    double probe_radius;             //!< probe radius added to each particle radius (Å)
+    bool use_pbc = false;            //!< tessellate in a periodic box
+    std::vector<double> areas;       //!< SASA of each particle (zero if inactive)
+    std::vector<double> energies;    //!< energy of each particle (kT)
+    double total_energy = 0.0;       //!< sum of `energies`
+
+    void to_json(json& j) const override;
+    void sync(EnergyTerm* energybase_ptr, const Change& change) override;
+    void updateTessellation(const Change& change);
+    void updateEnergies(const std::vector<std::size_t>& indices);
+
+  public:
+    SASAVoronoi(const Space& spc, double cosolute_molarity, double probe_radius);
+    SASAVoronoi(const json& j, const Space& spc);
+    ~SASAVoronoi() override;
+    void init() override; //!< Tessellate all particles from scratch
+    double energy(const Change& change) override;
+    const std::vector<double>& getAreas() const;
+};
+
 /**
  * @brief Oscillating energy on a single particle
  *
@@ -1958,6 +3709,7 @@ class Hamiltonian : public EnergyTerm, public BasePointerVector<EnergyTerm>
 {
   private:
     double maximum_allowed_energy = pc::infty; //!< Maximum allowed energy change
+    std::shared_ptr<ThreadPool> thread_pool;   //!< Shared by energy terms; created on demand
     std::vector<double>
         latest_energies;         //!< Placeholder for the lastest energies for each energy term
     decltype(vec)& energy_terms; //!< Alias for `vec`
@@ -1970,13 +3722,18 @@ class Hamiltonian : public EnergyTerm, public BasePointerVector<EnergyTerm>
     std::unique_ptr<EnergyTerm> createEnergy(Space& spc, const std::string& name, const json& j);
 
   public:
-    Hamiltonian(Space& spc, const json& j);
+    Hamiltonian(Space& spc, const json& j, std::shared_ptr<ThreadPool> thread_pool = nullptr);
     void init() override;
     void updateState(const Change& change) override;
     void sync(EnergyTerm* other_hamiltonian, const Change& change) override;
     double energy(const Change& change) override; //!< Energy due to changes
+    EnergyPair energyChange(EnergyTerm& old_hamiltonian,
+                            const Change& change) override; //!< Trial and old energy due to changes
     const std::vector<double>&
     latestEnergies() const; //!< Energies for each term from the latest call to `energy()`
+    std::shared_ptr<ThreadPool>
+    getThreadPool(unsigned int number_of_threads = 0); //!< Thread pool; created on first call
+    const std::shared_ptr<ThreadPool>& threadPool() const; //!< Thread pool, if any; may be empty
 };
 } // namespace Energy
 } // namespace Faunus
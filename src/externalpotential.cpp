@@ -4,7 +4,9 @@
 #include "aux/eigensupport.h"
 #include "functionparser.h"
 #include "space.h"
+#include "random.h"
 #include <spdlog/spdlog.h>
+#include <numeric>
 
 #include <utility>
 
@@ -23,6 +25,20 @@ void EnergyTerm::sync([[maybe_unused]] EnergyTerm* other_energy,
 {
 }
 
+/**
+ * This instance is assumed to operate on the trial configuration and `old_energy` on the
+ * old configuration. The default implementation evaluates both terms separately; terms able to
+ * visit the changed interactions only once in both configurations may override this.
+ *
+ * @param old_energy Energy instance of the same type operating on the old configuration
+ * @param change Describes the difference between the two configurations
+ */
+EnergyPair EnergyTerm::energyChange(EnergyTerm& old_energy, const Change& change)
+{
+    const auto trial_energy = energy(change);
+    return {trial_energy, old_energy.energy(change)};
+}
+
 void EnergyTerm::init() {}
 
 void EnergyTerm::force([[maybe_unused]] PointVector& forces) {}
@@ -154,6 +170,29 @@ TEST_CASE("[Faunus] ExternalPotential")
         change.everything = true; // if both particles have changed
         CHECK_EQ(pot.energy(change), Approx(0.5 + 0.5));
     }
+
+    SUBCASE("CustomExternal tabulation")
+    {
+        Space spc = j;
+        auto input = R"({"molecules": ["M"], "function": "exp(-z/50) + x / 100 + q",
+                         "tabulate": {"axes": "xz", "spacing": 2.0,
+                                      "interpolation": "cubic"}})"_json;
+        CustomExternal pot(input, spc);
+        Change change;
+        change.everything = true;
+        spc.particles.at(0).pos = {10.3, -20.0, 3.7};
+        spc.particles.at(1).pos = {-1.1, 5.0, -60.2};
+        spc.particles.at(1).charge = 0.5; // not tabulated; evaluate expression
+        const auto expected =
+            std::exp(-3.7 / 50) + 10.3 / 100 + std::exp(60.2 / 50) - 1.1 / 100 + 0.5;
+        CHECK_EQ(pot.energy(change), Approx(expected).epsilon(1e-6));
+
+        input["tabulate"]["axes"] = "z"; // missing x-dependence is detected
+        CHECK_THROWS_AS(CustomExternal(input, spc), ConfigurationError);
+
+        input["tabulate"] = R"({"axes": "xyz", "spacing": 0.5})"_json; // too many nodes
+        CHECK_THROWS_AS(CustomExternal(input, spc), ConfigurationError);
+    }
 }
 
 // ------------ Confine -------------
@@ -493,13 +532,130 @@ CustomExternal::CustomExternal(const json& j, Space& spc)
                       {"x", &particle_data.x},
                       {"y", &particle_data.y},
                       {"z", &particle_data.z}});
-        externalPotentialFunc = [&](const Particle& a) {
-            particle_data.x = a.pos.x();
-            particle_data.y = a.pos.y();
-            particle_data.z = a.pos.z();
-            particle_data.charge = a.charge;
-            return expr->operator()();
-        };
+        if (j.contains("tabulate")) {
+            tabulate(j["tabulate"]);
+            externalPotentialFunc = [&](const Particle& particle) {
+                const Grid::Coordinate point = {particle.pos.x(), particle.pos.y(),
+                                                particle.pos.z()};
+                for (const auto& [charge, grid] : grids) {
+                    if (charge == particle.charge) {
+                        if (grid.contains(point)) {
+                            return grid(point);
+                        }
+                        break;
+                    }
+                }
+                return exactEnergy(particle);
+            };
+        }
+        else {
+            externalPotentialFunc = [&](const Particle& particle) { return exactEnergy(particle); };
+        }
+    }
+}
+
+double CustomExternal::exactEnergy(const Particle& particle)
+{
+    particle_data.x = particle.pos.x();
+    particle_data.y = particle.pos.y();
+    particle_data.z = particle.pos.z();
+    particle_data.charge = particle.charge;
+    return expr->operator()();
+}
+
+/**
+ * The grid spans the bounding box of the container. Charges are taken from the atom types or,
+ * if `com=true`, from the net charge of the molecule types. The tabulated potential is
+ * compared with the exact expression at random positions in the box (all three coordinates,
+ * also those not tabulated) and an error is raised if the deviation exceeds the tolerance.
+ */
+void CustomExternal::tabulate(const json& j)
+{
+    const auto axes_string = j.value("axes", "xyz"s);
+    const std::array<bool, 3> axes = {axes_string.find('x') != std::string::npos,
+                                      axes_string.find('y') != std::string::npos,
+                                      axes_string.find('z') != std::string::npos};
+    if (axes_string.empty() || axes_string.find_first_not_of("xyz") != std::string::npos) {
+        throw ConfigurationError("{}: tabulation axes must be a combination of x, y, and z", name);
+    }
+    Grid::Interpolation interpolation;
+    if (const auto scheme = j.value("interpolation", "linear"s); scheme == "linear") {
+        interpolation = Grid::Interpolation::LINEAR;
+    }
+    else if (scheme == "cubic") {
+        interpolation = Grid::Interpolation::CUBIC;
+    }
+    else {
+        throw ConfigurationError("{}: unknown interpolation '{}'", name, scheme);
+    }
+    auto spacing = j.value("spacing", 0.5);
+    const auto tolerance = j.value("tolerance", 0.01);
+
+    std::set<double> charges;
+    if (json_input_backup.value("com", false)) {
+        for (const auto& molecule : Faunus::molecules) {
+            charges.insert(std::accumulate(
+                molecule.atoms.begin(), molecule.atoms.end(), 0.0,
+                [](auto sum, auto atom_id) { return sum + Faunus::atoms.at(atom_id).charge; }));
+        }
+    }
+    else {
+        for (const auto& atom : Faunus::atoms) {
+            charges.insert(atom.charge);
+        }
+    }
+
+    const Point half_length = 0.5 * space.geometry.getLength();
+    const Grid::Coordinate lower = {-half_length.x(), -half_length.y(), -half_length.z()};
+    const Grid::Coordinate upper = {half_length.x(), half_length.y(), half_length.z()};
+    if (!j.contains("spacing")) { // coarsen the default spacing until the grid fits
+        while (Grid::countNodes(lower, upper, axes, spacing, interpolation) >
+               static_cast<double>(Grid::max_size)) {
+            spacing *= 1.05;
+        }
+    }
+    if (const auto nodes = Grid::countNodes(lower, upper, axes, spacing, interpolation);
+        nodes > static_cast<double>(Grid::max_size)) {
+        throw ConfigurationError("{}: {:.0f} grid nodes ({:.0f} MB per charge) exceeds the "
+                                 "maximum of {}; increase the spacing or tabulate fewer axes",
+                                 name, nodes, nodes * sizeof(double) / 1e6, Grid::max_size);
+    }
+    Particle particle;
+    auto energy = [&](const Grid::Coordinate& point) {
+        particle.pos = {point[0], point[1], point[2]};
+        const auto energy = exactEnergy(particle);
+        if (!std::isfinite(energy)) {
+            throw ConfigurationError("{}: cannot tabulate non-finite energy at ({}, {}, {})",
+                                     name, point[0], point[1], point[2]);
+        }
+        return energy;
+    };
+    grids.clear();
+    for (const auto charge : charges) {
+        particle.charge = charge;
+        grids.emplace_back(charge, Grid(lower, upper, axes, spacing, interpolation, energy));
+    }
+
+    Random random;
+    double max_error = 0.0;
+    for (int i = 0; i < 1000; ++i) {
+        const auto& [charge, grid] = *random.sample(grids.begin(), grids.end());
+        particle.charge = charge;
+        const Grid::Coordinate point = {random() * (upper[0] - lower[0]) + lower[0],
+                                        random() * (upper[1] - lower[1]) + lower[1],
+                                        random() * (upper[2] - lower[2]) + lower[2]};
+        max_error = std::max(max_error, std::fabs(grid(point) - energy(point)));
+    }
+    const auto nodes = grids.front().second.size();
+    faunus_logger->info("{}: tabulated {} charge(s) on {} nodes ({:.1f} MB) with spacing {:.2f} Å "
+                        "and max. abs. error {:.1E} kT",
+                        name, grids.size(), nodes, spacing,
+                        static_cast<double>(grids.size() * nodes * sizeof(double)) / 1e6,
+                        max_error);
+    if (max_error > tolerance) {
+        throw ConfigurationError("{}: tabulation error {:.1E} kT exceeds tolerance; reduce the "
+                                 "spacing or check that all dependent axes are tabulated",
+                                 name, max_error);
     }
 }
 
@@ -3,6 +3,7 @@
 #include "group.h"
 #include "aux/timers.h"
 #include "aux/equidistant_table.h"
+#include "tabulate.h"
 #include <set>
 
 template <std::floating_point T> class ExprFunction;
@@ -14,6 +15,15 @@ class Space;
 
 namespace Energy {
 
+/**
+ * @brief Energies of the trial and the old configuration due to a change (kT)
+ */
+struct EnergyPair
+{
+    double trial = 0.0; //!< energy of the trial configuration
+    double old = 0.0;   //!< energy of the old configuration
+};
+
 /**
  * All energies inherit from this class
  */
@@ -31,6 +41,8 @@ class EnergyTerm
     std::string citation_information;                     //!< Possible reference; may be left empty
     TimeRelativeOfTotal<std::chrono::microseconds> timer; //!< Timer for measuring speed
     virtual double energy(const Change& change) = 0;      //!< energy due to change
+    virtual EnergyPair energyChange(EnergyTerm& old_energy,
+                                    const Change& change); //!< trial and old energies due to change
     virtual void to_json(json& j) const;                  //!< json output
     virtual void sync(EnergyTerm* other_energy,
                       const Change& change); //!< Sync (copy from) another energy instance
@@ -84,10 +96,15 @@ std::function<double(const Particle&)> createGouyChapmanPotential(const json& j,
 
 /**
  * @brief Custom external potential on molecules
+ *
+ * Expressions can optionally be tabulated on a grid spanning the simulation container; one
+ * grid is created for each charge that atoms (or molecules if `com=true`) may have. Particles
+ * with other charges, or outside the grid, use the exact expression.
  */
 class CustomExternal : public ExternalPotential
 {
   private:
+    using Grid = Tabulate::Grid<double>;
     std::unique_ptr<ExprFunction<double>> expr;
 
     struct ParticleData
@@ -96,7 +113,10 @@ class CustomExternal : public ExternalPotential
     };
 
     ParticleData particle_data;
-    json json_input_backup; // initial json input
+    json json_input_backup;                     // initial json input
+    std::vector<std::pair<double, Grid>> grids; //!< Tabulated expression for each charge
+    double exactEnergy(const Particle& particle); //!< Evaluate expression
+    void tabulate(const json& j);                 //!< Tabulate expression on grids
 
   public:
     CustomExternal(const json&, Space&);
@@ -6,6 +6,8 @@
 #include "docopt.h"
 #include "move.h"
 #include "actions.h"
+#include "replicaexchange.h"
+#include "checkpoint.h"
 #include <doctest/doctest.h>
 #include <progress_tracker.h>
 #include <spdlog/spdlog.h>
@@ -45,10 +47,16 @@ void showProgress(std::shared_ptr<ProgressIndicator::ProgressTracker>& progress_
 void playRetroMusic();
 template <typename TimePoint>
 void saveOutput(TimePoint& starting_time, docopt::Options& args, MetropolisMonteCarlo& simulation,
-                const analysis::CombinedAnalysis& analysis);
+                const analysis::CombinedAnalysis& analysis,
+                const ReplicaExchange* replica_exchange = nullptr);
 
 void mainLoop(bool show_progress, const json& json_in, MetropolisMonteCarlo& simulation,
               analysis::CombinedAnalysis& analysis);
+void replicaExchangeLoop(bool show_progress, const json& json_in, ReplicaExchange& replica_exchange,
+                         MetropolisMonteCarlo::State& state, analysis::CombinedAnalysis& analysis);
+template <typename TimePoint>
+void runReplicaExchange(TimePoint& starting_time, docopt::Options& args, const json& input,
+                        bool show_progress);
 
 static const char USAGE[] =
     R"(Faunus - the Monte Carlo code you're looking for!
@@ -64,7 +72,7 @@ static const char USAGE[] =
     Options:
       -i <file> --input <file>         Input file [default: /dev/stdin].
       -o <file> --output <file>        Output file [default: out.json].
-      -s <file> --state <file>         State file to start from (.json/.ubj).
+      -s <file> --state <file>         State file to start from (.json/.ubj/.cpt).
       -p <file> --positions <file>     Overwrite initial positions (xyz, gro, etc.).
       -v <N> --verbosity <N>           Log verbosity level (0 = off, 1 = critical, ..., 6 = trace) [default: 4]
       -q --quiet                       Less verbose output. It implicates -v0 --nobar --notips --nofun.
@@ -104,6 +112,17 @@ int main(int argc, const char** argv)
         pc::temperature = input.at("temperature").get<double>() * 1.0_K;
         setRandomNumberGenerator(input);
 
+        bool show_progress = !quiet && !args["--nobar"].asBool();
+#ifdef ENABLE_MPI
+        if (!Faunus::MPI::mpi.isMaster()) {
+            show_progress = false; // show progress only for root rank
+        }
+#endif
+        if (input.contains("replicaexchange")) {
+            runReplicaExchange(starting_time, args, input, show_progress);
+            return EXIT_SUCCESS;
+        }
+
         MetropolisMonteCarlo simulation(input);
         loadState(args, simulation);
         prefaceActions(input["preface"], simulation.getSpace(), simulation.getHamiltonian());
@@ -111,12 +130,6 @@ int main(int argc, const char** argv)
         analysis::CombinedAnalysis analysis(input.at("analysis"), simulation.getSpace(),
                                             simulation.getHamiltonian());
 
-        bool show_progress = !quiet && !args["--nobar"].asBool();
-#ifdef ENABLE_MPI
-        if (!Faunus::MPI::mpi.isMaster()) {
-            show_progress = false; // show progress only for root rank
-        }
-#endif
         if (!args["--norun"].asBool()) {
             mainLoop(show_progress, input, simulation, analysis); // run simulation!
             saveOutput(starting_time, args, simulation, analysis);
@@ -241,6 +254,66 @@ void mainLoop(bool show_progress, const json& json_in, MetropolisMonteCarlo& sim
     faunus_logger->log(level, "relative energy drift = {:.3E}", simulation.relativeEnergyDrift());
 }
 
+/**
+ * Analysis is performed on `state` which, after each sweep, is overwritten by the replica
+ * currently sampling the first temperature.
+ */
+void replicaExchangeLoop(bool show_progress, const json& json_in, ReplicaExchange& replica_exchange,
+                         MetropolisMonteCarlo::State& state, analysis::CombinedAnalysis& analysis)
+{
+    const auto& loop = json_in.at("mcloop");
+    const auto macro = loop.at("macro").get<int>();
+    const auto micro = loop.at("micro").get<int>();
+    auto progress_tracker = createProgressTracker(show_progress, macro * micro);
+    for (int i = 0; i < macro; i++) {
+        for (int j = 0; j < micro; j++) {
+            replica_exchange.sweep();
+            replica_exchange.copyState(0, state);
+            analysis.sample();
+            showProgress(progress_tracker);
+        } // end of micro steps
+        analysis.to_disk(); // save analysis to disk
+    } // end of macro steps
+    if (progress_tracker) {
+        progress_tracker->done();
+    }
+    const double drift_tolerance = 1e-9;
+    for (std::size_t slot = 0; slot < replica_exchange.size(); ++slot) {
+        const auto drift = replica_exchange.at(slot).relativeEnergyDrift();
+        const auto level = drift < drift_tolerance ? spdlog::level::info : spdlog::level::warn;
+        faunus_logger->log(level, "relative energy drift at {} K = {:.3E}",
+                           replica_exchange.getTemperature(slot), drift);
+    }
+}
+
+/**
+ * All replicas are set up exactly as an ordinary simulation, i.e. with state loading and
+ * preface actions. The output file describes the replica at the first temperature.
+ */
+template <typename TimePoint>
+void runReplicaExchange(TimePoint& starting_time, docopt::Options& args, const json& input,
+                        bool show_progress)
+{
+    ReplicaExchange replica_exchange(input, input["replicaexchange"]);
+    for (std::size_t slot = 0; slot < replica_exchange.size(); ++slot) {
+        auto& simulation = replica_exchange.at(slot);
+        loadState(args, simulation);
+        prefaceActions(input["preface"], simulation.getSpace(), simulation.getHamiltonian());
+        checkElectroNeutrality(simulation);
+    }
+    MetropolisMonteCarlo::State state;
+    const auto log_level = faunus_logger->level();
+    faunus_logger->set_level(spdlog::level::off); // do not duplicate log info
+    from_json(input, state);
+    faunus_logger->set_level(log_level);
+    replica_exchange.copyState(0, state);
+    analysis::CombinedAnalysis analysis(input.at("analysis"), *state.spc, *state.pot);
+    if (!args["--norun"].asBool()) {
+        replicaExchangeLoop(show_progress, input, replica_exchange, state, analysis);
+        saveOutput(starting_time, args, replica_exchange.at(0), analysis, &replica_exchange);
+    }
+}
+
 void showProgress(std::shared_ptr<ProgressIndicator::ProgressTracker>& progress_tracker)
 {
     if (progress_tracker && (++(*progress_tracker) % 10 == 0)) {
@@ -435,7 +508,11 @@ void loadState(docopt::Options& args, MetropolisMonteCarlo& simulation)
         if (binary) {
             mode = std::ios_base::ate | std::ios_base::binary; // ate = open at end
         }
-        if (auto stream = std::ifstream(statefile, mode)) {
+        if (suffix == "cpt") {
+            faunus_logger->info("loading checkpoint {}", statefile);
+            simulation.restore(Checkpoint::Reader(statefile)); // memory mapped; no json parsing
+        }
+        else if (auto stream = std::ifstream(statefile, mode)) {
             json j;
             faunus_logger->info("loading state file {}", statefile);
             if (binary) {
@@ -472,7 +549,8 @@ void prefaceActions(const json& input, Space& spc, Energy::Hamiltonian& hamilton
 
 template <typename TimePoint>
 void saveOutput(TimePoint& starting_time, docopt::Options& args, MetropolisMonteCarlo& simulation,
-                const analysis::CombinedAnalysis& analysis)
+                const analysis::CombinedAnalysis& analysis,
+                const ReplicaExchange* replica_exchange)
 {
 
     if (std::ofstream stream(Faunus::MPI::prefix + args["--output"].asString()); stream) {
@@ -480,6 +558,9 @@ void saveOutput(TimePoint& starting_time, docopt::Options& args, MetropolisMonte
         to_json(j, simulation);
         j["relative drift"] = simulation.relativeEnergyDrift();
         j["analysis"] = analysis;
+        if (replica_exchange != nullptr) {
+            j["replicaexchange"] = *replica_exchange;
+        }
 #ifdef GIT_COMMIT_HASH
         j["git revision"] = GIT_COMMIT_HASH;
 #endif
@@ -120,6 +120,9 @@ void LangevinVelocityVerlet::step(PointVector& velocities, PointVector& forces)
         particle.pos += positionIncrement(velocity);               // A step
         spc.geometry.boundary(particle.pos);
     }
+    for (auto& group : spc.groups) { // group cutoffs used for the forces require mass centers
+        group.updateMassCenter(spc.geometry.getBoundaryFunc());
+    }
     std::fill(forces.begin(), forces.end(), Point::Zero()); // forces must be updated ...
     energy.force(forces);                                   // ... before each B step
 
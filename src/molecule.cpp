@@ -771,6 +771,8 @@ ExclusionsVicinity::ExclusionsVicinity(int atoms_cnt, int max_difference)
     : atoms_cnt(atoms_cnt)
     , max_bond_distance(max_difference)
     , excluded_pairs(std::make_shared<std::vector<char_bool>>())
+    , partners(std::make_shared<std::vector<int>>())
+    , partners_offset(std::make_shared<std::vector<int>>())
 {
     faunus_logger->log(atoms_cnt * max_difference < 1'000'000 ? spdlog::level::trace
                                                               : spdlog::level::warn,
@@ -778,9 +780,10 @@ ExclusionsVicinity::ExclusionsVicinity(int atoms_cnt, int max_difference)
                        max_difference, atoms_cnt, max_difference);
 
     excluded_pairs->resize(atoms_cnt * max_difference, static_cast<char_bool>(false));
+    updatePartners();
 }
 
-void ExclusionsVicinity::add(int i, int j)
+void ExclusionsVicinity::addPair(int i, int j)
 {
     if (i > j) {
         std::swap(i, j);
@@ -791,11 +794,39 @@ void ExclusionsVicinity::add(int i, int j)
     excluded_pairs->at(toIndex(i, j)) = static_cast<unsigned char>(true);
 }
 
+void ExclusionsVicinity::add(int i, int j)
+{
+    addPair(i, j);
+    updatePartners();
+}
+
 void ExclusionsVicinity::add(const std::vector<AtomPair>& pairs)
 {
     for (const auto& pair : pairs) {
-        add(pair.first, pair.second);
+        addPair(pair.first, pair.second);
+    }
+    updatePartners();
+}
+
+/**
+ * New vectors are created as the current ones may be shared with copies of this object.
+ */
+void ExclusionsVicinity::updatePartners()
+{
+    partners = std::make_shared<std::vector<int>>();
+    partners_offset = std::make_shared<std::vector<int>>();
+    partners_offset->reserve(atoms_cnt + 1);
+    for (int i = 0; i < atoms_cnt; ++i) {
+        partners_offset->push_back(static_cast<int>(partners->size()));
+        const auto first = std::max(0, i - max_bond_distance);
+        const auto last = std::min(atoms_cnt, i + max_bond_distance + 1);
+        for (int j = first; j < last; ++j) {
+            if (j != i && !isExcluded(i, j)) {
+                partners->push_back(j);
+            }
+        }
     }
+    partners_offset->push_back(static_cast<int>(partners->size()));
 }
 
 void to_json(json& j, const ExclusionsVicinity& exclusions)
@@ -820,6 +851,40 @@ TEST_CASE("[Faunus] ExclusionsVicinity")
     CHECK_FALSE(exclusions.isExcluded(2, 3));
     CHECK_FALSE(exclusions.isExcluded(4, 5));
     CHECK_FALSE(exclusions.isExcluded(8, 9));
+
+    SUBCASE("forEachPartner")
+    {
+        auto partners_of = [&](int i, int first, int last) {
+            std::vector<int> partners;
+            exclusions.forEachPartner(i, first, last, [&](int j) { partners.push_back(j); });
+            return partners;
+        };
+        for (int i = 0; i < 10; ++i) { // compare with exclusion matrix
+            std::vector<int> expected;
+            for (int j = 0; j < 10; ++j) {
+                if (j != i && !exclusions.isExcluded(i, j)) {
+                    expected.push_back(j);
+                }
+            }
+            CHECK_EQ(partners_of(i, 0, 10), expected);
+        }
+        CHECK_EQ(partners_of(1, 0, 10), std::vector<int>{4, 5, 6, 7, 8, 9});
+        CHECK_EQ(partners_of(1, 3, 6), std::vector<int>{4, 5});
+        CHECK_EQ(partners_of(6, 5, 9), std::vector<int>{5, 8});
+        CHECK(partners_of(6, 7, 8).empty());
+        CHECK(partners_of(6, 4, 4).empty());
+
+        ExclusionsVicinity no_exclusions(4);
+        std::vector<int> partners;
+        no_exclusions.forEachPartner(2, 0, 4, [&](int j) { partners.push_back(j); });
+        CHECK_EQ(partners, std::vector<int>{0, 1, 3});
+
+        partners.clear();
+        ExclusionsVicinity default_exclusions; // no partner lists
+        default_exclusions.forEachPartner(2, 0, 4, [&](int j) { partners.push_back(j); });
+        CHECK_EQ(partners, std::vector<int>{0, 1, 3});
+        CHECK_EQ(partners_of(11, 8, 13), std::vector<int>{8, 9, 10, 12}); // i beyond molecule
+    }
 }
 
 void from_json(const json& j, MoleculeInserter& inserter)
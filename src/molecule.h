@@ -4,6 +4,7 @@
 #include "auxiliary.h"
 #include "particle.h"
 #include "random.h"
+#include <algorithm>
 #include <set>
 
 namespace Faunus {
@@ -136,6 +137,10 @@ void to_json(json& j, const ExclusionsSimple& exclusions);
  * pairs has dimensions of number of atoms × maximal distance between excluded neighbours (in terms
  * of atom indices within the molecule).
  *
+ * For fast iteration over interacting pairs, the non-excluded partners of each atom within the
+ * maximal distance are additionally stored as a compressed list. All atoms further away are never
+ * excluded and can be visited without any lookup, see `forEachPartner()`.
+ *
  * @internal MoleculeData uses this class internally.
  */
 class ExclusionsVicinity
@@ -150,9 +155,13 @@ class ExclusionsVicinity
     int max_bond_distance = 0; //!< max distance (difference) between indices of excluded particles
     std::shared_ptr<std::vector<char_bool>>
         excluded_pairs; //!< 1D exclusion matrix; shared ptr saves copying
+    std::shared_ptr<std::vector<int>> partners; //!< Sorted non-excluded atoms within vicinity
+    std::shared_ptr<std::vector<int>> partners_offset; //!< Partners of i: [offset[i], offset[i+1])
 
     int toIndex(int i, int j) const;
     AtomPair fromIndex(int n) const;
+    void addPair(int i, int j);
+    void updatePartners(); //!< Regenerate partner lists from exclusion matrix
 
   public:
     /** Generates memory-optimal structure from underlying pair list.
@@ -174,9 +183,51 @@ class ExclusionsVicinity
                     int j)
         const; //!< @param i, j indices of atoms within molecule with excluded nonbonded interaction
     bool empty() const; //!< true if no excluded interactions at all
+
+    /**
+     * @brief Calls `function(j)` for all atoms j in [first, last) that are not excluded with i
+     *
+     * The atom i itself is never visited. Visiting order is ascending.
+     *
+     * @param i index of atom within molecule
+     * @param first, last range of atom indices within molecule to visit
+     * @param function callable taking an atom index, `int`
+     */
+    template <typename TFunction>
+    void forEachPartner(int i, int first, int last, TFunction&& function) const;
     friend void to_json(json& j, const ExclusionsVicinity& exclusions);
 };
 
+template <typename TFunction>
+void ExclusionsVicinity::forEachPartner(const int i, const int first, const int last,
+                                        TFunction&& function) const
+{
+    if (empty() || i >= atoms_cnt) { // no partner lists, e.g. default constructed
+        for (int j = first; j < last; ++j) {
+            if (j != i) {
+                function(j);
+            }
+        }
+        return;
+    }
+    const auto vicinity_first = std::max(first, i - max_bond_distance);
+    const auto vicinity_last = std::min(last, i + max_bond_distance + 1);
+    for (int j = first; j < std::min(vicinity_first, last); ++j) {
+        function(j);
+    }
+    if (vicinity_first < vicinity_last) {
+        const auto partners_first = partners->begin() + (*partners_offset)[i];
+        const auto partners_last = partners->begin() + (*partners_offset)[i + 1];
+        for (auto it = std::lower_bound(partners_first, partners_last, vicinity_first);
+             it != partners_last && *it < vicinity_last; ++it) {
+            function(*it);
+        }
+    }
+    for (int j = std::max(first, vicinity_last); j < last; ++j) {
+        function(j);
+    }
+}
+
 inline bool ExclusionsVicinity::isExcluded(int i, int j) const
 {
     if (i > j) {
@@ -248,6 +299,14 @@ class MoleculeData
 
     bool isImplicit() const; //!< Is molecule implicit and explicitly absent from simulation cell?
     bool isPairExcluded(int i, int j) const;
+
+    //! Calls `function(j)` for all atoms j in [first, last) not excluded with atom i
+    //! @see ExclusionsVicinity::forEachPartner
+    template <typename TFunction>
+    void forEachNonExcludedPartner(int i, int first, int last, TFunction&& function) const
+    {
+        exclusions.forEachPartner(i, first, last, std::forward<TFunction>(function));
+    }
     bool isMolecular() const;
     bool isAtomic() const;
 
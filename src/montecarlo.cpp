@@ -1,6 +1,7 @@
 #include "montecarlo.h"
 #include "energy.h"
 #include "move.h"
+#include "checkpoint.h"
 #include <spdlog/spdlog.h>
 
 namespace Faunus {
@@ -79,6 +80,36 @@ void MetropolisMonteCarlo::init()
  *
  * @return Relative energy drift
  */
+/**
+ * The energy is the initial energy plus the sum of all accepted energy changes and is
+ * therefore obtained without evaluating the Hamiltonian.
+ */
+double MetropolisMonteCarlo::getEnergy() const
+{
+    return initial_energy + sum_of_energy_changes;
+}
+
+/**
+ * Energies are always in units of kT at the global temperature, `pc::temperature`, whereas
+ * the Metropolis criterion uses energy changes scaled by `pc::temperature / temperature`.
+ * This allows simulation of several temperatures within the same process, assuming that
+ * the Hamiltonian itself is temperature independent.
+ *
+ * @param temperature Temperature (K) to sample
+ */
+void MetropolisMonteCarlo::setTemperature(const double temperature)
+{
+    if (temperature <= 0.0) {
+        throw std::range_error("temperature must be positive");
+    }
+    energy_scaling = pc::temperature / (temperature * 1.0_K);
+}
+
+double MetropolisMonteCarlo::getTemperature() const
+{
+    return pc::temperature / energy_scaling / 1.0_K;
+}
+
 double MetropolisMonteCarlo::relativeEnergyDrift()
 {
     Change change;            // change object where ...
@@ -100,7 +131,11 @@ MetropolisMonteCarlo::MetropolisMonteCarlo(const json& j)
 {
     state = std::make_unique<State>(j);
     faunus_logger->set_level(spdlog::level::off); // do not duplicate log info
-    trial_state = std::make_unique<State>(j);     // ...for the trial state
+    trial_state = std::make_unique<State>();      // ...for the trial state
+    trial_state->spc = std::make_unique<Space>(j);
+    // both states share a single thread pool, so `threads: N` starts N threads in total
+    trial_state->pot = std::make_unique<Energy::Hamiltonian>(*trial_state->spc, j.at("energy"),
+                                                             state->pot->threadPool());
     faunus_logger->set_level(original_log_level); // restore original log level
     moves = std::make_unique<move::MoveCollection>(j.at("moves"), *trial_state->spc,
                                                    *trial_state->pot, *state->spc);
@@ -133,6 +168,29 @@ void MetropolisMonteCarlo::restore(const json& j)
     }
 }
 
+/**
+ * Same as restoring from a json state, but particles and groups are read from a binary,
+ * memory mapped checkpoint. The Hamiltonian is rebuilt for the restored configuration.
+ */
+void MetropolisMonteCarlo::restore(const Checkpoint::Reader& checkpoint)
+{
+    try {
+        checkpoint.load(*state->spc);
+        checkpoint.load(*trial_state->spc);
+        const auto metadata = checkpoint.metadata();
+        if (metadata.contains("random-move")) {
+            move::Move::slump = metadata["random-move"];
+        }
+        if (metadata.contains("random-global")) {
+            Faunus::random = metadata["random-global"];
+        }
+        init();
+    }
+    catch (std::exception& e) {
+        throw std::runtime_error("error initialising simulation: "s + e.what());
+    }
+}
+
 void MetropolisMonteCarlo::performMove(move::Move& move)
 {
     Change change;
@@ -148,8 +206,8 @@ void MetropolisMonteCarlo::performMove(move::Move& move)
     if (change) {
         latest_move_name = move.getName();
         trial_state->pot->updateState(change); // update energy terms to reflect change
-        const auto new_energy = trial_state->pot->energy(change); // trial potential energy (kT)
-        const auto old_energy = state->pot->energy(change); // potential energy before move (kT)
+        // trial potential energy and potential energy before move (kT)
+        const auto [new_energy, old_energy] = trial_state->pot->energyChange(*state->pot, change);
 
         auto energy_change = getEnergyChange(new_energy, old_energy);
 
@@ -157,7 +215,7 @@ void MetropolisMonteCarlo::performMove(move::Move& move)
             move.bias(change, old_energy, new_energy) +
             TranslationalEntropy(*trial_state->spc, *state->spc).energy(change);
 
-        const auto total_trial_energy = energy_change + energy_bias;
+        const auto total_trial_energy = energy_change * energy_scaling + energy_bias;
         if (std::isnan(total_trial_energy)) {
             faunus_logger->error("NaN energy change in {} move.", move.getName());
         }
@@ -253,7 +311,7 @@ void MetropolisMonteCarlo::State::sync(const State& other, const Change& change)
 void to_json(json& j, const MetropolisMonteCarlo& monte_carlo)
 {
     j = monte_carlo.state->spc->info();
-    j["temperature"] = pc::temperature / 1.0_K;
+    j["temperature"] = monte_carlo.getTemperature();
     if (monte_carlo.moves) {
         j["moves"] = *monte_carlo.moves;
     }
@@ -305,10 +363,8 @@ double TranslationalEntropy::atomSwapEnergy(const Change::GroupChange& group_cha
     int id2 =
         spc.groups.at(group_change.group_index).at(group_change.relative_atom_indices.front()).id;
     for (auto atomid : {id1, id2}) {
-        auto atoms_new = trial_spc.findAtoms(atomid);
-        auto atoms_old = spc.findAtoms(atomid);
-        int N_new = range_size(atoms_new); // number of atoms after change
-        int N_old = range_size(atoms_old); // number of atoms before change
+        const auto N_new = static_cast<int>(trial_spc.countAtoms(atomid)); // after change
+        const auto N_old = static_cast<int>(spc.countAtoms(atomid));       // before change
         energy += bias(N_new, N_old);
     }
     return energy; // kT
@@ -330,10 +386,8 @@ double TranslationalEntropy::atomChangeEnergy(const int molid) const
 
 double TranslationalEntropy::moleculeChangeEnergy(const int molid) const
 {
-    auto mollist_new = trial_spc.findMolecules(molid, Space::Selection::ACTIVE);
-    auto mollist_old = spc.findMolecules(molid, Space::Selection::ACTIVE);
-    int N_new = range_size(mollist_new); // number of molecules after move
-    int N_old = range_size(mollist_old); // number of molecules before move
+    const auto N_new = static_cast<int>(trial_spc.numActiveMolecules(molid)); // after move
+    const auto N_old = static_cast<int>(spc.numActiveMolecules(molid));       // before move
     return bias(N_new, N_old);
 }
 
@@ -16,6 +16,10 @@ class Move;
 class MoveCollection;
 } // namespace move
 
+namespace Checkpoint {
+class Reader;
+}
+
 /**
  * @brief Class to handle Monte Carlo moves
  *
@@ -67,6 +71,7 @@ class MetropolisMonteCarlo
     double sum_of_energy_changes = 0.0;           //!< Sum of all potential energy changes
     double initial_energy = 0.0;                  //!< Initial potential energy
     Average<double> average_energy;               //!< Average potential energy of the system
+    double energy_scaling = 1.0;                  //!< Energy prefactor in Metropolis; T_ref/T
     void init();                                  //!< Reset state
     void performMove(move::Move& move);           //!< Perform move using given move implementation
     double getEnergyChange(double new_energy, double old_energy) const;
@@ -79,8 +84,13 @@ class MetropolisMonteCarlo
     Space& getSpace();                     //!< Access to space in accepted (default) state
     Space& getTrialSpace();                //!< Access to trial space
     double relativeEnergyDrift();          //!< Relative energy drift from initial configuration
+    double getEnergy() const;              //!< Tracked potential energy (kT)
+    void setTemperature(double temperature); //!< Sample at given temperature (K)
+    double getTemperature() const;         //!< Temperature that is sampled (K)
     void sweep();                          //!< Perform all moves (stochastic and static)
     void restore(const json& j);           //!< Restores system from previously store json object
+    //! Restores system from a binary checkpoint file
+    void restore(const Checkpoint::Reader& checkpoint);
     static bool metropolisCriterion(double energy_change); //!< Metropolis criterion
     ~MetropolisMonteCarlo(); //!< Required due to unique_ptr to incomplete type
 };
@@ -104,7 +114,7 @@ void to_json(json&, const MetropolisMonteCarlo&);
  * logarithm of the bias to be included in the Metropolis criterion, so that it
  * can be *added* to the potential energy.
  *
- * @note `Space::findMolecules` has O(N) complexity for non-atomic molecules; otherwise constant
+ * @note Atom and molecule counts are looked up in the `Space` registries in constant time
  * @todo
  * - [ ] Move to Energy namespace?
  * - [ ] Verify with volume fluctuations which would make `Energy::Isobaric` redundant
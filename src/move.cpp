@@ -16,7 +16,7 @@
 #endif
 namespace Faunus::move {
 
-Random Move::slump; // static instance of Random (shared for all moves)
+thread_local Random Move::slump = makeThreadLocalRandom(1); // shared for all moves in a thread
 
 void Move::from_json(const json& j)
 {
@@ -67,6 +67,9 @@ void Move::move(Change& change)
     number_of_attempted_moves++;
     change.clear();
     _move(change);
+    if (change.everything || change.matter_change) {
+        spc.updateInternalState(change); // keep molecule and atom registries up to date
+    }
     if (change.empty()) {
         timer.stop();
     }
@@ -990,6 +993,7 @@ void VolumeMove::_move(Change& change)
     if (logarithmic_volume_displacement_factor > 0.0) {
         change.volume_change = true;
         change.everything = true;
+        change.positions_only = true;
         setNewVolume();
         spc.scaleVolume(new_volume, volume_scaling_method);
     }
@@ -1411,11 +1415,8 @@ void QuadrantJump::_move(Change& change)
     _sqd = 0.0;
 
     // pick random group from the system matching molecule type
-    // TODO: This can be slow -- implement look-up-table in Space
-    auto mollist =
-        spc.findMolecules(molid, Space::Selection::ACTIVE); // list of molecules w. 'molid'
-    if (not std::ranges::empty(mollist)) {
-        auto it = slump.sample(mollist.begin(), mollist.end());
+    if (auto it = spc.randomMolecule(molid, slump, Space::Selection::ACTIVE);
+        it != spc.groups.end()) {
         if (not it->empty()) {
             assert(it->id == molid);
             Point oldcm = it->mass_center;
@@ -1600,16 +1601,11 @@ void TranslateRotate::_from_json(const json& j)
     }
 }
 
-/**
- * @todo `mollist` scales linearly w. system size -- implement look-up-table in Space?
- */
 TranslateRotate::OptionalGroup TranslateRotate::findRandomMolecule()
 {
-    if (auto mollist = spc.findMolecules(molid, Space::Selection::ACTIVE);
-        not std::ranges::empty(mollist)) {
-        if (auto group_it = random.sample(mollist.begin(), mollist.end()); not group_it->empty()) {
-            return *group_it;
-        }
+    if (auto group_it = spc.randomMolecule(molid, random, Space::Selection::ACTIVE);
+        group_it != spc.groups.end() && not group_it->empty()) {
+        return *group_it;
     }
     return std::nullopt;
 }
@@ -1766,6 +1762,57 @@ TEST_CASE("[Faunus] TranslateRotate")
     CHECK_EQ(j.at("repeat"), 2);
     CHECK_EQ(j.at("dprot"), 0.5);
 }
+
+TEST_CASE("[Faunus] Move::move")
+{
+    using namespace Faunus;
+    atoms = R"([{"A": {}}, {"B": {}}])"_json.get<decltype(atoms)>();
+    molecules = R"([{"M": {"atoms": ["A", "B"], "atomic": true}}])"_json.get<decltype(molecules)>();
+
+    // replaces the whole state like `ParallelTempering::exchangeState`
+    class ExchangeState : public move::Move
+    {
+        void _move(Change& change) override
+        {
+            spc.groups[0].resize(0); // group sizes change...
+            spc.particles[2].id = 1; // ...and so do atom ids
+            change.everything = true;
+        }
+        void _to_json(json&) const override {}
+        void _from_json(const json&) override {}
+
+      public:
+        explicit ExchangeState(Space& spc)
+            : Move(spc, "exchange", "")
+        {
+        }
+    };
+
+    ParticleVector particles(2);
+    particles[1].id = 1;
+    Space spc;
+    Space accepted_spc;
+    for (auto* space : {&spc, &accepted_spc}) {
+        for (int i = 0; i < 3; ++i) {
+            space->addGroup(0, particles);
+        }
+    }
+    auto check_registries = [](Space& space) {
+        CHECK_EQ(space.countAtoms(0), 1);
+        CHECK_EQ(space.countAtoms(1), 3);
+        CHECK_EQ(space.numActiveMolecules(0), 2);
+        auto inactive = space.findMolecules(0, Space::Selection::INACTIVE);
+        REQUIRE_EQ(std::ranges::distance(inactive), 1);
+        CHECK_EQ(&*inactive.begin(), &space.groups[0]);
+    };
+    ExchangeState exchange(spc);
+    Change change;
+    exchange.move(change);
+    check_registries(spc);
+    exchange.accept(change);
+    accepted_spc.sync(spc, change);
+    check_registries(accepted_spc);
+}
 #endif
 
 namespace Faunus::move {
@@ -62,7 +62,7 @@ class Move
     unsigned long number_of_attempted_moves = 0; //!< Counter for total number of move attempts
 
   public:
-    static Random slump; //!< Shared for all moves
+    static thread_local Random slump; //!< Shared for all moves in a thread
 
     void from_json(const json& j);
     void to_json(json& j) const; //!< JSON report w. statistics, output etc.
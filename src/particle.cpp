@@ -3,10 +3,13 @@
 #include "rotate.h"
 #include "units.h"
 #include "aux/eigensupport.h"
+#include <atomic>
 #include <fstream>
+#include <thread>
 #include <Eigen/Geometry>
 #include <cereal/types/memory.hpp>
 #include <cereal/archives/binary.hpp>
+#include <nanobench.h>
 
 namespace Faunus {
 
@@ -182,6 +185,150 @@ bool Cigar::isCylindrical() const
     return half_length > pc::epsilon_dbl;
 }
 
+/**
+ * Free slots owned by a single thread. The number of slots is mirrored in an atomic so that
+ * `size()` can be called from any thread. When the thread exits, all slots are returned to
+ * the pool.
+ */
+struct ParticleExtensionPool::ThreadCache
+{
+    std::vector<Slot*> free_slots;                    //!< Last one is reused first
+    std::atomic<std::size_t> number_of_free_slots{0}; //!< Written by owning thread only
+    static thread_local bool destroyed;               //!< Set once the cache is gone
+
+    ThreadCache()
+    {
+        auto& pool = instance();
+        std::lock_guard lock(pool.mutex);
+        pool.thread_caches.push_back(this);
+    }
+
+    ~ThreadCache()
+    {
+        auto& pool = instance();
+        std::lock_guard lock(pool.mutex);
+        pool.moveToPool(free_slots, free_slots.size());
+        std::erase(pool.thread_caches, this);
+        destroyed = true;
+    }
+
+    void updateCount()
+    {
+        number_of_free_slots.store(free_slots.size(), std::memory_order_relaxed);
+    }
+};
+
+thread_local bool ParticleExtensionPool::ThreadCache::destroyed = false;
+
+/**
+ * Particles with static or thread storage duration may release their extensions after the
+ * cache of the thread is destroyed; such slots bypass the cache.
+ */
+ParticleExtensionPool::ThreadCache* ParticleExtensionPool::threadCache()
+{
+    if (ThreadCache::destroyed) {
+        return nullptr;
+    }
+    thread_local ThreadCache cache;
+    return &cache;
+}
+
+/**
+ * Move free slots from the pool to a thread, adding a chunk if needed. The lowest addresses
+ * end up last and are handed out first. `mutex` must be locked.
+ */
+void ParticleExtensionPool::moveToThread(std::vector<Slot*>& thread_slots,
+                                         const std::size_t number_of_slots)
+{
+    if (free_slots.size() < number_of_slots) {
+        auto& chunk = chunks.emplace_back(std::make_unique<Slot[]>(chunk_size));
+        free_slots.reserve(chunks.size() * chunk_size);
+        for (auto i = chunk_size; i > 0; --i) { // lowest address is handed out first
+            free_slots.push_back(&chunk[i - 1]);
+        }
+    }
+    const auto first = free_slots.end() - static_cast<std::ptrdiff_t>(number_of_slots);
+    thread_slots.insert(thread_slots.end(), first, free_slots.end());
+    free_slots.erase(first, free_slots.end());
+}
+
+/** Move the least recently freed slots of a thread to the pool; `mutex` must be locked */
+void ParticleExtensionPool::moveToPool(std::vector<Slot*>& thread_slots,
+                                       const std::size_t number_of_slots)
+{
+    const auto last = thread_slots.begin() + static_cast<std::ptrdiff_t>(number_of_slots);
+    free_slots.insert(free_slots.end(), thread_slots.begin(), last);
+    thread_slots.erase(thread_slots.begin(), last);
+}
+
+ParticleExtensionPool::value_type* ParticleExtensionPool::allocate()
+{
+    auto* cache = threadCache();
+    if (cache == nullptr) {
+        std::vector<Slot*> slot;
+        std::lock_guard lock(mutex);
+        moveToThread(slot, 1);
+        return reinterpret_cast<value_type*>(slot.front());
+    }
+    if (cache->free_slots.empty()) {
+        std::lock_guard lock(mutex);
+        moveToThread(cache->free_slots, batch_size);
+    }
+    auto* slot = cache->free_slots.back();
+    cache->free_slots.pop_back();
+    cache->updateCount();
+    return reinterpret_cast<value_type*>(slot);
+}
+
+void ParticleExtensionPool::release(value_type* slot)
+{
+    auto* cache = threadCache();
+    if (cache == nullptr) {
+        std::lock_guard lock(mutex);
+        free_slots.push_back(reinterpret_cast<Slot*>(slot));
+        return;
+    }
+    cache->free_slots.push_back(reinterpret_cast<Slot*>(slot));
+    if (cache->free_slots.size() > 2 * batch_size) {
+        std::lock_guard lock(mutex);
+        moveToPool(cache->free_slots, batch_size);
+    }
+    cache->updateCount();
+}
+
+void ParticleExtensionPool::destroy(value_type* extension)
+{
+    extension->~value_type();
+    release(extension);
+}
+
+std::size_t ParticleExtensionPool::capacity() const
+{
+    std::lock_guard lock(mutex);
+    return chunks.size() * chunk_size;
+}
+
+/** Exact only if no other thread is allocating or releasing extensions concurrently */
+std::size_t ParticleExtensionPool::size() const
+{
+    std::lock_guard lock(mutex);
+    auto number_of_free_slots = free_slots.size();
+    for (const auto* cache : thread_caches) {
+        number_of_free_slots += cache->number_of_free_slots.load(std::memory_order_relaxed);
+    }
+    return chunks.size() * chunk_size - number_of_free_slots;
+}
+
+/**
+ * The pool is intentionally never destroyed as particles with static storage duration
+ * may outlive it.
+ */
+ParticleExtensionPool& ParticleExtensionPool::instance()
+{
+    static auto* pool = new ParticleExtensionPool();
+    return *pool;
+}
+
 const AtomData& Particle::traits() const
 {
     return atoms[id];
@@ -207,11 +354,11 @@ Particle::Particle(const Particle& other)
     , pos(other.pos)
 {
     if (other.hasExtension()) {
-        ext = std::make_unique<Particle::ParticleExtension>(other.getExt()); // deep copy
+        ext.emplace(other.getExt()); // deep copy
     }
 }
 
-Particle& Particle::operator=(const Particle& other)
+Particle& Particle::assignWithExtension(const Particle& other)
 {
     if (&other != this) {
         charge = other.charge;
@@ -222,8 +369,7 @@ Particle& Particle::operator=(const Particle& other)
                 *ext = other.getExt(); // deep copy
             }
             else { // else if *this is empty, create new based on p
-                ext = std::make_unique<Particle::ParticleExtension>(
-                    other.getExt()); // create and deep copy
+                ext.emplace(other.getExt()); // create and deep copy
             }
         }
         else { // other doesn't have extended properties
@@ -256,7 +402,7 @@ bool Particle::hasExtension() const
 Particle::ParticleExtension& Particle::createExtension()
 {
     if (!ext) {
-        ext = std::make_unique<ParticleExtension>();
+        ext.emplace();
     }
     return *ext;
 }
@@ -268,7 +414,7 @@ void from_json(const json& j, Particle& particle)
     particle.pos = j.value("pos", Point::Zero().eval());
     particle.charge = j.value("q", 0.0);
     if (j.contains("psc") || j.contains("mu") || j.contains("Q") || j.contains("scdir")) {
-        particle.ext = std::make_unique<Particle::ParticleExtension>(j);
+        particle.ext.emplace(j);
         // delete extension if not in use:
         if (!particle.ext->isCylindrical() && !particle.ext->isDipolar() &&
             !particle.ext->isQuadrupolar() && !particle.ext->isQuadrupolar()) {
@@ -287,6 +433,35 @@ void to_json(json& j, const Particle& particle)
     j["q"] = particle.charge;
 }
 
+std::size_t ParticleArrays::size() const
+{
+    return id.size();
+}
+
+void ParticleArrays::resize(const std::size_t size)
+{
+    x.resize(size);
+    y.resize(size);
+    z.resize(size);
+    charge.resize(size);
+    id.resize(size);
+}
+
+void ParticleArrays::update(const ParticleVector& particles)
+{
+    resize(particles.size());
+    update(particles, 0, particles.size());
+}
+
+void ParticleArrays::update(const ParticleVector& particles, const std::size_t first,
+                            const std::size_t last)
+{
+    assert(last <= particles.size() && last <= size());
+    for (auto index = first; index < last; ++index) {
+        update(index, particles[index]);
+    }
+}
+
 TEST_SUITE_BEGIN("Particle");
 
 TEST_CASE("[Faunus] Particle")
@@ -386,7 +561,7 @@ TEST_CASE("[Faunus] Particle")
         p.pos = {10, 20, 30};
         p.charge = -1;
         p.id = 8;
-        p.ext = std::make_unique<Particle::ParticleExtension>();
+        p.createExtension();
         p.getExt().mu = {0.1, 0.2, 0.3};
         p.getExt().mulen = 104;
 
@@ -420,6 +595,100 @@ TEST_CASE("[Faunus] Particle")
     }
 }
 
+TEST_CASE("[Faunus] ParticleExtensionPool")
+{
+    auto& pool = ParticleExtensionPool::instance();
+    const auto used_slots = pool.size();
+    {
+        ParticleVector particles(3);
+        particles[0].getExt().mulen = 1.0;
+        particles[2].getExt().mulen = 3.0;
+        CHECK_EQ(pool.size(), used_slots + 2);
+        CHECK_EQ(particles[1].ext, nullptr);
+
+        auto copy = particles; // deep copy
+        CHECK_EQ(pool.size(), used_slots + 4);
+        CHECK_NE(copy[0].ext.get(), particles[0].ext.get());
+        CHECK_EQ(copy[2].getExt().mulen, 3.0);
+
+        const auto* address = copy[0].ext.get();
+        copy[2].getExt().mulen = 0.0;
+        copy[0] = particles[2]; // assignment reuses existing slot
+        CHECK_EQ(copy[0].ext.get(), address);
+        CHECK_EQ(copy[0].getExt().mulen, 3.0);
+        CHECK_EQ(pool.size(), used_slots + 4);
+
+        copy[0] = particles[1]; // particle without extension releases slot
+        CHECK_EQ(copy[0].ext, nullptr);
+        CHECK_EQ(pool.size(), used_slots + 3);
+
+        auto moved = std::move(copy[2].ext);
+        CHECK_EQ(copy[2].ext, nullptr);
+        CHECK_EQ(pool.size(), used_slots + 3);
+    }
+    CHECK_EQ(pool.size(), used_slots);
+    CHECK_EQ(pool.capacity() % ParticleExtensionPool::chunk_size, 0);
+
+    ParticleVector particles(3 * ParticleExtensionPool::batch_size);
+    std::thread([&particles] {
+        for (auto& particle : particles) {
+            particle.getExt().mulen = 1.0;
+        }
+    }).join(); // slots cached by the exited thread are returned to the pool
+    CHECK_EQ(pool.size(), used_slots + particles.size());
+    particles.clear(); // slots from another thread are released into the cache of this thread
+    CHECK_EQ(pool.size(), used_slots);
+}
+
+#ifdef ANKERL_NANOBENCH_H_INCLUDED
+TEST_CASE("Benchmark ParticleExtensionPool")
+{
+    using Extension = ParticleExtensionPool::value_type;
+    constexpr std::size_t number_of_extensions = 1000;
+    ankerl::nanobench::Bench bench;
+    bench.minEpochIterations(100);
+    std::vector<std::unique_ptr<Extension>> heap(number_of_extensions);
+    bench.run("heap", [&] {
+        for (auto& extension : heap) {
+            extension = std::make_unique<Extension>();
+        }
+        for (auto& extension : heap) {
+            extension.reset();
+        }
+    });
+    std::vector<ParticleExtensionPointer> pool(number_of_extensions);
+    bench.run("pool", [&] {
+        for (auto& extension : pool) {
+            extension.emplace();
+        }
+        for (auto& extension : pool) {
+            extension.reset();
+        }
+    });
+}
+#endif
+
+TEST_CASE("[Faunus] ParticleArrays")
+{
+    ParticleVector particles(3);
+    particles[1].id = 4;
+    particles[1].charge = -1.0;
+    particles[1].pos = {1.0, 2.0, 3.0};
+
+    ParticleArrays arrays;
+    arrays.update(particles);
+    CHECK_EQ(arrays.size(), 3);
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(arrays.x.data()) % 64, 0);
+    CHECK_EQ(arrays.id[1], 4);
+    CHECK_EQ(arrays.charge[1], -1.0);
+    CHECK_EQ(arrays.y[1], 2.0);
+
+    particles[2].pos.z() = -5.0;
+    arrays.update(particles, 2, 3);
+    CHECK_EQ(arrays.z[2], -5.0);
+    CHECK_EQ(arrays.z[1], 3.0);
+}
+
 TEST_SUITE_END();
 
 } // namespace Faunus
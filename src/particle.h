@@ -2,7 +2,12 @@
 #include "core.h"
 #include "atomdata.h"
 #include "tensor.h"
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <mutex>
+#include <new>
+#include <utility>
 #include <spdlog/spdlog.h>
 #include <ranges>
 
@@ -224,21 +229,160 @@ template <typename... Properties> void from_json(const json& j, ParticleTemplate
     from_json<Properties...>(j, dynamic_cast<Properties&>(a)...);
 }
 
+/**
+ * @brief Pool of extended particle properties stored in contiguous chunks
+ *
+ * Extensions are placed in fixed-size chunks that are never moved or released, so slots
+ * keep their address for the lifetime of the program. Freed slots are recycled, which means
+ * that copying particles between the trial and accepted states, or resizing particle vectors,
+ * does not touch the heap once the pool has warmed up. Extensions of particles created in
+ * sequence end up adjacent in memory.
+ *
+ * Each thread takes and returns slots through a private cache, and the shared mutex is only
+ * locked when `batch_size` slots are moved between the cache and the pool. Allocation and
+ * release are thus thread safe without locking on every call; access to the extensions
+ * themselves is not synchronised.
+ */
+class ParticleExtensionPool
+{
+  public:
+    using value_type = ParticleTemplate<Dipole, Quadrupole, Cigar>;
+    static constexpr std::size_t chunk_size = 1024; //!< Number of extensions per chunk
+    static constexpr std::size_t batch_size = 64;   //!< Slots moved between pool and thread
+
+  private:
+    struct Slot
+    {
+        alignas(value_type) std::byte storage[sizeof(value_type)];
+    };
+    struct ThreadCache;
+    std::vector<std::unique_ptr<Slot[]>> chunks;   //!< Fixed-size blocks of storage
+    std::vector<Slot*> free_slots;                 //!< Unused slots; last one is reused first
+    std::vector<const ThreadCache*> thread_caches; //!< Caches of all running threads
+    mutable std::mutex mutex;                      //!< Guards all of the above
+    static ThreadCache* threadCache(); //!< Cache of calling thread; null if it has exited
+    void moveToThread(std::vector<Slot*>& thread_slots, std::size_t number_of_slots);
+    void moveToPool(std::vector<Slot*>& thread_slots, std::size_t number_of_slots);
+    value_type* allocate(); //!< Take an uninitialized slot from the pool
+
+  public:
+    template <typename... Args> value_type* create(Args&&... args)
+    {
+        auto* slot = allocate();
+        try {
+            return new (slot) value_type(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            release(slot);
+            throw;
+        }
+    } //!< Construct an extension in a pooled slot
+
+    void destroy(value_type* extension); //!< Destruct extension and return its slot
+    void release(value_type* slot);      //!< Return uninitialized slot to the pool
+    std::size_t capacity() const;        //!< Number of slots allocated so far
+    std::size_t size() const;            //!< Number of slots in use
+    static ParticleExtensionPool& instance(); //!< Pool shared by all particles
+};
+
+/**
+ * @brief Owning pointer to a particle extension residing in `ParticleExtensionPool`
+ *
+ * Behaves like `std::unique_ptr`, but storage is taken from the shared extension pool.
+ */
+class ParticleExtensionPointer
+{
+  public:
+    using element_type = ParticleExtensionPool::value_type;
+
+  private:
+    element_type* pointer = nullptr;
+
+  public:
+    ParticleExtensionPointer() = default;
+    ParticleExtensionPointer(std::nullptr_t) {}
+    ParticleExtensionPointer(const ParticleExtensionPointer&) = delete;
+    ParticleExtensionPointer& operator=(const ParticleExtensionPointer&) = delete;
+
+    ParticleExtensionPointer(ParticleExtensionPointer&& other) noexcept
+        : pointer(std::exchange(other.pointer, nullptr))
+    {
+    }
+
+    ParticleExtensionPointer& operator=(ParticleExtensionPointer&& other) noexcept
+    {
+        if (&other != this) {
+            reset();
+            pointer = std::exchange(other.pointer, nullptr);
+        }
+        return *this;
+    }
+
+    ParticleExtensionPointer& operator=(std::nullptr_t)
+    {
+        reset();
+        return *this;
+    }
+
+    ~ParticleExtensionPointer() { reset(); }
+
+    template <typename... Args> element_type& emplace(Args&&... args)
+    {
+        reset();
+        pointer = ParticleExtensionPool::instance().create(std::forward<Args>(args)...);
+        return *pointer;
+    } //!< Replace extension with a newly constructed one
+
+    void reset()
+    {
+        if (pointer) {
+            ParticleExtensionPool::instance().destroy(std::exchange(pointer, nullptr));
+        }
+    } //!< Destroy extension, if any
+
+    element_type* get() const { return pointer; }
+    element_type& operator*() const { return *pointer; }
+    element_type* operator->() const { return pointer; }
+    explicit operator bool() const { return pointer != nullptr; }
+    bool operator==(std::nullptr_t) const { return pointer == nullptr; }
+
+    template <class Archive> void save(Archive& archive) const
+    {
+        archive(static_cast<std::uint8_t>(pointer != nullptr));
+        if (pointer) {
+            pointer->serialize(archive);
+        }
+    } //!< Cereal serialisation; same layout as for `std::unique_ptr`
+
+    template <class Archive> void load(Archive& archive)
+    {
+        std::uint8_t valid = 0;
+        archive(valid);
+        if (valid == 0) {
+            reset();
+            return;
+        }
+        if (!pointer) {
+            emplace();
+        }
+        pointer->serialize(archive);
+    } //!< Cereal deserialisation
+};
+
 /**
  * @brief Particle class for storing positions, id, and other properties
  *
  * Particles carry `id`, `pos`, `charge` by default but can have additional
  * or _extended_ data stored using a different memory model. When serializing
  * from a json object, extended properties are automatically detected and
- * memory is automatically allocated
- *
- * @todo: memory model for extended properties not optimal
+ * memory is automatically allocated. Extensions are kept in `ParticleExtensionPool`
+ * and copying between particles that both have extensions is a plain assignment.
  */
 class Particle
 {
   public:
-    using ParticleExtension = ParticleTemplate<Dipole, Quadrupole, Cigar>;
-    std::unique_ptr<ParticleExtension> ext; //!< Point to extended properties
+    using ParticleExtension = ParticleExtensionPool::value_type;
+    ParticleExtensionPointer ext; //!< Point to extended properties
     int id = -1;                            //!< Particle id/type
     double charge = 0.0;                    //!< Particle charge
     Point pos = {0.0, 0.0, 0.0};            //!< Particle position vector
@@ -247,7 +391,19 @@ class Particle
     Particle(const AtomData& a, const Point& pos);
     Particle(const AtomData& a);          //!< construct from AtomData
     Particle(const Particle&);            //!< copy constructor
-    Particle& operator=(const Particle&); //!< assignment operator
+
+    //! Assignment operator; particles without extensions are copied without touching the heap
+    inline Particle& operator=(const Particle& other)
+    {
+        if (!ext && !other.ext) { // fast path for plain particles
+            id = other.id;
+            charge = other.charge;
+            pos = other.pos;
+            return *this;
+        }
+        return assignWithExtension(other);
+    }
+
     const AtomData& traits() const;       //!< get properties from AtomData
     void rotate(const Eigen::Quaterniond& quaternion,
                 const Eigen::Matrix3d& rotation_matrix); //!< internal rotation
@@ -276,11 +432,83 @@ class Particle
         // if (ext != nullptr)
         //    ext->serialize(archive);
     } //!<
+
+  private:
+    Particle& assignWithExtension(const Particle& other); //!< Assignment involving extensions
 };
 
 //! Storage type for collections of particles
 using ParticleVector = std::vector<Particle>;
 
+/**
+ * @brief Allocator for memory aligned to the width of wide SIMD registers
+ * @tparam T Value type
+ * @tparam alignment Alignment in bytes; 64 matches AVX-512 registers and cache lines
+ */
+template <typename T, std::size_t alignment = 64> struct AlignedAllocator
+{
+    using value_type = T;
+
+    template <typename U> struct rebind
+    {
+        using other = AlignedAllocator<U, alignment>;
+    };
+
+    AlignedAllocator() = default;
+
+    template <typename U> AlignedAllocator(const AlignedAllocator<U, alignment>&) {}
+
+    T* allocate(const std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignment}));
+    }
+
+    void deallocate(T* pointer, [[maybe_unused]] const std::size_t n)
+    {
+        ::operator delete(pointer, std::align_val_t{alignment});
+    }
+
+    template <typename U> bool operator==(const AlignedAllocator<U, alignment>&) const
+    {
+        return true;
+    }
+};
+
+/**
+ * @brief Structure-of-arrays mirror of particle ids, charges, and positions
+ *
+ * `Particle` is an array-of-structures record which carries a pointer to extended properties.
+ * Loops over many particles touching only positions, charges, and ids therefore drag unused
+ * data through the cache and cannot be vectorized. This mirror keeps the hot properties in
+ * contiguous, aligned arrays. It is _not_ updated automatically, but the owner must call
+ * `update()` for particles that have changed.
+ */
+class ParticleArrays
+{
+  public:
+    template <typename T> using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+    AlignedVector<double> x;      //!< x-coordinates
+    AlignedVector<double> y;      //!< y-coordinates
+    AlignedVector<double> z;      //!< z-coordinates
+    AlignedVector<double> charge; //!< Particle charges
+    AlignedVector<int> id;        //!< Particle ids
+
+    std::size_t size() const; //!< Number of mirrored particles
+    void resize(std::size_t size);
+    void update(const ParticleVector& particles); //!< Resize and copy all particles
+    void update(const ParticleVector& particles, std::size_t first,
+                std::size_t last); //!< Copy particles in index range [first, last)
+
+    inline void update(const std::size_t index, const Particle& particle)
+    {
+        x[index] = particle.pos.x();
+        y[index] = particle.pos.y();
+        z[index] = particle.pos.z();
+        charge[index] = particle.charge;
+        id[index] = particle.id;
+    } //!< Copy a single particle into given index
+};
+
 /** Concept for a range of particles */
 template <class T>
 concept RequireParticles =
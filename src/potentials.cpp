@@ -606,6 +606,63 @@ void CustomPairPotential::from_json(const json& j)
                                     {"charge2", &symbols->charge2},
                                     {"s1", &symbols->sigma1},
                                     {"s2", &symbols->sigma2}});
+    spline_tables.clear();
+    if (auto it = j.find("tabulate"); it != j.end()) {
+        createSplines(*it);
+    }
+}
+
+/**
+ * Each atom pair is splined in the interval `[rmin, cutoff]` where `rmin` defaults to the
+ * contact distance. The spline is then compared with the exact expression in steps of
+ * 0.01 Å and an error is raised if the deviation exceeds ten times the tolerance, `utol`.
+ */
+void CustomPairPotential::createSplines(const json& j)
+{
+    if (!std::isfinite(squared_cutoff_distance)) {
+        throw ConfigurationError("{}: tabulation requires a finite cutoff", name);
+    }
+    const auto tolerance = j.value("utol", 1e-3);
+    const auto rmax = std::sqrt(squared_cutoff_distance);
+    const auto dr = 0.01;
+    spline.setTolerance(tolerance);
+    number_of_atom_types = Faunus::atoms.size();
+    spline_tables.assign(number_of_atom_types * number_of_atom_types, {});
+    double max_error = 0.0;
+    for (const auto& atom1 : Faunus::atoms) {
+        for (const auto& atom2 : Faunus::atoms) {
+            if (atom1.implicit || atom2.implicit) {
+                continue;
+            }
+            const auto rmin = std::max(dr, j.value("rmin", 0.5 * (atom1.sigma + atom2.sigma)));
+            if (rmin >= rmax) {
+                continue;
+            }
+            const Particle particle1 = atom1;
+            const Particle particle2 = atom2;
+            auto exact_energy = [&](const double squared_distance) {
+                setSymbols(particle1, particle2, squared_distance);
+                return expression();
+            };
+            auto& table = spline_tables[atom1.id() * number_of_atom_types + atom2.id()];
+            table.knots = spline.generate(exact_energy, rmin * rmin, squared_cutoff_distance);
+            table.charge1 = atom1.charge;
+            table.charge2 = atom2.charge;
+            for (const auto r : arange(rmin + dr, rmax, dr)) {
+                if (r * r <= table.knots.rmin2) {
+                    continue; // repulsive inner region is not splined
+                }
+                const auto error = std::fabs(spline.eval(table.knots, r * r) - exact_energy(r * r));
+                max_error = std::max(max_error, error);
+            }
+        }
+    }
+    faunus_logger->debug("{}: splined all atom pairs with max. abs. error of {:.1E} kT", name,
+                         max_error);
+    if (max_error > 10.0 * tolerance) {
+        throw ConfigurationError("{}: spline error {:.1E} kT exceeds tolerance; increase rmin",
+                                 name, max_error);
+    }
 }
 
 void CustomPairPotential::to_json(json& j) const
@@ -661,6 +718,29 @@ TEST_CASE("[Faunus] CustomPairPotential")
         CHECK_EQ(force.y(), Approx(force_ref.y()));
         CHECK_EQ(force.z(), Approx(force_ref.z()));
     }
+    SUBCASE("tabulate")
+    {
+        CustomPairPotential exact;
+        CustomPairPotential splined;
+        const auto input = R"({"constants": { "lB": 7.0 }, "cutoff": 20.0,
+                               "function": "lB * charge1 * charge2 / r * exp(-r / 10)"})"_json;
+        pairpotential::from_json(input, exact);
+        auto tabulated_input = input;
+        tabulated_input["tabulate"] = {{"utol", 1e-5}};
+        pairpotential::from_json(tabulated_input, splined);
+        for (const double r : {1.0, 3.6, 8.0, 15.5, 19.9, 25.0}) {
+            const Point distance = {r, 0.0, 0.0};
+            CHECK_EQ(splined(a, b, r * r, distance),
+                     Approx(exact(a, b, r * r, distance)).epsilon(1e-4));
+            CHECK_EQ(splined.force(a, b, r * r, distance).x(),
+                     Approx(exact.force(a, b, r * r, distance).x()).epsilon(1e-3));
+        }
+        auto c = b;
+        c.charge = 0.5; // charge differs from atom type; use exact expression
+        CHECK_EQ(splined(a, c, 8.0 * 8.0, {8, 0, 0}), Approx(exact(a, c, 8.0 * 8.0, {8, 0, 0})));
+        tabulated_input.erase("cutoff");
+        CHECK_THROWS_AS(pairpotential::from_json(tabulated_input, splined), ConfigurationError);
+    }
 }
 
 // =============== Dummy ===============
@@ -1216,13 +1296,196 @@ TEST_CASE("[Faunus] FunctorPotential")
     }
 }
 
-// =============== SplinedPotential ===============
+// =============== VariantPotential ===============
 
-SplinedPotential::KnotData::KnotData(const base& b)
-    : base(b)
+/**
+ * @return Terms, or `std::nullopt` if the array contains any potential not stored in `Term`
+ *
+ * Coulomb and the first of `lennardjones`, `wca`, or `hardsphere` are fused into a single term.
+ */
+std::optional<std::vector<VariantPotential::Term>>
+VariantPotential::makeTerms(const json& potential_array)
 {
+    if (!potential_array.is_array()) {
+        throw std::runtime_error("potential array required");
+    }
+    std::vector<std::pair<std::string, json>> records; // (name, single record)
+    for (const auto& single_record : potential_array) {
+        if (!single_record.is_object() || single_record.size() != 1) {
+            continue;
+        }
+        records.emplace_back(single_record.begin().key(), single_record);
+    }
+    const auto find_record = [&](const std::set<std::string>& names) {
+        return std::find_if(records.begin(), records.end(),
+                            [&](const auto& record) { return names.contains(record.first); });
+    };
+
+    std::vector<Term> terms;
+    const auto coulomb = find_record({"coulomb"});
+    const auto short_ranged = find_record({"lennardjones", "wca", "hardsphere"});
+    if (coulomb != records.end() && short_ranged != records.end()) {
+        json j_combined = {{"coulomb", coulomb->second.at("coulomb")},
+                           {short_ranged->first, short_ranged->second.at(short_ranged->first)}};
+        if (short_ranged->first == "lennardjones") {
+            terms.emplace_back(makePairPotential<CoulombLJ>(j_combined));
+        }
+        else if (short_ranged->first == "wca") {
+            terms.emplace_back(makePairPotential<CoulombWCA>(j_combined));
+        }
+        else {
+            terms.emplace_back(makePairPotential<CoulombHardSphere>(j_combined));
+        }
+        records.erase(std::max(coulomb, short_ranged));
+        records.erase(std::min(coulomb, short_ranged));
+    }
+    for (const auto& [name, single_record] : records) {
+        if (name == "coulomb") {
+            terms.emplace_back(makePairPotential<NewCoulombGalore>(single_record.at(name)));
+        }
+        else if (name == "lennardjones") {
+            terms.emplace_back(makePairPotential<LennardJones>(single_record));
+        }
+        else if (name == "wca") {
+            terms.emplace_back(makePairPotential<WeeksChandlerAndersen>(single_record));
+        }
+        else if (name == "hardsphere") {
+            terms.emplace_back(makePairPotential<HardSphere>(single_record));
+        }
+        else if (name == "hertz") {
+            terms.emplace_back(makePairPotential<Hertz>(single_record));
+        }
+        else if (name == "squarewell") {
+            terms.emplace_back(makePairPotential<SquareWell>(single_record));
+        }
+        else if (name == "repulsionr3") {
+            terms.emplace_back(makePairPotential<RepulsionR3>(single_record));
+        }
+        else {
+            return std::nullopt;
+        }
+    }
+    return terms;
 }
 
+/**
+ * The input is first parsed by `FunctorPotential` which validates it, sets up self energies,
+ * and provides the fallback functors. Atom pairs with only built-in potentials are then
+ * re-parsed into variant terms.
+ */
+void VariantPotential::from_json(const json& j)
+{
+    FunctorPotential::from_json(j);
+    const auto make_terms = [&](const json& potential_array, size_t id1, size_t id2) {
+        auto pair_terms = makeTerms(potential_array);
+        if (!pair_terms) {
+            number_of_functor_pairs++;
+            pair_terms = std::vector<Term>{umatrix(id1, id2)};
+        }
+        return pair_terms.value();
+    };
+
+    number_of_functor_pairs = 0;
+    terms = decltype(terms)(atoms.size());
+    const auto default_terms = makeTerms(j.at("default"));
+    for (size_t i = 0; i < atoms.size(); i++) {
+        for (size_t k = 0; k <= i; k++) {
+            terms.set(i, k, default_terms ? *default_terms : std::vector<Term>{umatrix(i, k)});
+        }
+    }
+    if (!default_terms) {
+        number_of_functor_pairs = atoms.size() * (atoms.size() + 1) / 2;
+    }
+    for (const auto& [key, value] : j.items()) {
+        const auto atompair = splitConvert<std::string>(key);
+        if (atompair.size() == 2) {
+            const auto ids = names2ids(atoms, atompair);
+            terms.set(ids[0], ids[1], make_terms(value, ids[0], ids[1]));
+        }
+    }
+    faunus_logger->debug("{}: {} atom pair(s) use functor fallback", name,
+                         number_of_functor_pairs);
+
+    const auto is_homogeneous = [](const Term& term) {
+        return std::visit(
+            [](const auto& potential) {
+                if constexpr (RequireHomogeneousPairPotential<std::decay_t<decltype(potential)>>) {
+                    return potential.isHomogeneous();
+                }
+                return false;
+            },
+            term);
+    };
+    homogeneous = number_of_functor_pairs == 0;
+    for (size_t i = 0; i < atoms.size(); i++) {
+        for (size_t k = 0; k <= i; k++) {
+            homogeneous = homogeneous && std::ranges::all_of(terms(i, k), is_homogeneous);
+        }
+    }
+}
+
+void VariantPotential::to_json(json& j) const
+{
+    FunctorPotential::to_json(j);
+    j["functor pairs"] = number_of_functor_pairs;
+}
+
+VariantPotential::VariantPotential(const std::string& name)
+    : FunctorPotential(name)
+{
+}
+
+TEST_CASE("[Faunus] VariantPotential")
+{
+    using doctest::Approx;
+    atoms = R"([{"A": { "q":1.0,  "r":1.1, "eps":0.1 }},
+                {"B": { "q":-1.0, "r":2.0, "eps":0.05 }},
+                {"C": { "r":1.0 }}])"_json.get<decltype(atoms)>();
+    const auto j = R"(
+                { "default": [ { "coulomb" : {"epsr": 80.0, "type": "plain"} } ],
+                  "A B" : [
+                    { "coulomb" : {"epsr": 80.0, "type": "plain"} },
+                    { "wca" : {"mixing": "LB"} }
+                  ],
+                  "A C" : [ { "cos2": {"eps": 0.5, "rc": 3.0, "wc": 1.0} } ],
+                  "C C" : [ { "hardsphere" : {} } ] })"_json;
+    const auto functor = pairpotential::makePairPotential<FunctorPotential>(j);
+    const auto variant = pairpotential::makePairPotential<VariantPotential>(j);
+    json j_out;
+    pairpotential::to_json(j_out, variant);
+    CHECK_EQ(j_out.at(variant.name).at("functor pairs"), 1);
+
+    const std::vector<Particle> particles = {atoms[0], atoms[1], atoms[2]};
+    for (const auto distance : {2.1, 3.5, 10.0}) { // beyond hard sphere contact
+        const Point r = {distance, 0, 0};
+        for (const auto& particle_a : particles) {
+            for (const auto& particle_b : particles) {
+                const auto expected = functor(particle_a, particle_b, r.squaredNorm(), r);
+                CHECK_EQ(variant(particle_a, particle_b, r.squaredNorm(), r), Approx(expected));
+            }
+        }
+    }
+    CHECK_EQ(variant(particles[2], particles[2], 0.81, {0.9, 0, 0}), pc::infty);
+    CHECK((variant.selfEnergy != nullptr));
+    CHECK_FALSE(variant.isHomogeneous());
+
+    SUBCASE("homogeneous terms")
+    {
+        const auto homogeneous = pairpotential::makePairPotential<VariantPotential>(R"(
+                { "default": [ { "coulomb" : {"epsr": 80.0, "type": "plain"} },
+                               { "lennardjones" : {"mixing": "LB"} } ] })"_json);
+        REQUIRE(homogeneous.isHomogeneous());
+        const auto& [a, b] = std::tie(particles[0], particles[1]);
+        const auto terms = homogeneous.homogeneousTerms(a, b, 2.1 * 2.1);
+        CHECK_EQ(terms[0] + terms[1] + terms[2], Approx(homogeneous(a, b, 2.1 * 2.1)));
+        const auto scaled = pairpotential::scaleHomogeneousTerms(terms, 1.3);
+        CHECK_EQ(scaled[0] + scaled[1] + scaled[2],
+                 Approx(homogeneous(a, b, std::pow(1.3 * 2.1, 2))));
+    }
+}
+
+// =============== SplinedPotential ===============
+
 /**
  * @param stream output stream
  * @param id1 fist atom id
@@ -1238,7 +1501,7 @@ void SplinedPotential::streamPairPotential(std::ostream& stream, const size_t id
     stream << "# r u_splined/kT u_exact/kT\n";
     const auto particle_1 = static_cast<Particle>(Faunus::atoms.at(id1));
     const auto particle_2 = static_cast<Particle>(Faunus::atoms.at(id2));
-    const auto rmax = std::sqrt(matrix_of_knots(id1, id2).rmax2);
+    const auto rmax = std::sqrt(splineTable(id1, id2).rmax2);
     for (auto r : arange(dr, rmax, dr)) {
         stream << fmt::format(
             "{:.6E} {:.6E} {:.6E}\n", r, operator()(particle_1, particle_2, r * r, {r, 0, 0}),
@@ -1344,6 +1607,11 @@ void SplinedPotential::from_json(const json& js)
     double energy_at_rmin = js.value("u_at_rmin", 20);
     double energy_at_rmax = js.value("u_at_rmax", 1e-6);
 
+    number_of_atom_types = Faunus::atoms.size();
+    spline_tables.assign(number_of_atom_types * number_of_atom_types, {});
+    knot_positions.clear();
+    coefficients.assign(coefficients_per_knot, 0.0); // zero interval used for pairs out of range
+
     faunus_logger->trace("Pair potential spline tolerance = {} kT", js.value("utol", 1e-5));
 
     for (size_t i = 0; i < Faunus::atoms.size(); ++i) { // loop over atom types
@@ -1387,22 +1655,22 @@ void SplinedPotential::createKnots(int i, int j, double rmin, double rmax)
 {
     Particle particle1 = Faunus::atoms.at(i);
     Particle particle2 = Faunus::atoms.at(j);
-    KnotData knotdata = spline.generate(
+    const auto knotdata = spline.generate(
         [&](double r_squared) {
             return FunctorPotential::operator()(particle1, particle2, r_squared, {0, 0, 0});
         },
         rmin * rmin, rmax * rmax); // spline along r^2
 
     // if set, hard-sphere repulsion (infinity) is used IF the potential is repulsive below rmin
-    knotdata.hardsphere_repulsion = hardsphere_repulsion;
+    auto use_hardsphere = hardsphere_repulsion;
     if (spline.eval(knotdata, knotdata.rmin2 + dr) < 0) { // disable hard sphere
-        knotdata.hardsphere_repulsion = false;            // repulsion for attractive potentials
+        use_hardsphere = false;                           // repulsion for attractive potentials
     }
-    if (knotdata.hardsphere_repulsion) {
+    if (use_hardsphere) {
         faunus_logger->trace("Hardsphere repulsion enabled for {}-{} spline",
                              Faunus::atoms.at(i).name, Faunus::atoms.at(j).name);
     }
-    matrix_of_knots.set(i, j, knotdata); // register knots for the pair
+    addSpline(i, j, knotdata, use_hardsphere); // register knots for the pair
 
     double max_error = 0.0; // maximum absolute error of the spline along r
     for (const auto r : arange(rmin + dr, rmax, dr)) {
@@ -1417,6 +1685,126 @@ void SplinedPotential::createKnots(int i, int j, double rmin, double rmax)
                          unicode::angstrom, knotdata.numKnots(), max_error);
 }
 
+/**
+ * @param i Atom index
+ * @param j Atom index
+ * @param knotdata Knots and coefficients of the spline
+ * @param use_hardsphere Use hardsphere repulsion below rmin
+ *
+ * The knots and coefficients of all splines are stored contiguously and the spline is registered
+ * for both (i, j) and (j, i).
+ */
+void SplinedPotential::addSpline(int i, int j,
+                                 const Tabulate::TabulatorBase<double>::data& knotdata,
+                                 bool use_hardsphere)
+{
+    SplineTable table;
+    table.first_knot = knot_positions.size();
+    table.number_of_knots = knotdata.numKnots();
+    table.first_coefficient = coefficients.size();
+    table.rmin2 = knotdata.rmin2;
+    table.rmax2 = knotdata.rmax2;
+    table.hardsphere_repulsion = use_hardsphere;
+    knot_positions.insert(knot_positions.end(), knotdata.r2.begin(), knotdata.r2.end());
+    coefficients.insert(coefficients.end(), knotdata.c.begin(), knotdata.c.end());
+    spline_tables.at(i * number_of_atom_types + j) = table;
+    spline_tables.at(j * number_of_atom_types + i) = table;
+}
+
+/**
+ * Exact energy, or infinity if hardsphere repulsion is used, for distances below the spline range
+ */
+double SplinedPotential::exactEnergy(int id_a, int id_b, double charge_a, double charge_b,
+                                     double squared_distance) const
+{
+    if (splineTable(id_a, id_b).hardsphere_repulsion) {
+        return pc::infty;
+    }
+    Particle particle_a = Faunus::atoms.at(id_a);
+    Particle particle_b = Faunus::atoms.at(id_b);
+    particle_a.charge = charge_a;
+    particle_b.charge = charge_b;
+    return FunctorPotential::operator()(particle_a, particle_b, squared_distance, {0, 0, 0});
+}
+
+/**
+ * @param id_a Atom id of the first particle
+ * @param charge_a Charge of the first particle
+ * @param ids_b Atom ids of the other particles
+ * @param charges_b Charges of the other particles
+ * @param squared_distances Squared distances to the other particles
+ * @param size Number of other particles
+ * @return Sum of pair energies
+ *
+ * The knot intervals are first located by a scalar search whereafter all polynomials of a batch
+ * are evaluated in a vectorizable loop gathering the coefficients. Pairs beyond the spline range
+ * point to an interval of zero coefficients, while pairs below the spline range are evaluated
+ * separately.
+ */
+double SplinedPotential::batchEnergy(const int id_a, const double charge_a, const int* ids_b,
+                                     const double* charges_b, const double* squared_distances,
+                                     const std::size_t size) const
+{
+    constexpr std::size_t batch_size = 64;
+    alignas(64) std::array<std::size_t, batch_size> coefficient_indices;
+    alignas(64) std::array<double, batch_size> offsets;
+    double energy = 0.0;
+    for (std::size_t batch_begin = 0; batch_begin < size; batch_begin += batch_size) {
+        const auto batch_length = std::min(batch_size, size - batch_begin);
+        for (std::size_t k = 0; k < batch_length; ++k) {
+            const auto index = batch_begin + k;
+            const auto squared_distance = squared_distances[index];
+            const auto& table = splineTable(id_a, ids_b[index]);
+            coefficient_indices[k] = 0;
+            offsets[k] = 0.0;
+            if (squared_distance >= table.rmax2) {
+                continue;
+            }
+            if (squared_distance > table.rmin2) {
+                std::tie(coefficient_indices[k], offsets[k]) = locate(table, squared_distance);
+            }
+            else {
+                energy += exactEnergy(id_a, ids_b[index], charge_a, charges_b[index],
+                                      squared_distance);
+            }
+        }
+#pragma omp simd reduction(+ : energy)
+        for (std::size_t k = 0; k < batch_length; ++k) {
+            energy += evaluate(coefficient_indices[k], offsets[k]);
+        }
+    }
+    return energy;
+}
+
+TEST_CASE("[Faunus] SplinedPotential")
+{
+    using doctest::Approx;
+    atoms = R"([{"A": { "q":1.0,  "r":1.1, "eps":0.1 }},
+                {"B": { "q":-1.0, "r":2.0, "eps":0.05 }}])"_json.get<decltype(atoms)>();
+    const auto j = R"({"default": [{"coulomb": {"epsr": 80.0, "type": "plain"}},
+                                   {"wca": {"mixing": "LB"}}]})"_json;
+    auto exact = pairpotential::makePairPotential<FunctorPotential>(j);
+    auto splined = pairpotential::makePairPotential<SplinedPotential>(j);
+
+    const std::vector<int> ids = {0, 1, 1, 0, 1};
+    const std::vector<double> charges = {1.0, -1.0, -1.0, 1.0, -0.5};
+    const std::vector<double> squared_distances = {9.0, 16.0, 1.0e6, 30.0, 0.5};
+    double energy_sum = 0.0;
+    for (std::size_t k = 0; k < ids.size(); ++k) {
+        Particle a = atoms[0];
+        Particle b = atoms[ids[k]];
+        b.charge = charges[k];
+        const auto u = splined(0, ids[k], 1.0, charges[k], squared_distances[k]);
+        CHECK_EQ(u, Approx(splined(a, b, squared_distances[k], {0, 0, 0})));
+        CHECK_EQ(u, Approx(exact(a, b, squared_distances[k], {0, 0, 0})).epsilon(1e-3));
+        energy_sum += u;
+    }
+    CHECK_EQ(splined(0, 1, 1.0, -1.0, 1.0e6), 0.0); // beyond spline range
+    CHECK_EQ(splined.batchEnergy(0, 1.0, ids.data(), charges.data(), squared_distances.data(),
+                                 ids.size()),
+             Approx(energy_sum));
+}
+
 // =============== NewCoulombGalore ===============
 
 void NewCoulombGalore::setSelfEnergy()
@@ -1456,6 +1844,7 @@ void NewCoulombGalore::from_json(const json& j)
     const auto electrolyte = Faunus::makeElectrolyte(j);
     pot.setTolerance(j.value("utol", 0.005 / bjerrum_length));
     const auto method = j.at("type").get<std::string>();
+    homogeneous = false;
     if (method == "yukawa") {
         if (json _j(j); _j.value("shift", false)) { // zero energy and force at cutoff
             faunus_logger->debug(
@@ -1481,6 +1870,7 @@ void NewCoulombGalore::from_json(const json& j)
             throw ConfigurationError("unexpected cutoff for plain: it's *always* infinity");
         }
         pot.spline<::CoulombGalore::Plain>(j);
+        homogeneous = !electrolyte.has_value();
     }
     else if (method == "qpotential") {
         pot.spline<::CoulombGalore::qPotential>(j);
@@ -5,6 +5,8 @@
 #include "multipole.h"
 #include "spherocylinder.h"
 #include <coulombgalore.h>
+#include <optional>
+#include <variant>
 
 namespace Faunus::pairpotential {
 
@@ -42,11 +44,30 @@ class LennardJones : public MixerPairPotentialBase
     inline double operator()(const Particle& particle_a, const Particle& particle_b,
                              double squared_distance,
                              [[maybe_unused]] const Point& b_towards_a) const override
+    {
+        return operator()(particle_a.id, particle_b.id, 0.0, 0.0, squared_distance);
+    }
+
+    //! Pair energy from particle ids and squared distance; charges are ignored
+    inline double operator()(const int id_a, const int id_b, [[maybe_unused]] double charge_a,
+                             [[maybe_unused]] double charge_b, double squared_distance) const
+    {
+        auto x = (*sigma_squared)(id_a, id_b) / squared_distance; // s2/r2
+        x = x * x * x;                                            // s6/r6
+        return (*epsilon_quadruple)(id_a, id_b) * (x * x - x);
+    }
+
+    //! The r⁻¹² and r⁻⁶ terms, see `HomogeneousTerms`
+    inline HomogeneousTerms homogeneousTerms(const Particle& particle_a, const Particle& particle_b,
+                                             double squared_distance) const
     {
         auto x = (*sigma_squared)(particle_a.id, particle_b.id) / squared_distance; // s2/r2
         x = x * x * x;                                                              // s6/r6
-        return (*epsilon_quadruple)(particle_a.id, particle_b.id) * (x * x - x);
+        const auto epsilon_quadruple_ab = (*epsilon_quadruple)(particle_a.id, particle_b.id);
+        return {epsilon_quadruple_ab * x * x, -epsilon_quadruple_ab * x, 0.0};
     }
+
+    static bool isHomogeneous() { return true; }
 };
 
 /**
@@ -66,15 +87,15 @@ class WeeksChandlerAndersen : public LennardJones
 {
     static constexpr double onefourth = 0.25, twototwosixth = 1.2599210498948732;
 
-    inline double operator()(const Particle& a, const Particle& b, double squared_distance) const
+    inline double operator()(const int id_a, const int id_b, double squared_distance) const
     {
-        auto x = (*sigma_squared)(a.id, b.id); // s^2
+        auto x = (*sigma_squared)(id_a, id_b); // s^2
         if (squared_distance > x * twototwosixth) {
             return 0;
         }
         x = x / squared_distance; // (s/r)^2
         x = x * x * x;            // (s/r)^6
-        return (*epsilon_quadruple)(a.id, b.id) * (x * x - x + onefourth);
+        return (*epsilon_quadruple)(id_a, id_b) * (x * x - x + onefourth);
     }
 
   public:
@@ -85,7 +106,14 @@ class WeeksChandlerAndersen : public LennardJones
     inline double operator()(const Particle& a, const Particle& b, double squared_distance,
                              [[maybe_unused]] const Point& b_towards_a) const override
     {
-        return operator()(a, b, squared_distance);
+        return operator()(a.id, b.id, squared_distance);
+    }
+
+    //! Pair energy from particle ids and squared distance; charges are ignored
+    inline double operator()(const int id_a, const int id_b, [[maybe_unused]] double charge_a,
+                             [[maybe_unused]] double charge_b, double squared_distance) const
+    {
+        return operator()(id_a, id_b, squared_distance);
     }
 
     inline Point force(const Particle& a, const Particle& b, const double squared_distance,
@@ -100,6 +128,9 @@ class WeeksChandlerAndersen : public LennardJones
         return (*epsilon_quadruple)(a.id, b.id) * 6.0 * (2.0 * x * x - x) / squared_distance *
                b_towards_a;
     }
+
+    HomogeneousTerms homogeneousTerms(const Particle&, const Particle&,
+                                      double) const = delete; //!< Truncated; not homogeneous
 }; // Weeks-Chandler-Andersen potential
 
 /**
@@ -123,6 +154,13 @@ class HardSphere : public MixerPairPotentialBase
     {
         return squared_distance < (*sigma_squared)(particle_a.id, particle_b.id) ? pc::infty : 0.0;
     }
+
+    //! Pair energy from particle ids and squared distance; charges are ignored
+    inline double operator()(const int id_a, const int id_b, [[maybe_unused]] double charge_a,
+                             [[maybe_unused]] double charge_b, double squared_distance) const
+    {
+        return squared_distance < (*sigma_squared)(id_a, id_b) ? pc::infty : 0.0;
+    }
 };
 
 /**
@@ -393,6 +431,14 @@ class Coulomb : public PairPotential
         return bjerrum_length * a.charge * b.charge / std::sqrt(squared_distance);
     }
 
+    //! Pair energy from particle charges and squared distance; ids are ignored
+    inline double operator()([[maybe_unused]] int id_a, [[maybe_unused]] int id_b,
+                             const double charge_a, const double charge_b,
+                             const double squared_distance) const
+    {
+        return bjerrum_length * charge_a * charge_b / std::sqrt(squared_distance);
+    }
+
     void to_json(json& j) const override;
 };
 
@@ -500,6 +546,7 @@ class NewCoulombGalore : public PairPotential
 {
   protected:
     ::CoulombGalore::Splined pot;
+    bool homogeneous = false; //!< Energy is proportional to r⁻¹, see `isHomogeneous()`
     virtual void setSelfEnergy();
     void from_json(const json& j) override;
 
@@ -515,6 +562,16 @@ class NewCoulombGalore : public PairPotential
                                   sqrt(squared_distance) + std::numeric_limits<double>::epsilon());
     }
 
+    //! Pair energy from particle charges and squared distance; ids are ignored
+    inline double operator()([[maybe_unused]] int id_a, [[maybe_unused]] int id_b,
+                             const double charge_a, const double charge_b,
+                             const double squared_distance) const
+    {
+        return bjerrum_length *
+               pot.ion_ion_energy(charge_a, charge_b,
+                                  sqrt(squared_distance) + std::numeric_limits<double>::epsilon());
+    }
+
     inline Point force(const Particle& particle_a, const Particle& particle_b,
                        [[maybe_unused]] double squared_distance,
                        const Point& b_towards_a) const override
@@ -523,6 +580,17 @@ class NewCoulombGalore : public PairPotential
                pot.ion_ion_force(particle_a.charge, particle_b.charge, b_towards_a); // force on "a"
     }
 
+    //! The r⁻¹ term, see `HomogeneousTerms`; valid only if `isHomogeneous()`
+    inline HomogeneousTerms homogeneousTerms(const Particle& particle_a, const Particle& particle_b,
+                                             const double squared_distance) const
+    {
+        return {0.0, 0.0, operator()(particle_a.id, particle_b.id, particle_a.charge,
+                                     particle_b.charge, squared_distance)};
+    }
+
+    //! True for unscreened `plain` Coulomb which is proportional to r⁻¹
+    bool isHomogeneous() const { return homogeneous; }
+
     void to_json(json& j) const override;
     [[maybe_unused]] double dielectric_constant(double M2V);
     double bjerrum_length;
@@ -540,6 +608,8 @@ class Multipole : public NewCoulombGalore
 
   public:
     explicit Multipole(const std::string& = "multipole");
+    HomogeneousTerms homogeneousTerms(const Particle&, const Particle&,
+                                      double) const = delete; //!< Not homogeneous
 
     inline double operator()(const Particle& particle_a, const Particle& particle_b,
                              [[maybe_unused]] double squared_distance,
@@ -569,6 +639,10 @@ class Multipole : public NewCoulombGalore
  * @brief Custom pair-potential taking math. expressions at runtime
  * @note `symbols` is a shared_ptr as this allows it to be modified by `operator() const`.
  *       A hack, but would otherwise require const-removal in all pair-potentials.
+ *
+ * If `tabulate` is given, the expression is splined for each pair of atom types using their
+ * default charges and sigmas. The spline is used between `rmin` and the cutoff when the charges
+ * of both particles equal those of their atom types; otherwise the expression is evaluated.
  */
 class CustomPairPotential : public PairPotential
 {
@@ -587,10 +661,37 @@ class CustomPairPotential : public PairPotential
         double sigma2 = 0.0;   // available as "s2"
     };
 
+    /** @brief Spline of an atom pair */
+    struct SplineTable
+    {
+        Tabulate::TabulatorBase<double>::data knots; //!< Empty if not splined
+        double charge1 = 0.0;                        //!< Charge used when splining
+        double charge2 = 0.0;                        //!< Charge used when splining
+    };
+
     std::shared_ptr<Symbols> symbols;
     double squared_cutoff_distance;
     json original_input;
+    Tabulate::Andrea<double> spline;        //!< Spline method
+    std::size_t number_of_atom_types = 0;   //!< Number of atom types when splining
+    std::vector<SplineTable> spline_tables; //!< Spline of each atom pair; empty if not tabulated
     void from_json(const json& j) override;
+    void createSplines(const json& j); //!< Spline expression for all pairs of atom types
+
+    //! Spline for particle pair at given distance or nullptr if the expression must be evaluated
+    inline const SplineTable* findSpline(const Particle& particle1, const Particle& particle2,
+                                         const double squared_distance) const
+    {
+        if (spline_tables.empty()) {
+            return nullptr;
+        }
+        const auto& table = spline_tables[particle1.id * number_of_atom_types + particle2.id];
+        if (table.knots.empty() || squared_distance <= table.knots.rmin2 ||
+            particle1.charge != table.charge1 || particle2.charge != table.charge2) {
+            return nullptr;
+        }
+        return &table;
+    }
 
     inline void setSymbols(const Particle& particle1, const Particle& particle2,
                            double squared_distance) const
@@ -608,6 +709,9 @@ class CustomPairPotential : public PairPotential
                              [[maybe_unused]] const Point& b_towards_a) const override
     {
         if (squared_distance < squared_cutoff_distance) {
+            if (const auto* table = findSpline(particle1, particle2, squared_distance)) {
+                return spline.eval(table->knots, squared_distance);
+            }
             setSymbols(particle1, particle2, squared_distance);
             return expression();
         }
@@ -618,6 +722,10 @@ class CustomPairPotential : public PairPotential
                        double squared_distance, const Point& b_towards_b) const override
     {
         if (squared_distance < squared_cutoff_distance) {
+            if (const auto* table = findSpline(particle_a, particle_b, squared_distance)) {
+                // du/dr = 2r du/dr²
+                return -2.0 * spline.evalDer(table->knots, squared_distance) * b_towards_b;
+            }
             setSymbols(particle_a, particle_b, squared_distance);
             return -expression.derivative(symbols->distance) / symbols->distance * b_towards_b;
         }
@@ -645,8 +753,11 @@ using CigarCosAttractWCA = CompleteCigarPotential<CosAttractMixed, WeeksChandler
  */
 class FunctorPotential : public PairPotential
 {
+  protected:
     using EnergyFunctor =
         std::function<double(const Particle&, const Particle&, double, const Point&)>;
+
+  private:
     json backed_up_json_input; // storage for input json
     bool have_monopole_self_energy = false;
     bool have_dipole_self_energy = false;
@@ -672,6 +783,79 @@ class FunctorPotential : public PairPotential
     }
 };
 
+/**
+ * @brief Arbitrary potentials for specific atom types dispatched without type erasure
+ *
+ * The input is the same as for `FunctorPotential`, but the built-in isotropic potentials, and
+ * coulomb combined with either of `lennardjones`, `wca`, or `hardsphere`, are stored per atom pair
+ * as alternatives of a `std::variant`. A pair energy is thus a jump to an inlined potential
+ * instead of a chain of `std::function` calls. Atom pairs with any other potential, e.g. `custom`
+ * or `multipole`, use the `FunctorPotential` function of the pair.
+ */
+class VariantPotential : public FunctorPotential
+{
+    using CoulombLJ = CombinedPairPotential<NewCoulombGalore, LennardJones>;
+    using CoulombWCA = CombinedPairPotential<NewCoulombGalore, WeeksChandlerAndersen>;
+    using CoulombHardSphere = CombinedPairPotential<NewCoulombGalore, HardSphere>;
+    using Term = std::variant<NewCoulombGalore, LennardJones, WeeksChandlerAndersen, HardSphere,
+                              Hertz, SquareWell, RepulsionR3, CoulombLJ, CoulombWCA,
+                              CoulombHardSphere, EnergyFunctor>;
+
+    PairMatrix<std::vector<Term>, true> terms; //!< potential terms for each atom pair
+    std::size_t number_of_functor_pairs = 0;   //!< number of atom pairs using `umatrix`
+    bool homogeneous = false;                  //!< all terms are homogeneous; see `isHomogeneous()`
+    static std::optional<std::vector<Term>>
+    makeTerms(const json& potential_array); //!< Terms of a json array of built-in potentials
+    void from_json(const json& j) override;
+
+  public:
+    explicit VariantPotential(const std::string& name = "variant potential");
+    void to_json(json& j) const override;
+
+    inline double operator()(const Particle& particle_a, const Particle& particle_b,
+                             const double squared_distance,
+                             const Point& b_towards_a = {0, 0, 0}) const override
+    {
+        double energy = 0.0;
+        for (const auto& term : terms(particle_a.id, particle_b.id)) {
+            energy += std::visit(
+                [&](const auto& potential) {
+                    using T = std::decay_t<decltype(potential)>; // qualified call avoids vtable
+                    return potential.T::operator()(particle_a, particle_b, squared_distance,
+                                                   b_towards_a);
+                },
+                term);
+        }
+        return energy;
+    }
+
+    //! Sum of the homogeneous terms of all potentials of the pair; valid only if `isHomogeneous()`
+    inline HomogeneousTerms homogeneousTerms(const Particle& particle_a, const Particle& particle_b,
+                                             const double squared_distance) const
+    {
+        HomogeneousTerms sum = {0.0, 0.0, 0.0};
+        for (const auto& term : terms(particle_a.id, particle_b.id)) {
+            const auto pair_terms = std::visit(
+                [&](const auto& potential) -> HomogeneousTerms {
+                    using T = std::decay_t<decltype(potential)>;
+                    if constexpr (RequireHomogeneousPairPotential<T>) {
+                        return potential.homogeneousTerms(particle_a, particle_b, squared_distance);
+                    }
+                    else {
+                        assert(false); // not homogeneous
+                        return {0.0, 0.0, 0.0};
+                    }
+                },
+                term);
+            std::transform(sum.begin(), sum.end(), pair_terms.begin(), sum.begin(), std::plus<>());
+        }
+        return sum;
+    }
+
+    //! True if all atom pairs use homogeneous terms only, e.g., Lennard-Jones and plain Coulomb
+    bool isHomogeneous() const { return homogeneous; }
+};
+
 /**
  * @brief Splined pair potentials
  *
@@ -687,19 +871,24 @@ class FunctorPotential : public PairPotential
  */
 class SplinedPotential : public FunctorPotential
 {
-    /** @brief Expand spline data class to hold information about the sign of values for r<rmin */
-    class KnotData : public Tabulate::TabulatorBase<double>::data
+    /** @brief Location of the spline of an atom pair in the flattened knot store */
+    struct SplineTable
     {
-      public:
-        using base = Tabulate::TabulatorBase<double>::data;
+        std::size_t first_knot = 0;        //!< Index of the first knot in `knot_positions`
+        std::size_t number_of_knots = 0;   //!< Number of knots
+        std::size_t first_coefficient = 0; //!< Index of the first coefficient in `coefficients`
+        double rmin2 = 0.0;                //!< Squared distance below which the spline is invalid
+        double rmax2 = 0.0;                //!< Squared distance beyond which the energy is zero
         bool hardsphere_repulsion = false; //!< Use hardsphere repulsion for r smaller than rmin
-        KnotData() = default;
-        KnotData(const base&);
     };
-
-    PairMatrix<KnotData> matrix_of_knots; //!< Matrix with tabulated potential for each atom pair
-    Tabulate::Andrea<double> spline;      //!< Spline method
-    bool hardsphere_repulsion = false;    //!< Use hardsphere repulsion for r smaller than rmin
+    static constexpr std::size_t coefficients_per_knot = 6; //!< Quintic polynomial per interval
+
+    std::size_t number_of_atom_types = 0;
+    std::vector<SplineTable> spline_tables; //!< Spline of each atom pair; see `splineTable()`
+    std::vector<double> knot_positions;     //!< Squared distances of the knots of all splines
+    std::vector<double> coefficients; //!< Coefficients of all splines; starts with a zero interval
+    Tabulate::Andrea<double> spline;  //!< Spline method
+    bool hardsphere_repulsion = false; //!< Use hardsphere repulsion for r smaller than rmin
     const int max_iterations = 1e6; //!< Max number of iterations when determining spline interval
     void streamPairPotential(std::ostream& stream, const size_t id1,
                              const size_t id2); //!< Stream pair potential to output stream
@@ -709,8 +898,38 @@ class SplinedPotential : public FunctorPotential
     double dr = 1e-2; //!< Distance interval when searching for rmin and rmax
     void createKnots(int, int, double,
                      double); //!< Create spline knots for pair of particles in [rmin:rmax]
+    void addSpline(int, int, const Tabulate::TabulatorBase<double>::data&,
+                   bool); //!< Append spline of an atom pair to the flattened knot store
+    double exactEnergy(int id_a, int id_b, double charge_a, double charge_b,
+                       double squared_distance) const; //!< Energy for r <= rmin
     void from_json(const json& j) override;
 
+    inline const SplineTable& splineTable(const int id_a, const int id_b) const
+    {
+        return spline_tables[id_a * number_of_atom_types + id_b];
+    }
+
+    /**
+     * @brief Finds the knot interval of a squared distance within the spline range
+     * @return Index of the interval's first coefficient and the offset from the interval's knot
+     */
+    inline std::pair<std::size_t, double> locate(const SplineTable& table,
+                                                 const double squared_distance) const
+    {
+        const auto* first = knot_positions.data() + table.first_knot;
+        const auto interval = static_cast<std::size_t>(
+            std::lower_bound(first, first + table.number_of_knots, squared_distance) - first - 1);
+        return {table.first_coefficient + coefficients_per_knot * interval,
+                squared_distance - first[interval]};
+    }
+
+    //! Evaluates the polynomial of a knot interval; see Tabulate::Andrea::eval()
+    inline double evaluate(const std::size_t coefficient_index, const double dz) const
+    {
+        const auto* c = coefficients.data() + coefficient_index;
+        return c[0] + dz * (c[1] + dz * (c[2] + dz * (c[3] + dz * (c[4] + dz * c[5]))));
+    }
+
   public:
     explicit SplinedPotential(const std::string& name = "splined");
 
@@ -726,19 +945,39 @@ class SplinedPotential : public FunctorPotential
                              double squared_distance,
                              [[maybe_unused]] const Point& b_towards_a) const override
     {
-        const auto& knots = matrix_of_knots(particle_a.id, particle_b.id);
-        if (squared_distance >= knots.rmax2) {
+        const auto& table = splineTable(particle_a.id, particle_b.id);
+        if (squared_distance >= table.rmax2) {
             return 0.0;
         }
-        if (squared_distance > knots.rmin2) {
-            return spline.eval(knots, squared_distance); // spline energy
+        if (squared_distance > table.rmin2) {
+            const auto [coefficient_index, dz] = locate(table, squared_distance);
+            return evaluate(coefficient_index, dz); // spline energy
         }
-        if (knots.hardsphere_repulsion) {
+        if (table.hardsphere_repulsion) {
             return pc::infty;
         }
         return FunctorPotential::operator()(particle_a, particle_b, squared_distance,
                                             {0, 0, 0}); // exact energy
     }
+
+    //! Pair energy from particle ids, charges, and squared distance; see policies above
+    inline double operator()(const int id_a, const int id_b, const double charge_a,
+                             const double charge_b, const double squared_distance) const
+    {
+        const auto& table = splineTable(id_a, id_b);
+        if (squared_distance >= table.rmax2) {
+            return 0.0;
+        }
+        if (squared_distance > table.rmin2) {
+            const auto [coefficient_index, dz] = locate(table, squared_distance);
+            return evaluate(coefficient_index, dz);
+        }
+        return exactEnergy(id_a, id_b, charge_a, charge_b, squared_distance);
+    }
+
+    double batchEnergy(int id_a, double charge_a, const int* ids_b, const double* charges_b,
+                       const double* squared_distances,
+                       std::size_t size) const; //!< Sum of energies with a batch of particles
 };
 
 } // namespace Faunus::pairpotential
\ No newline at end of file
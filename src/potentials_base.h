@@ -2,6 +2,7 @@
 #include "core.h"
 #include "particle.h"
 #include "aux/pairmatrix.h"
+#include <algorithm>
 #include <array>
 #include <functional>
 
@@ -180,6 +181,62 @@ void from_json(const json& j, PairPotential& base); //!< Serialize any pair pote
 template <class T>
 concept RequirePairPotential = std::derived_from<T, pairpotential::PairPotential>;
 
+/**
+ * Concept matching an isotropic pair potential that can be evaluated from the particle ids,
+ * charges, and the squared distance alone, i.e., without access to `Particle` objects. This
+ * allows for evaluation on a structure-of-arrays, see `ParticleArrays`.
+ */
+template <class T>
+concept RequireArrayPairPotential =
+    RequirePairPotential<T> && requires(const T& potential, int id, double charge, double r2) {
+        { potential(id, id, charge, charge, r2) } -> std::convertible_to<double>;
+    };
+
+/**
+ * Concept matching an array pair potential that sums the energies between a particle and a batch
+ * of particles, given as arrays of ids, charges, and squared distances, in a single call.
+ */
+template <class T>
+concept RequireBatchPairPotential =
+    RequireArrayPairPotential<T> &&
+    requires(const T& potential, int id, double charge, const int* ids, const double* values,
+             std::size_t size) {
+        {
+            potential.batchEnergy(id, charge, ids, values, values, size)
+        } -> std::convertible_to<double>;
+    };
+
+/**
+ * @brief Pair energy split into terms that are homogeneous functions of the distance
+ *
+ * The energy is written as u(r) = Σᵢ uᵢ(r) where uᵢ(s·r) = sⁿⁱ·uᵢ(r) with the exponents nᵢ
+ * given by `homogeneous_exponents`. If all distances are scaled by a factor s, as in an
+ * isotropic volume move, the energy is obtained from the terms without re-evaluation.
+ */
+using HomogeneousTerms = std::array<double, 3>;
+constexpr std::array<int, 3> homogeneous_exponents = {-12, -6, -1}; //!< Exponents of the terms
+
+//! Homogeneous terms after scaling all distances by a factor
+inline HomogeneousTerms scaleHomogeneousTerms(const HomogeneousTerms& terms, const double scale)
+{
+    const auto inverse = 1.0 / scale;
+    const auto inverse_sixth = inverse * inverse * inverse * inverse * inverse * inverse;
+    return {terms[0] * inverse_sixth * inverse_sixth, terms[1] * inverse_sixth,
+            terms[2] * inverse};
+}
+
+/**
+ * Concept matching a pair potential that can split its energy into homogeneous terms, see
+ * `HomogeneousTerms`. Whether this is possible may depend on the parameters, e.g., a screened
+ * Coulomb potential is not homogeneous, and is reported at runtime by `isHomogeneous()`.
+ */
+template <class T>
+concept RequireHomogeneousPairPotential =
+    RequirePairPotential<T> && requires(const T& potential, const Particle& particle, double r2) {
+        { potential.homogeneousTerms(particle, particle, r2) } -> std::same_as<HomogeneousTerms>;
+        { potential.isHomogeneous() } -> std::convertible_to<bool>;
+    };
+
 /** @brief Convenience function to generate a pair potential initialized from JSON object */
 template <RequirePairPotential T> auto makePairPotential(const json& j)
 {
@@ -240,6 +297,33 @@ struct CombinedPairPotential : public PairPotential
                second(particle_a, particle_b, squared_distance, b_towards_a);
     } //!< Combine pair energy
 
+    //! Combine pair energy from particle ids, charges, and squared distance
+    inline double operator()(const int id_a, const int id_b, const double charge_a,
+                             const double charge_b, const double squared_distance) const
+        requires RequireArrayPairPotential<T1> && RequireArrayPairPotential<T2>
+    {
+        return first(id_a, id_b, charge_a, charge_b, squared_distance) +
+               second(id_a, id_b, charge_a, charge_b, squared_distance);
+    }
+
+    //! Combine homogeneous terms, see `HomogeneousTerms`
+    inline HomogeneousTerms homogeneousTerms(const Particle& particle_a, const Particle& particle_b,
+                                             const double squared_distance) const
+        requires RequireHomogeneousPairPotential<T1> && RequireHomogeneousPairPotential<T2>
+    {
+        auto terms = first.homogeneousTerms(particle_a, particle_b, squared_distance);
+        const auto second_terms = second.homogeneousTerms(particle_a, particle_b, squared_distance);
+        std::transform(terms.begin(), terms.end(), second_terms.begin(), terms.begin(),
+                       std::plus<>());
+        return terms;
+    }
+
+    bool isHomogeneous() const
+        requires RequireHomogeneousPairPotential<T1> && RequireHomogeneousPairPotential<T2>
+    {
+        return first.isHomogeneous() && second.isHomogeneous();
+    }
+
     /**
      * @brief Calculates force on particle a due to another particle, b
      * @param particle_a Particle a
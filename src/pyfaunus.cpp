@@ -220,6 +220,7 @@ PYBIND11_MODULE(pyfaunus, m)
         .def_readwrite("everything", &Change::everything)
         .def_readwrite("volume_change", &Change::volume_change)
         .def_readwrite("matter_change", &Change::matter_change)
+        .def_readwrite("positions_only", &Change::positions_only)
         .def_readwrite("groups", &Change::groups);
 
     // Space
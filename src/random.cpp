@@ -1,9 +1,12 @@
 #include <doctest/doctest.h>
 #include "random.h"
 #include <nlohmann/json.hpp>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <thread>
 
 namespace Faunus {
 
@@ -59,7 +62,21 @@ double Random::operator()()
     return dist01(engine);
 }
 
-Random random; // Global instance
+Random makeThreadLocalRandom(const unsigned int stream)
+{
+    static const auto main_thread = std::this_thread::get_id();
+    Random random;
+    if (const auto thread = std::this_thread::get_id(); thread != main_thread) {
+        const auto hash = static_cast<std::uint64_t>(std::hash<std::thread::id>()(thread));
+        std::seed_seq seeds{static_cast<std::uint32_t>(hash),
+                            static_cast<std::uint32_t>(hash >> 32),
+                            static_cast<std::uint32_t>(stream)};
+        random.engine.seed(seeds);
+    }
+    return random;
+}
+
+thread_local Random random = makeThreadLocalRandom(0); // Global instance; one per thread
 } // namespace Faunus
 
 #ifdef DOCTEST_LIBRARY_INCLUDED
@@ -100,6 +117,21 @@ TEST_CASE("[Faunus] Random")
     CHECK((a() != b()));
 }
 
+TEST_CASE("[Faunus] makeThreadLocalRandom")
+{
+    using namespace Faunus;
+    auto first_number = [](unsigned int stream) {
+        double number = 0.0;
+        std::thread([&]() { number = makeThreadLocalRandom(stream)(); }).join();
+        return number;
+    };
+    Random default_seed;
+    const auto number = default_seed();
+    CHECK_EQ(makeThreadLocalRandom(0)(), number); // main thread
+    CHECK_NE(first_number(0), number);
+    CHECK_NE(first_number(0), first_number(1));
+}
+
 TEST_CASE("[Faunus] WeightedDistribution")
 {
     using namespace Faunus;
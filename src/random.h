@@ -65,7 +65,18 @@ class Random
 void to_json(nlohmann::json&, const Random&);   //!< Random to json conversion
 void from_json(const nlohmann::json&, Random&); //!< json to Random conversion
 
-extern Random random; //!< global instance of Random
+/**
+ * @brief Initial value of a thread local Random instance
+ *
+ * The first calling thread, i.e. the main thread, keeps the deterministic default seed whereas
+ * other threads are seeded from their thread id and `stream` so that no two threads, and no
+ * two thread local instances, share a stream of random numbers.
+ *
+ * @param stream Distinguishes several thread local instances within a thread
+ */
+Random makeThreadLocalRandom(unsigned int stream);
+
+extern thread_local Random random; //!< global instance of Random (one per thread)
 
 /**
  * @brief Stores a series of elements with given weight
@@ -0,0 +1,331 @@
+#include <doctest/doctest.h>
+#include "replicaexchange.h"
+#include "energy.h"
+#include "io.h"
+#include "move.h"
+#include "mpicontroller.h"
+#include <algorithm>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+namespace Faunus {
+
+/**
+ * All replicas are built sequentially from the same input. A seed is drawn from the global
+ * random number generator of the calling thread whereafter the engines of each replica, and
+ * of the exchange itself unless `random` is given, are seeded with `replicaRandom()`.
+ */
+ReplicaExchange::ReplicaExchange(const json& input, const json& j)
+    : thread_pool(j.value("threads", 0U))
+{
+    temperatures = j.at("temperatures").get<decltype(temperatures)>();
+    if (temperatures.size() < 2) {
+        throw ConfigurationError("at least two temperatures required");
+    }
+    if (std::ranges::any_of(temperatures, [](auto temperature) { return temperature <= 0.0; })) {
+        throw ConfigurationError("temperatures must be positive");
+    }
+    exchange_interval = j.value("nstep", 1U);
+    if (exchange_interval == 0) {
+        throw ConfigurationError("nstep must be positive");
+    }
+    partner_policy = j.value("partner_policy", PartnerPolicy::ODDEVEN);
+    if (partner_policy == PartnerPolicy::INVALID) {
+        throw ConfigurationError("unknown partner policy");
+    }
+    const auto seed = static_cast<std::uint32_t>(Faunus::random.engine());
+    random = replicaRandom(seed, temperatures.size(), 0); // index not used by any replica
+    if (j.contains("random")) {
+        from_json(j["random"], random);
+    }
+
+    for (std::size_t slot = 0; slot < temperatures.size(); ++slot) {
+        faunus_logger->info("creating replica {} at {} K", slot, temperatures[slot]);
+        auto& replica = replicas.emplace_back();
+        replica.simulation = std::make_unique<MetropolisMonteCarlo>(input);
+        replica.simulation->setTemperature(temperatures[slot]);
+        replica.move_random = replicaRandom(seed, slot, 0);
+        replica.global_random = replicaRandom(seed, slot, 1);
+        replica_at_slot.push_back(slot);
+    }
+
+    for (auto& replica : replicas) {
+        tasks.emplace_back([&replica]() {
+            auto swap_engines = [&replica]() { // thread local engines <-> replica engines
+                std::swap(move::Move::slump, replica.move_random);
+                std::swap(Faunus::random, replica.global_random);
+            };
+            swap_engines();
+            try {
+                replica.simulation->sweep();
+            }
+            catch (...) {
+                swap_engines();
+                throw;
+            }
+            swap_engines();
+        });
+    }
+
+    if (filename = j.value("file", ""s); !filename.empty()) {
+        filename = MPI::prefix + filename;
+        stream = IO::openCompressedOutputStream(filename, true); // throws if error
+        *stream << "# sweep replica_at_slot0 replica_at_slot1 ...\n"s;
+    }
+}
+
+void ReplicaExchange::sweep()
+{
+    thread_pool.run(tasks);
+    if (++number_of_sweeps % exchange_interval == 0) {
+        exchange();
+    }
+}
+
+void ReplicaExchange::exchange()
+{
+    for (const auto& [slot1, slot2] : partners(partner_policy, temperatures.size(), random)) {
+        acceptance_map[{slot1, slot2}] += exchange(slot1, slot2) ? 1.0 : 0.0;
+    }
+    writeToFileStream();
+}
+
+/**
+ * @return True if the two replicas swapped temperatures
+ */
+bool ReplicaExchange::exchange(const std::size_t slot1, const std::size_t slot2)
+{
+    auto& replica1 = *replicas.at(replica_at_slot.at(slot1)).simulation;
+    auto& replica2 = *replicas.at(replica_at_slot.at(slot2)).simulation;
+    const auto energy_change = exchangeEnergy(replica1.getEnergy(), temperatures[slot1],
+                                              replica2.getEnergy(), temperatures[slot2]);
+    if (std::isnan(energy_change) || random() > std::exp(-energy_change)) {
+        return false;
+    }
+    std::swap(replica_at_slot[slot1], replica_at_slot[slot2]);
+    replica1.setTemperature(temperatures[slot2]);
+    replica2.setTemperature(temperatures[slot1]);
+    return true;
+}
+
+/**
+ * Replica 1 is at temperature 1 and replica 2 at temperature 2. The returned energy
+ * is the change in the reduced energy of the extended ensemble when the two temperatures
+ * are swapped, i.e. the negative logarithm of the acceptance probability.
+ *
+ * @param energy1 Potential energy (kT at `pc::temperature`) of replica 1
+ * @param temperature1 Temperature (K) of replica 1
+ * @param energy2 Potential energy (kT at `pc::temperature`) of replica 2
+ * @param temperature2 Temperature (K) of replica 2
+ */
+double ReplicaExchange::exchangeEnergy(const double energy1, const double temperature1,
+                                       const double energy2, const double temperature2)
+{
+    const auto scaling1 = pc::temperature / (temperature1 * 1.0_K);
+    const auto scaling2 = pc::temperature / (temperature2 * 1.0_K);
+    return (scaling1 - scaling2) * (energy2 - energy1);
+}
+
+/**
+ * @param seed Seed common to all replicas
+ * @param replica_index Index of replica
+ * @param stream Distinguishes several engines of the same replica
+ */
+Random ReplicaExchange::replicaRandom(const std::uint32_t seed, const std::size_t replica_index,
+                                      const unsigned int stream)
+{
+    std::seed_seq seeds{seed, static_cast<std::uint32_t>(replica_index),
+                        static_cast<std::uint32_t>(stream)};
+    Random random;
+    random.engine.seed(seeds);
+    return random;
+}
+
+/**
+ * For `ODDEVEN` the slots (0,1), (2,3), ... or (1,2), (3,4), ... are selected with equal
+ * probability.
+ */
+std::vector<ReplicaExchange::SlotPair>
+ReplicaExchange::partners(const PartnerPolicy policy, const std::size_t number_of_slots,
+                          Random& random)
+{
+    std::vector<SlotPair> pairs;
+    switch (policy) {
+    case PartnerPolicy::ODDEVEN:
+        for (auto slot = static_cast<std::size_t>(random.range(0, 1)); slot + 1 < number_of_slots;
+             slot += 2) {
+            pairs.emplace_back(slot, slot + 1);
+        }
+        break;
+    default:
+        throw std::runtime_error("unknown partner policy");
+    }
+    return pairs;
+}
+
+void ReplicaExchange::writeToFileStream() const
+{
+    if (stream) {
+        *stream << number_of_sweeps;
+        std::ranges::for_each(replica_at_slot, [&](auto replica) { *stream << " " << replica; });
+        *stream << "\n";
+    }
+}
+
+std::size_t ReplicaExchange::size() const
+{
+    return replicas.size();
+}
+
+MetropolisMonteCarlo& ReplicaExchange::at(const std::size_t slot)
+{
+    return *replicas.at(replica_at_slot.at(slot)).simulation;
+}
+
+double ReplicaExchange::getTemperature(const std::size_t slot) const
+{
+    return temperatures.at(slot);
+}
+
+/**
+ * Copies the accepted state, i.e. particles, groups, geometry and energy terms, of the replica
+ * at the given slot. The destination must be built from the same input as the replicas.
+ */
+void ReplicaExchange::copyState(const std::size_t slot, MetropolisMonteCarlo::State& destination)
+{
+    auto& source = at(slot);
+    Change change;
+    change.everything = true;
+    destination.spc->sync(source.getSpace(), change);
+    destination.pot->sync(&source.getHamiltonian(), change);
+}
+
+void to_json(json& j, const ReplicaExchange& replica_exchange)
+{
+    j = {{"replicas", replica_exchange.replicas.size()},
+         {"temperatures", replica_exchange.temperatures},
+         {"nstep", replica_exchange.exchange_interval},
+         {"partner_policy", replica_exchange.partner_policy},
+         {"threads", replica_exchange.thread_pool.size()}};
+    auto& exchange_json = j["exchange"] = json::object();
+    for (const auto& [pair, acceptance] : replica_exchange.acceptance_map) {
+        auto id = fmt::format("{} <-> {}", pair.first, pair.second);
+        exchange_json[id] = {{"attempts", acceptance.size()}, {"acceptance", acceptance.avg()}};
+    }
+    auto& replicas_json = j["replicas at slots"] = json::array();
+    for (std::size_t slot = 0; slot < replica_exchange.replica_at_slot.size(); ++slot) {
+        const auto& replica = replica_exchange.replicas[replica_exchange.replica_at_slot[slot]];
+        replicas_json.push_back({{"replica", replica_exchange.replica_at_slot[slot]},
+                                 {"temperature", replica.simulation->getTemperature()},
+                                 {"energy", replica.simulation->getEnergy()}});
+    }
+}
+
+TEST_CASE("[Faunus] ReplicaExchange")
+{
+    using doctest::Approx;
+    const auto temperature = pc::temperature;
+    pc::temperature = 300.0_K;
+
+    SUBCASE("exchangeEnergy")
+    {
+        // hot replica with lower energy should always be accepted
+        CHECK_LT(ReplicaExchange::exchangeEnergy(10.0, 300.0, 5.0, 600.0), 0.0);
+        CHECK_EQ(ReplicaExchange::exchangeEnergy(10.0, 300.0, 5.0, 600.0), Approx(-2.5));
+        CHECK_EQ(ReplicaExchange::exchangeEnergy(5.0, 300.0, 10.0, 600.0), Approx(2.5));
+        CHECK_EQ(ReplicaExchange::exchangeEnergy(5.0, 300.0, 10.0, 300.0), Approx(0.0));
+    }
+
+    SUBCASE("partners")
+    {
+        Random random;
+        int even_count = 0;
+        for (int i = 0; i < 100; ++i) {
+            const auto pairs =
+                ReplicaExchange::partners(ReplicaExchange::PartnerPolicy::ODDEVEN, 5, random);
+            REQUIRE_EQ(pairs.size(), 2);
+            CHECK_EQ(pairs[0].second, pairs[0].first + 1);
+            CHECK_EQ(pairs[1].first, pairs[0].first + 2);
+            if (pairs[0].first == 0) {
+                even_count++;
+            }
+            else {
+                CHECK_EQ(pairs[1].second, 4);
+            }
+        }
+        CHECK_GT(even_count, 0);
+        CHECK_LT(even_count, 100);
+        CHECK(ReplicaExchange::partners(ReplicaExchange::PartnerPolicy::ODDEVEN, 1, random)
+                  .empty());
+    }
+
+    SUBCASE("replicaRandom")
+    {
+        const auto seed = 1234U;
+        CHECK_EQ(ReplicaExchange::replicaRandom(seed, 1, 0)(),
+                 ReplicaExchange::replicaRandom(seed, 1, 0)());
+        CHECK_NE(ReplicaExchange::replicaRandom(seed, 0, 0)(),
+                 ReplicaExchange::replicaRandom(seed, 1, 0)());
+        CHECK_NE(ReplicaExchange::replicaRandom(seed, 0, 0)(),
+                 ReplicaExchange::replicaRandom(seed, 0, 1)());
+        CHECK_NE(ReplicaExchange::replicaRandom(seed, 0, 0)(),
+                 ReplicaExchange::replicaRandom(seed + 1, 0, 0)());
+    }
+
+    // repulsive ions so that all energies are finite
+    const auto input = R"({
+        "temperature": 300,
+        "geometry": {"type": "cuboid", "length": 20},
+        "atomlist": [{"A": {"q": 1.0, "sigma": 2.0, "dp": 4.0}}],
+        "moleculelist": [{"ions": {"atoms": ["A"], "atomic": true}}],
+        "insertmolecules": [{"ions": {"N": 6}}],
+        "energy": [{"nonbonded": {"default": [{"coulomb": {"type": "plain", "epsr": 80}}]}}],
+        "moves": [{"transrot": {"molecule": "ions"}}]})"_json;
+
+    SUBCASE("temperature scaling in Metropolis criterion")
+    {
+        auto acceptance = [&](const double temperature) {
+            move::Move::slump = Random();
+            MetropolisMonteCarlo simulation(input);
+            simulation.setTemperature(temperature);
+            CHECK_EQ(simulation.getTemperature(), Approx(temperature));
+            for (int i = 0; i < 50; ++i) {
+                simulation.sweep();
+            }
+            CHECK_LT(std::fabs(simulation.relativeEnergyDrift()), 1e-9); // energies not scaled
+            const json j = simulation;
+            CHECK_EQ(j.at("temperature").get<double>(), Approx(temperature));
+            return j.at("moves").at(0).begin()->at("acceptance").get<double>();
+        };
+        CHECK_EQ(acceptance(1e12), Approx(1.0)); // energy changes scaled to almost zero
+        CHECK_LT(acceptance(0.01), acceptance(300.0));
+    }
+
+    SUBCASE("copyState after exchange")
+    {
+        const auto settings = R"({"temperatures": [300, 310], "threads": 2})"_json;
+        ReplicaExchange replica_exchange(input, settings);
+        const auto* replica_started_at_slot0 = &replica_exchange.at(0);
+        for (int i = 0; i < 200 && &replica_exchange.at(0) == replica_started_at_slot0; ++i) {
+            replica_exchange.sweep();
+        }
+        REQUIRE_NE(&replica_exchange.at(0), replica_started_at_slot0); // replicas have swapped
+        CHECK_EQ(replica_exchange.at(0).getTemperature(), Approx(300.0));
+        CHECK_EQ(replica_exchange.at(1).getTemperature(), Approx(310.0));
+
+        MetropolisMonteCarlo::State state;
+        from_json(input, state);
+        replica_exchange.copyState(0, state);
+        const auto& source = replica_exchange.at(0).getSpace();
+        REQUIRE_EQ(state.spc->particles.size(), source.particles.size());
+        for (std::size_t i = 0; i < source.particles.size(); ++i) {
+            CHECK_EQ(state.spc->particles[i].pos.x(), Approx(source.particles[i].pos.x()));
+        }
+        Change change;
+        change.everything = true;
+        CHECK_EQ(state.pot->energy(change), Approx(replica_exchange.at(0).getEnergy()));
+    }
+    pc::temperature = temperature;
+}
+
+} // namespace Faunus
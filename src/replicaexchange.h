@@ -0,0 +1,97 @@
+#pragma once
+
+#include "core.h"
+#include "average.h"
+#include "montecarlo.h"
+#include "random.h"
+#include "threadpool.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace Faunus {
+
+/**
+ * @brief Parallel tempering of several replicas within a single process
+ *
+ * Each replica is a complete `MetropolisMonteCarlo` simulation built from the same input. They
+ * are propagated simultaneously on a thread pool. Every `nstep` sweep, replicas at neighboring
+ * temperatures attempt to swap temperatures, i.e. labels, rather than coordinates. Hence a
+ * swap costs nothing more than the acceptance test, as the potential energies of all
+ * replicas are tracked by the Monte Carlo loop.
+ *
+ * Each replica owns random number engines that are swapped into the thread local
+ * `move::Move::slump` and `Faunus::random` while it runs, making the simulation reproducible
+ * regardless of which thread runs a replica. The engines are explicitly seeded from the
+ * replica index and a seed drawn from the global `Faunus::random`, i.e. the top-level
+ * `random` input, so that all replicas have different streams.
+ *
+ * The temperature ladder is indexed by _slots_ and `at()` gives the replica currently
+ * at a given slot.
+ */
+class ReplicaExchange
+{
+  public:
+    enum class PartnerPolicy
+    {
+        ODDEVEN,
+        INVALID
+    }; //!< Policies for pairing neighboring temperatures
+
+  private:
+    struct Replica
+    {
+        std::unique_ptr<MetropolisMonteCarlo> simulation;
+        Random move_random;   //!< Swapped with `move::Move::slump` while running
+        Random global_random; //!< Swapped with `Faunus::random` while running
+    };
+    using SlotPair = std::pair<std::size_t, std::size_t>;
+
+    std::vector<Replica> replicas;
+    std::vector<double> temperatures;                   //!< Temperature ladder (K); one per slot
+    std::vector<std::size_t> replica_at_slot;           //!< Index of replica at each slot
+    std::map<SlotPair, Average<double>> acceptance_map; //!< Exchange statistics
+    PartnerPolicy partner_policy = PartnerPolicy::ODDEVEN;
+    unsigned int exchange_interval = 1;   //!< Number of sweeps between exchange attempts
+    unsigned int number_of_sweeps = 0;    //!< Number of calls to `sweep()`
+    Random random;                        //!< For partner selection and acceptance
+    ThreadPool thread_pool;               //!< Propagates replicas
+    std::vector<ThreadPool::Task> tasks;  //!< One sweep for each replica
+    std::string filename;                 //!< File name for exchange statistics
+    std::unique_ptr<std::ostream> stream; //!< Log exchange statistics in file
+
+    void exchange();                                     //!< Attempt exchanges between partners
+    bool exchange(std::size_t slot1, std::size_t slot2); //!< Attempt exchange of two slots
+    void writeToFileStream() const;                      //!< Write replica at each slot to file
+
+  public:
+    /**
+     * @param input Faunus input used to construct all replicas
+     * @param j Replica exchange settings, i.e. temperatures etc.
+     */
+    ReplicaExchange(const json& input, const json& j);
+    void sweep();                                  //!< Sweep all replicas and maybe exchange
+    std::size_t size() const;                      //!< Number of replicas
+    MetropolisMonteCarlo& at(std::size_t slot);    //!< Replica currently at given slot
+    double getTemperature(std::size_t slot) const; //!< Temperature (K) of slot
+    void copyState(std::size_t slot,
+                   MetropolisMonteCarlo::State& destination); //!< Copy accepted state of slot
+
+    static std::vector<SlotPair> partners(PartnerPolicy policy, std::size_t number_of_slots,
+                                          Random& random); //!< Slots to attempt exchange
+    static double exchangeEnergy(double energy1, double temperature1, double energy2,
+                                 double temperature2); //!< Energy (kT) of swapping temperatures
+    static Random replicaRandom(std::uint32_t seed, std::size_t replica_index,
+                                unsigned int stream); //!< Random engine of a replica
+    friend void to_json(json& j, const ReplicaExchange& replica_exchange);
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(ReplicaExchange::PartnerPolicy,
+                             {{ReplicaExchange::PartnerPolicy::INVALID, nullptr},
+                              {ReplicaExchange::PartnerPolicy::ODDEVEN, "oddeven"}})
+
+void to_json(json& j, const ReplicaExchange& replica_exchange);
+
+} // namespace Faunus
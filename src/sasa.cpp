@@ -1,7 +1,11 @@
 #include "sasa.h"
 #include "particle.h"
 #include "space.h"
+#include "threadpool.h"
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <numeric>
 #include <range/v3/view/zip.hpp>
 #include <doctest/doctest.h>
 
@@ -17,13 +21,58 @@ namespace SASA {
 void SASABase::updateSASA(const std::vector<SASA::Neighbours>& neighbours,
                           const std::vector<index_type>& target_indices)
 {
-    // here is a potential place for parallelization?
-    // #pragma OMP parallel num_threads(2)
-    //{
     for (const auto& [neighbour, index] : ranges::views::zip(neighbours, target_indices)) {
         areas.at(index) = calcSASAOfParticle(neighbour);
     }
-    //}
+}
+
+/**
+ * The target indices are split into one contiguous chunk per thread. Each thread reuses
+ * a thread-local neighbour buffer, so that no memory is allocated once buffers have grown.
+ * Target indices must be unique as each area is written by exactly one thread.
+ */
+template <typename Function>
+void SASABase::forEachTarget(const Space& spc, const std::vector<index_type>& target_indices,
+                             Function function) const
+{
+    auto process_range = [&](const std::size_t first, const std::size_t last) {
+        thread_local Neighbours neighbours;
+        for (auto i = first; i < last; ++i) {
+            calcNeighbourDataOfParticle(spc, target_indices[i], neighbours);
+            function(target_indices[i], neighbours);
+        }
+    };
+    const auto number_of_threads = thread_pool ? thread_pool->size() : 1;
+    if (number_of_threads == 1 || target_indices.size() < 2 * number_of_threads) {
+        process_range(0, target_indices.size());
+        return;
+    }
+    const auto chunk_size = (target_indices.size() + number_of_threads - 1) / number_of_threads;
+    std::vector<ThreadPool::Task> tasks;
+    tasks.reserve(number_of_threads);
+    for (std::size_t first = 0; first < target_indices.size(); first += chunk_size) {
+        const auto last = std::min(first + chunk_size, target_indices.size());
+        tasks.emplace_back([&process_range, first, last]() { process_range(first, last); });
+    }
+    thread_pool->run(tasks);
+}
+
+/**
+ * @brief updates sasa of target particles, finding neighbours on the fly
+ * @param spc Space with particle positions
+ * @param target_indices unique absolute indicies of target particles in ParticleVector
+ * @param neighbour_indices if given, neighbour indices of each target are stored herein
+ */
+void SASABase::updateSASA(const Space& spc, const std::vector<index_type>& target_indices,
+                          std::vector<std::vector<index_type>>* neighbour_indices)
+{
+    forEachTarget(spc, target_indices, [&](const index_type index, const Neighbours& neighbours) {
+        areas[index] = calcSASAOfParticle(neighbours);
+        if (neighbour_indices) {
+            (*neighbour_indices)[index].assign(neighbours.indices.begin(),
+                                               neighbours.indices.end());
+        }
+    });
 }
 
 double SASABase::calcSASAOfParticle(const Space& spc, const Particle& particle) const
@@ -32,6 +81,14 @@ double SASABase::calcSASAOfParticle(const Space& spc, const Particle& particle)
     return calcSASAOfParticle(neighbours);
 }
 
+double SASABase::calcSASAOfParticle(const SASABase::Neighbours& neighbour) const
+{
+    if (method == Method::POINTS) {
+        return calcSASAOfParticleByPoints(neighbour);
+    }
+    return calcSASAOfParticleBySlices(neighbour);
+}
+
 /**
  * @brief Calcuates SASA of a single particle defined by NeighbourData object
  * @details cuts a sphere in z-direction, for each slice, radius of circle_i in the corresponding
@@ -41,13 +98,14 @@ double SASABase::calcSASAOfParticle(const Space& spc, const Particle& particle)
  * arcs into vector, finally from this vector, calculate the exposed part of circle_i
  * @param neighbour NeighbourData object of given particle
  */
-double SASABase::calcSASAOfParticle(const SASABase::Neighbours& neighbour) const
+double SASABase::calcSASAOfParticleBySlices(const SASABase::Neighbours& neighbour) const
 {
     const auto sasa_radius_i = sasa_radii.at(neighbour.index);
     double area(0.);
 
     auto slice_height = 2. * sasa_radius_i / slices_per_atom;
     auto z = -sasa_radius_i - 0.5 * slice_height;
+    thread_local std::vector<std::pair<double, double>> arcs; // reused to avoid allocations
 
     for (int islice = 0; islice != slices_per_atom; ++islice) {
         z += slice_height;
@@ -61,11 +119,11 @@ double SASABase::calcSASAOfParticle(const SASABase::Neighbours& neighbour) const
             continue;
         } /* round-off errors */
 
-        std::vector<std::pair<double, double>> arcs;
+        arcs.clear();
         bool is_buried = false;
         for (const auto& [d_r, neighbour_index] :
              ranges::views::zip(neighbour.points, neighbour.indices)) {
-            const auto sasa_radius_j = sasa_radii.at(neighbour_index);
+            const auto sasa_radius_j = sasa_radii[neighbour_index];
             const auto z_distance = std::fabs(d_r.z() - z);
 
             if (z_distance < sasa_radius_j) {
@@ -143,11 +201,132 @@ double SASABase::exposedArcLength(std::vector<std::pair<double, double>>& arcs)
     return total_arc_angle + two_pi - end_arc_angle;
 }
 
+/**
+ * @brief Calculates SASA of a single particle by counting exposed points on its surface
+ * @details Each neighbour buries the points that lie within its sphere. Exposed points are
+ * kept in a bitmask so that points already buried are skipped for subsequent neighbours.
+ * @param neighbour NeighbourData object of given particle
+ */
+double SASABase::calcSASAOfParticleByPoints(const SASABase::Neighbours& neighbour) const
+{
+    constexpr std::size_t bits_per_word = 64;
+    const auto sasa_radius_i = sasa_radii.at(neighbour.index);
+    const auto number_of_points = unit_sphere_points.size();
+    const auto number_of_words = (number_of_points + bits_per_word - 1) / bits_per_word;
+
+    thread_local std::vector<std::uint64_t> exposed; // reused to avoid allocations
+    exposed.assign(number_of_words, ~std::uint64_t(0));
+    if (const auto remainder = number_of_points % bits_per_word; remainder != 0) {
+        exposed.back() = (std::uint64_t(1) << remainder) - 1;
+    }
+
+    for (const auto& [d_r, neighbour_index] :
+         ranges::views::zip(neighbour.points, neighbour.indices)) {
+        // neighbour position and radius in units of the radius of particle i
+        const Point center = -d_r / sasa_radius_i;
+        const auto sqrd_radius_j = std::pow(sasa_radii[neighbour_index] / sasa_radius_i, 2);
+        std::uint64_t any_exposed = 0;
+        for (std::size_t word_index = 0; word_index < number_of_words; ++word_index) {
+            auto& word = exposed[word_index];
+            for (auto bits = word; bits != 0; bits &= bits - 1) {
+                const auto bit = std::countr_zero(bits);
+                const auto& point = unit_sphere_points[word_index * bits_per_word + bit];
+                if ((point - center).squaredNorm() < sqrd_radius_j) {
+                    word &= ~(std::uint64_t(1) << bit);
+                }
+            }
+            any_exposed |= word;
+        }
+        if (any_exposed == 0) {
+            return 0.0;
+        }
+    }
+    const auto number_of_exposed_points = std::accumulate(
+        exposed.begin(), exposed.end(), 0,
+        [](const auto sum, const auto word) { return sum + std::popcount(word); });
+    return 4.0 * std::numbers::pi * sasa_radius_i * sasa_radius_i * number_of_exposed_points /
+           static_cast<double>(number_of_points);
+}
+
 const std::vector<double>& SASABase::getAreas() const
 {
     return areas;
 }
 
+/**
+ * @param method area algorithm
+ * @param points_per_atom number of points on each sphere; used only for `Method::POINTS`
+ *
+ * The points are distributed on a golden spiral, which gives nearly equal area per point.
+ */
+void SASABase::setMethod(const Method method, const int points_per_atom)
+{
+    if (method == Method::POINTS && points_per_atom < 1) {
+        throw ConfigurationError("number of SASA points must be positive");
+    }
+    this->method = method;
+    unit_sphere_points.clear();
+    if (method == Method::POINTS) {
+        const auto golden_angle = std::numbers::pi * (3.0 - std::sqrt(5.0));
+        unit_sphere_points.reserve(points_per_atom);
+        for (int i = 0; i < points_per_atom; ++i) {
+            const auto z = 1.0 - (2.0 * i + 1.0) / points_per_atom;
+            const auto radius = std::sqrt(1.0 - z * z);
+            const auto theta = golden_angle * i;
+            unit_sphere_points.emplace_back(radius * std::cos(theta), radius * std::sin(theta), z);
+        }
+    }
+}
+
+void SASABase::setThreadPool(std::shared_ptr<ThreadPool> pool)
+{
+    thread_pool = std::move(pool);
+}
+
+SASABase::Method SASABase::getMethod() const
+{
+    return method;
+}
+
+/**
+ * Reads `method` (`slices` or `points`), `points`, and `threads`. A thread pool is created
+ * only if more than one thread is requested; zero selects the number of hardware threads.
+ */
+void SASABase::from_json(const json& j)
+{
+    setMethod(j.value("method", Method::SLICES), j.value("points", 400));
+    if (const auto threads = j.value("threads", 1U); threads != 1) {
+        setThreadPool(std::make_shared<ThreadPool>(threads));
+    }
+}
+
+/**
+ * @brief calculates neighbourData objects of particles specified by target indices in
+ * ParticleVector
+ * @param space
+ * @param target_indices absolute indicies of target particles in ParticleVector
+ */
+std::vector<SASABase::Neighbours>
+SASABase::calcNeighbourData(const Space& spc, const std::vector<index_type>& target_indices) const
+{
+    return target_indices | std::views::transform([&](auto index) {
+               return calcNeighbourDataOfParticle(spc, index);
+           }) |
+           ranges::to<std::vector>;
+}
+
+/**
+ * @brief calculates neighbourData object of a target particle specified by target index in
+ * ParticleVector
+ */
+SASABase::Neighbours SASABase::calcNeighbourDataOfParticle(const Space& spc,
+                                                           const index_type target_index) const
+{
+    Neighbours neighbours;
+    calcNeighbourDataOfParticle(spc, target_index, neighbours);
+    return neighbours;
+}
+
 /**
  * @param spc
  * @param probe_radius in angstrom
@@ -180,16 +359,17 @@ void SASA::init(const Space& spc)
  * @brief using the naive O(N) neighbour search for a given target particle
  * @param space
  * @param target_index indicex of target particle in ParticleVector
+ * @param neighbours neighbour buffer to fill; previous content is discarded
  */
-SASA::Neighbours SASA::calcNeighbourDataOfParticle(const Space& spc,
-                                                   const index_type target_index) const
+void SASA::calcNeighbourDataOfParticle(const Space& spc, const index_type target_index,
+                                       Neighbours& neighbours) const
 {
-
-    SASA::Neighbours neighbour;
+    neighbours.points.clear();
+    neighbours.indices.clear();
 
     const auto& particle_i = spc.particles.at(target_index);
     const auto sasa_radius_i = sasa_radii.at(target_index);
-    neighbour.index = target_index;
+    neighbours.index = target_index;
 
     for (const auto& particle_j : spc.activeParticles()) {
         const auto neighbour_index = indexOf(particle_j);
@@ -199,27 +379,10 @@ SASA::Neighbours SASA::calcNeighbourDataOfParticle(const Space& spc,
         if (target_index != neighbour_index &&
             spc.geometry.sqdist(particle_i.pos, particle_j.pos) < sq_cutoff) {
             const auto dr = spc.geometry.vdist(particle_i.pos, particle_j.pos);
-            neighbour.points.push_back(dr);
-            neighbour.indices.push_back(neighbour_index);
+            neighbours.points.push_back(dr);
+            neighbours.indices.push_back(neighbour_index);
         }
     }
-    return neighbour;
-}
-
-/**
- * @brief calculates neighbourData objects of particles specified by target indices in
- * ParticleVector
- * @param space
- * @param target_indices absolute indicies of target particles in ParticleVector
- */
-std::vector<SASA::Neighbours>
-SASA::calcNeighbourData(const Space& spc, const std::vector<index_type>& target_indices) const
-{
-
-    return target_indices | std::views::transform([&](auto index) {
-               return calcNeighbourDataOfParticle(spc, index);
-           }) |
-           ranges::to<std::vector>;
 }
 
 /**
@@ -235,6 +398,7 @@ SASA::SASA(const Space& spc, double probe_radius, int slices_per_atom)
 SASA::SASA(const json& j, const Space& spc)
     : SASABase(spc, j.value("radius", 1.4) * 1.0_angstrom, j.value("slices", 20))
 {
+    SASABase::from_json(j);
 }
 
 /**
@@ -319,6 +483,25 @@ TEST_CASE("[Faunus] SASAPBC")
         CHECK_EQ(areas[0], Approx(3.4 * 3.4 * M_PI * 4));
         CHECK_EQ(areas[1], Approx(0.));
     }
+
+    SUBCASE("points method")
+    {
+        sasa.setMethod(SASABase::Method::POINTS, 2000);
+        spc.particles.at(0).pos = {30.0, 0.0, 0.0};
+        spc.particles.at(1).pos = {5.0, 0.0, 0.0};
+        sasa.updateSASA(spc, {0, 1});
+        CHECK_EQ(sasa.getAreas()[0], Approx(3.4 * 3.4 * M_PI * 4.));
+
+        spc.particles.at(0).pos = {7.0, 0.0, 0.0};
+        sasa.updateSASA(spc, {0, 1});
+        CHECK_EQ(sasa.getAreas()[0], Approx(119.48260171150575).epsilon(0.01));
+
+        spc.particles.at(0).pos = {1.0, 0.0, 0.0};
+        spc.particles.at(1).pos = {1.1, 0.0, 0.0};
+        sasa.updateSASA(spc, {0, 1});
+        CHECK_EQ(sasa.getAreas()[1], Approx(0.));
+        CHECK_THROWS(sasa.setMethod(SASABase::Method::POINTS, 0));
+    }
 }
 
 /**
@@ -336,6 +519,7 @@ template <typename CellList>
 SASACellList<CellList>::SASACellList(const json& j, const Space& spc)
     : SASABase(spc, j.value("radius", 1.4) * 1.0_angstrom, j.value("slices", 20))
 {
+    SASABase::from_json(j);
 }
 
 /**
@@ -369,14 +553,15 @@ template <typename CellList> void SASACellList<CellList>::init(const Space& spc)
  * @brief specified by target index in ParticleVector using cell list
  * @param space
  * @param target_index indicex of target particle in ParticleVector
+ * @param neighbours neighbour buffer to fill; previous content is discarded
  */
 template <typename CellList>
-SASABase::Neighbours
-SASACellList<CellList>::calcNeighbourDataOfParticle(const Space& spc,
-                                                    const index_type target_index) const
+void SASACellList<CellList>::calcNeighbourDataOfParticle(const Space& spc,
+                                                         const index_type target_index,
+                                                         Neighbours& neighbours) const
 {
-
-    SASABase::Neighbours neighbours;
+    neighbours.points.clear();
+    neighbours.indices.clear();
 
     const auto& particle_i = spc.particles.at(target_index);
     neighbours.index = target_index;
@@ -384,15 +569,15 @@ SASACellList<CellList>::calcNeighbourDataOfParticle(const Space& spc,
     const auto& center_cell =
         cell_list->getGrid().coordinatesAt(particle_i.pos + 0.5 * spc.geometry.getLength());
 
-    auto neighour_particles_at = [&](const CellCoord& offset) {
+    auto neighour_particles_at = [&](const CellCoord& offset) -> decltype(auto) {
         return cell_list->getNeighborMembers(center_cell, offset);
     };
 
     for (const auto& cell_offset : cell_offsets) {
         const auto& neighbour_particle_indices = neighour_particles_at(cell_offset);
         for (const auto neighbour_particle_index : neighbour_particle_indices) {
-            const auto& particle_j = spc.particles.at(neighbour_particle_index);
-            const auto sasa_radius_j = sasa_radii.at(neighbour_particle_index);
+            const auto& particle_j = spc.particles[neighbour_particle_index];
+            const auto sasa_radius_j = sasa_radii[neighbour_particle_index];
             const auto sq_cutoff =
                 (sasa_radius_i + sasa_radius_j) * (sasa_radius_i + sasa_radius_j);
 
@@ -404,24 +589,6 @@ SASACellList<CellList>::calcNeighbourDataOfParticle(const Space& spc,
             }
         }
     }
-    return neighbours;
-}
-
-/**
- * @brief calculates neighbourData objects of particles
- * @brief specified by target indices in ParticleVector using cell lists
- * @param space
- * @param target_indices absolute indicies of target particles in ParticleVector
- */
-template <typename CellList>
-std::vector<SASABase::Neighbours>
-SASACellList<CellList>::calcNeighbourData(const Space& spc,
-                                          const std::vector<index_type>& target_indices) const
-{
-    return target_indices | std::views::transform([&](auto index) {
-               return calcNeighbourDataOfParticle(spc, index);
-           }) |
-           ranges::to<std::vector>;
 }
 
 /**
@@ -616,6 +783,28 @@ TEST_CASE("[Faunus] SASA_CellList")
         CHECK(neighbours[0].indices.empty());
         CHECK(neighbours[1].indices.empty());
     }
+    SUBCASE("thread pool")
+    {
+        json j = R"({
+        "geometry": {"type": "cuboid", "length": [15.0, 15.0, 15.0] },
+        "insertmolecules": [ { "M": { "N": 10 } } ]
+        })"_json;
+        Space spc = j;
+        std::vector<index_type> indices(spc.particles.size());
+        std::iota(indices.begin(), indices.end(), 0);
+
+        SASACellList<SparsePeriodicCellList> sasa(spc, 1.4_angstrom, 20);
+        sasa.init(spc);
+        std::vector<std::vector<index_type>> serial_neighbours(indices.size());
+        sasa.updateSASA(spc, indices, &serial_neighbours);
+        const auto serial_areas = sasa.getAreas();
+
+        sasa.setThreadPool(std::make_shared<ThreadPool>(3));
+        std::vector<std::vector<index_type>> parallel_neighbours(indices.size());
+        sasa.updateSASA(spc, indices, &parallel_neighbours);
+        CHECK(sasa.getAreas() == serial_areas);
+        CHECK(parallel_neighbours == serial_neighbours);
+    }
 }
 
 } // namespace Faunus
@@ -7,10 +7,12 @@
 #include "particle.h"
 #include <range/v3/numeric.hpp>
 #include <numbers>
+#include <memory>
 
 namespace Faunus {
 
 class Space;
+class ThreadPool;
 
 namespace Geometry {
 class Chameleon;
@@ -27,6 +29,16 @@ using GeometryType = Geometry::Chameleon;
  * @brief base class for calculating solvent accessible surface areas of target particles
  *        derived classes implement specific neighbour search algorithms
  *
+ * Two algorithms are available for the area of a single particle:
+ *
+ * - `SLICES`: the sphere is cut into slices and the exposed arc of each slice is found
+ *   (Lee & Richards);
+ * - `POINTS`: a precomputed set of points on the unit sphere is scaled to the particle and
+ *   the fraction of points not buried by any neighbour is counted using a bitmask (Shrake &
+ *   Rupley).
+ *
+ * Scratch buffers are kept per thread so that repeated calculations do not allocate memory,
+ * and if a thread pool is set, the target particles of `updateSASA()` are split among threads.
  */
 class SASABase
 {
@@ -38,6 +50,12 @@ class SASABase
         index_type index;                //!< index of particle whose neighbours are in indices
     };
 
+    enum class Method
+    {
+        SLICES,
+        POINTS
+    };
+
     bool needs_syncing = false;
     //!< flag indicating if syncing of cell_lists is needed
     //!< this is important  in case there is a particle insertion
@@ -50,6 +68,9 @@ class SASABase
     int slices_per_atom = 20;       //!< number of slices of each sphere in SASA calculation
     const double two_pi = 2.0 * std::numbers::pi;
     const Particle* first_particle; //! first particle in ParticleVector
+    Method method = Method::SLICES; //!< algorithm used for the area of a single particle
+    PointVector unit_sphere_points; //!< evenly distributed points on unit sphere (POINTS only)
+    std::shared_ptr<ThreadPool> thread_pool; //!< distributes target particles; serial if empty
 
     /**
      * @brief returns absolute index of particle in ParticleVector
@@ -61,8 +82,15 @@ class SASABase
     }
 
     [[nodiscard]] double calcSASAOfParticle(const Neighbours& neighbour) const;
+    [[nodiscard]] double calcSASAOfParticleBySlices(const Neighbours& neighbour) const;
+    [[nodiscard]] double calcSASAOfParticleByPoints(const Neighbours& neighbour) const;
     double exposedArcLength(std::vector<std::pair<double, double>>& arcs) const;
 
+    //! Run `function(index, thread_local_neighbours)` for all target indices, possibly in parallel
+    template <typename Function>
+    void forEachTarget(const Space& spc, const std::vector<index_type>& target_indices,
+                       Function function) const;
+
   public:
     [[nodiscard]] double calcSASAOfParticle(const Space& spc, const Particle& particle) const;
 
@@ -86,18 +114,29 @@ class SASABase
 
     void updateSASA(const std::vector<SASABase::Neighbours>& neighbours_data,
                     const std::vector<index_type>& target_indices);
+    void updateSASA(const Space& spc, const std::vector<index_type>& target_indices,
+                    std::vector<std::vector<index_type>>* neighbour_indices = nullptr);
 
     virtual void init(const Space& spc) = 0;
-    [[nodiscard]] virtual std::vector<SASABase::Neighbours>
-    calcNeighbourData(const Space& spc, const std::vector<index_type>& target_indices) const = 0;
-    [[nodiscard]] virtual SASABase::Neighbours
-    calcNeighbourDataOfParticle(const Space& spc, index_type target_index) const = 0;
+    [[nodiscard]] std::vector<SASABase::Neighbours>
+    calcNeighbourData(const Space& spc, const std::vector<index_type>& target_indices) const;
+    [[nodiscard]] SASABase::Neighbours calcNeighbourDataOfParticle(const Space& spc,
+                                                                   index_type target_index) const;
+    virtual void calcNeighbourDataOfParticle(const Space& spc, index_type target_index,
+                                             Neighbours& neighbours) const = 0;
     virtual void update(const Space& spc, const Change& change) = 0;
     [[nodiscard]] const std::vector<double>& getAreas() const;
+    void setMethod(Method method, int points_per_atom = 400); //!< Select area algorithm
+    [[nodiscard]] Method getMethod() const;
+    void setThreadPool(std::shared_ptr<ThreadPool> pool);     //!< Use thread pool in `updateSASA()`
+    void from_json(const json& j); //!< Set method, points, and threads from user input
     SASABase(const Space& spc, double probe_radius, int slices_per_atom);
     virtual ~SASABase() = default;
 };
 
+NLOHMANN_JSON_SERIALIZE_ENUM(SASABase::Method, {{SASABase::Method::SLICES, "slices"},
+                                                {SASABase::Method::POINTS, "points"}})
+
 /**
  * @brief derived class of SASABase which uses O(N^2) neighbour search
  *
@@ -105,12 +144,10 @@ class SASABase
 class SASA : public SASABase
 {
   public:
+    using SASABase::calcNeighbourDataOfParticle;
     void init(const Space& spc) override;
-    [[nodiscard]] std::vector<SASABase::Neighbours>
-    calcNeighbourData(const Space& spc,
-                      const std::vector<index_type>& target_indices) const override;
-    [[nodiscard]] SASA::Neighbours
-    calcNeighbourDataOfParticle(const Space& spc, index_type target_index) const override;
+    void calcNeighbourDataOfParticle(const Space& spc, index_type target_index,
+                                     Neighbours& neighbours) const override;
     void update([[maybe_unused]] const Space& spc, [[maybe_unused]] const Change& change) override;
     SASA(const Space& spc, double probe_radius, int slices_per_atom);
     SASA(const json& j, const Space& spc);
@@ -133,15 +170,13 @@ template <typename CellList> class SASACellList : public SASABase
         cell_offsets; //!< holds offsets which define a 3x3x3 cube around central cell
 
   public:
+    using SASABase::calcNeighbourDataOfParticle;
     SASACellList(const Space& spc, double probe_radius, int slices_per_atom);
     SASACellList(const json& j, const Space& spc);
     ~SASACellList() override = default;
     void init(const Space& spc) override;
-    [[nodiscard]] SASABase::Neighbours
-    calcNeighbourDataOfParticle(const Space& spc, index_type target_index) const override;
-    [[nodiscard]] std::vector<SASABase::Neighbours>
-    calcNeighbourData(const Space& spc,
-                      const std::vector<index_type>& target_indices) const override;
+    void calcNeighbourDataOfParticle(const Space& spc, index_type target_index,
+                                     Neighbours& neighbours) const override;
     void update(const Space& spc, const Change& change) override;
 
   private:
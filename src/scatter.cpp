@@ -45,6 +45,45 @@ TEST_CASE("Benchmark")
 }
 #endif
 
+TEST_CASE("[Faunus] DebyeFormula")
+{
+    std::vector<Point> positions(200);
+    for (auto& position : positions) {
+        position = Eigen::Vector3d::Random() * 40.0;
+    }
+    DebyeFormula<FormFactorUnity<double>, double> exact(0.05, 1.0, 0.05, 1000.0);
+    DebyeFormula<FormFactorUnity<double>, double> binned(0.05, 1.0, 0.05, 1000.0);
+    binned.setHistogramResolution(0.001);
+    CHECK_EQ(binned.getHistogramResolution(), Approx(0.001));
+    for (int sample = 0; sample < 2; ++sample) {
+        exact.sample(positions);
+        binned.sample(positions);
+    }
+    const auto exact_intensity = exact.getIntensity();
+    const auto binned_intensity = binned.getIntensity();
+    REQUIRE_EQ(exact_intensity.size(), binned_intensity.size());
+    for (auto [q, intensity] : exact_intensity) {
+        CHECK_EQ(binned_intensity.at(q), Approx(intensity).epsilon(1e-3));
+    }
+}
+
+#ifdef ANKERL_NANOBENCH_H_INCLUDED
+TEST_CASE("Benchmark DebyeFormula")
+{
+    std::vector<Point> positions(1000);
+    for (auto& position : positions) {
+        position = Eigen::Vector3d::Random() * 40.0;
+    }
+    ankerl::nanobench::Bench bench;
+    bench.minEpochIterations(10);
+    DebyeFormula<FormFactorUnity<float>> exact(0.01, 1.0, 0.01, 1000.0);
+    DebyeFormula<FormFactorUnity<float>> binned(0.01, 1.0, 0.01, 1000.0);
+    binned.setHistogramResolution(0.01);
+    bench.run("exact", [&] { exact.sample(positions); });
+    bench.run("histogram", [&] { binned.sample(positions); });
+}
+#endif
+
 TEST_CASE("[Faunus] StructureFactorIPBC")
 {
     size_t cnt = 0;
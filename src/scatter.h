@@ -111,10 +111,12 @@ template <class Tformfactor, std::floating_point T = float> class DebyeFormula
         }
     }
 
-    T r_cutoff;               //!< cut-off distance for scattering contributions (angstrom)
-    Tformfactor form_factor;  //!< scattering from a single particle
-    std::vector<T> intensity; //!< sampled average I(q)
-    std::vector<T> sampling;  //!< weighted number of samplings
+    T r_cutoff;                 //!< cut-off distance for scattering contributions (angstrom)
+    Tformfactor form_factor;    //!< scattering from a single particle
+    std::vector<T> intensity;   //!< sampled average I(q)
+    std::vector<T> sampling;    //!< weighted number of samplings
+    T histogram_resolution = 0; //!< pair distance bin width (angstrom); zero for exact sampling
+    std::vector<T> sinc_table;  //!< sin(qr)/(qr) for each distance bin (row) and q (column)
 
   public:
     DebyeFormula(T q_min, T q_max, T q_step, T r_cutoff)
@@ -144,8 +146,43 @@ template <class Tformfactor, std::floating_point T = float> class DebyeFormula
      * The quadratic complexity in N comes from the fact that the radial distribution function has
      * to be computed. The current implementation supports OpenMP parallelization. Roughly half of
      * the execution time is spend on computing sin values, e.g., in sinf_avx2.
+     *
+     * If a histogram resolution is set, pair distances are instead binned and the complexity
+     * becomes O(N^2) + O(B) * O(M) where B is the number of bins.
+     *
+     * @see setHistogramResolution()
      */
     template <class Tpvec> void sample(const Tpvec& p, const T weight = 1, const T volume = -1)
+    {
+        if (histogram_resolution > 0) {
+            addToAverage(p, pairSumFromHistogram(p), weight, volume);
+        }
+        else {
+            addToAverage(p, pairSum(p), weight, volume);
+        }
+    }
+
+    /**
+     * @brief Bin pair distances before the q-transform
+     * @param resolution Histogram bin width (angstrom); zero or negative disables binning
+     *
+     * Every pair distance is rounded to the center of its bin, giving a relative error in the
+     * sinc function of roughly `q * resolution / 2` at most. The form factor is evaluated for the
+     * first particle only and hence must be the same for all particles.
+     */
+    void setHistogramResolution(T resolution)
+    {
+        histogram_resolution = std::max(resolution, T(0));
+        sinc_table.clear();
+    }
+
+    T getHistogramResolution() const { return histogram_resolution; }
+
+  private:
+    /**
+     * @return pair sum of form factor weighted sinc functions for all mesh points
+     */
+    template <class Tpvec> std::vector<T> pairSum(const Tpvec& p)
     {
         const int N = (int)p.size();         // number of particles
         const int M = (int)intensity.size(); // number of mesh points
@@ -187,6 +224,104 @@ template <class Tformfactor, std::floating_point T = float> class DebyeFormula
             std::transform(intensity_sum.begin(), intensity_sum.end(),
                            intensity_sum_private.begin(), intensity_sum.begin(), std::plus<T>());
         }
+        return intensity_sum;
+    }
+
+    /**
+     * @brief Pair sum via a histogram of pair distances
+     *
+     * Each thread fills a private histogram which are merged at the end. The histogram is then
+     * transformed using a table of sinc values at the bin centers which is extended only when a
+     * longer distance than previously seen is encountered.
+     */
+    template <class Tpvec> std::vector<T> pairSumFromHistogram(const Tpvec& p)
+    {
+        const int N = (int)p.size();         // number of particles
+        const int M = (int)intensity.size(); // number of mesh points
+        std::vector<T> intensity_sum(M, 0.0);
+        if (N < 2) {
+            return intensity_sum;
+        }
+        const T inverse_resolution = 1 / histogram_resolution;
+        std::vector<std::size_t> histogram; // number of pairs in each distance bin
+
+#pragma omp parallel default(shared) shared(histogram)
+        {
+            std::vector<std::size_t> histogram_private;
+#pragma omp for schedule(dynamic)
+            for (int i = 0; i < N - 1; ++i) {
+                for (int j = i + 1; j < N; ++j) {
+                    const T r_squared = T(Faunus::Geometry::Sphere::sqdist(p[i], p[j]));
+                    if (r_squared < r_cutoff * r_cutoff) {
+                        const auto bin = static_cast<std::size_t>(std::sqrt(r_squared) *
+                                                                  inverse_resolution);
+                        if (bin >= histogram_private.size()) {
+                            histogram_private.resize(bin + 1, 0);
+                        }
+                        histogram_private[bin]++;
+                    }
+                }
+            }
+// reduce histogram_private into histogram
+#pragma omp critical
+            {
+                if (histogram_private.size() > histogram.size()) {
+                    histogram.resize(histogram_private.size(), 0);
+                }
+                std::transform(histogram_private.begin(), histogram_private.end(),
+                               histogram.begin(), histogram.begin(), std::plus<>());
+            }
+        }
+
+        updateSincTable(histogram.size());
+        for (std::size_t bin = 0; bin < histogram.size(); ++bin) {
+            if (histogram[bin] == 0) {
+                continue;
+            }
+            const auto count = static_cast<T>(histogram[bin]);
+            const T* sinc = &sinc_table[bin * M];
+            for (int m = 0; m < M; ++m) {
+                intensity_sum[m] += count * sinc[m];
+            }
+        }
+        for (int m = 0; m < M; ++m) {
+            const T q = q_mesh(m);
+            intensity_sum[m] *= form_factor(q, p[0]) * form_factor(q, p[0]);
+        }
+        return intensity_sum;
+    }
+
+    /**
+     * @brief Extend the sinc table to cover at least the given number of distance bins
+     *
+     * Row `b` holds sin(qr)/(qr) for all mesh points with r at the center of bin `b`.
+     */
+    void updateSincTable(const std::size_t number_of_bins)
+    {
+        const auto M = intensity.size();
+        const auto tabulated_bins = sinc_table.size() / M;
+        if (number_of_bins <= tabulated_bins) {
+            return;
+        }
+        sinc_table.resize(number_of_bins * M);
+        for (auto bin = tabulated_bins; bin < number_of_bins; ++bin) {
+            const T r = (T(bin) + T(0.5)) * histogram_resolution;
+            for (std::size_t m = 0; m < M; ++m) {
+                const T qr = q_mesh(static_cast<int>(m)) * r;
+                sinc_table[bin * M + m] = std::sin(qr) / qr;
+            }
+        }
+    }
+
+    /**
+     * @brief Add self-scattering and cut-off correction to pair sum and update average
+     */
+    template <class Tpvec>
+    void addToAverage(const Tpvec& p, const std::vector<T>& intensity_sum, const T weight,
+                      const T volume)
+    {
+        const int N = (int)p.size();         // number of particles
+        const int M = (int)intensity.size(); // number of mesh points
 
 // https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
 // #pragma omp parallel for default(none) shared(N, M, weight, volume) shared(p, r_cutoff,
@@ -209,6 +344,7 @@ template <class Tformfactor, std::floating_point T = float> class DebyeFormula
         }
     }
 
+  public:
     /**
      * @return a tuple of min, max, and step parameters of a q-mash
      */
@@ -130,6 +130,7 @@ void Space::clear()
     particles.clear();
     groups.clear();
     implicit_reservoir.clear();
+    updateRegistry();
 }
 
 /**
@@ -151,6 +152,7 @@ Space::GroupType& Space::addGroup(MoleculeData::index_type molid,
     if (new_particles.empty()) {
         throw std::runtime_error("cannot add empty molecule");
     }
+    const auto registry_was_valid = isRegistryValid();
     auto original_begin = particles.begin(); // used to detect if `particles` is relocated
     particles.insert(particles.end(), new_particles.begin(),
                      new_particles.end());     // insert particle into space
@@ -176,7 +178,141 @@ Space::GroupType& Space::addGroup(MoleculeData::index_type molid,
             throw std::runtime_error("indivisible by atomic group size: "s + moldata.name);
         }
     }
-    return groups.emplace_back(group);
+    auto& inserted_group = groups.emplace_back(group);
+    if (registry_was_valid) {
+        const auto group_index = groups.size() - 1;
+        const auto molecule_index = static_cast<std::size_t>(molid);
+        if (molecule_index >= molecule_registry.size()) {
+            molecule_registry.resize(molecule_index + 1);
+        }
+        molecule_registry[molecule_index].groups.push_back(group_index);
+        registered_atom_ids.resize(particles.size(), -1);
+        registered_group_sizes.push_back(0);
+        updateGroupRegistry(group_index, nullptr);
+    }
+    else {
+        updateRegistry();
+    }
+    return inserted_group;
+}
+
+/**
+ * Registries allow constant time lookup of molecule groups and atom counts. Besides all groups
+ * of each molecule type, the following is registered for each group and particle:
+ *
+ * - whether the group is full, i.e. size equals capacity
+ * - the atom id of each active particle
+ */
+void Space::updateRegistry()
+{
+    molecule_registry.assign(Faunus::molecules.size(), {});
+    active_atom_count.assign(Faunus::atoms.size(), 0);
+    registered_atom_ids.assign(particles.size(), -1);
+    registered_group_sizes.assign(groups.size(), 0);
+    for (std::size_t group_index = 0; group_index < groups.size(); ++group_index) {
+        const auto molecule_index = static_cast<std::size_t>(groups[group_index].id);
+        if (molecule_index >= molecule_registry.size()) {
+            molecule_registry.resize(molecule_index + 1);
+        }
+        molecule_registry[molecule_index].groups.push_back(group_index);
+        updateGroupRegistry(group_index, nullptr);
+    }
+}
+
+/**
+ * Only the groups in the change object are updated. For partial group changes, only the
+ * particles in the change object, and those (de)activated by a change in group size, are
+ * visited. The molecule type of a group must not change.
+ */
+void Space::updateRegistry(const Change& change)
+{
+    if (change.everything || !isRegistryValid()) {
+        updateRegistry();
+        return;
+    }
+    for (const auto& changed : change.groups) {
+        updateGroupRegistry(changed.group_index,
+                            changed.all ? nullptr : &changed.relative_atom_indices);
+    }
+}
+
+bool Space::isRegistryValid() const
+{
+    return registered_group_sizes.size() == groups.size() &&
+           registered_atom_ids.size() == particles.size();
+}
+
+const Space::MoleculeRegistry& Space::getMoleculeRegistry(MoleculeData::index_type molid) const
+{
+    static const MoleculeRegistry empty_registry;
+    const auto molecule_index = static_cast<std::size_t>(molid);
+    return (molid >= 0 && molecule_index < molecule_registry.size())
+               ? molecule_registry[molecule_index]
+               : empty_registry;
+}
+
+/**
+ * @param group_index Index of group to update
+ * @param relative_atom_indices Particles to update (relative to group); if `nullptr`, all
+ */
+void Space::updateGroupRegistry(const std::size_t group_index,
+                                const std::vector<Change::index_type>* relative_atom_indices)
+{
+    const auto& group = groups.at(group_index);
+
+    auto& active = molecule_registry.at(static_cast<std::size_t>(group.id)).active;
+    const auto it = std::lower_bound(active.begin(), active.end(), group_index);
+    const bool was_registered_active = it != active.end() && *it == group_index;
+    const bool is_active = group.size() == group.capacity();
+    if (is_active && !was_registered_active) {
+        active.insert(it, group_index);
+    }
+    else if (!is_active && was_registered_active) {
+        active.erase(it);
+    }
+
+    if (group.capacity() == 0) {
+        return;
+    }
+    const auto first_particle_index =
+        static_cast<std::size_t>(std::distance(particles.begin(), group.begin()));
+    auto update_particle = [&](const std::size_t relative_index) {
+        const int atomid = relative_index < group.size() ? group[relative_index].id : -1;
+        auto& registered_atomid = registered_atom_ids[first_particle_index + relative_index];
+        if (atomid == registered_atomid) {
+            return;
+        }
+        if (registered_atomid >= 0) {
+            active_atom_count[registered_atomid]--;
+        }
+        if (atomid >= 0) {
+            if (static_cast<std::size_t>(atomid) >= active_atom_count.size()) {
+                active_atom_count.resize(atomid + 1, 0);
+            }
+            active_atom_count[atomid]++;
+        }
+        registered_atomid = atomid;
+    };
+
+    auto& registered_size = registered_group_sizes[group_index];
+    if (relative_atom_indices == nullptr) {
+        for (std::size_t i = 0; i < group.capacity(); ++i) {
+            update_particle(i);
+        }
+    }
+    else {
+        for (const auto i : *relative_atom_indices) {
+            if (i < group.capacity()) {
+                update_particle(i);
+            }
+        }
+        const auto first = std::min(registered_size, group.size());
+        const auto last = std::max(registered_size, group.size());
+        for (auto i = first; i < last; ++i) { // (de)activated particles
+            update_particle(i);
+        }
+    }
+    registered_size = group.size();
 }
 
 /**
@@ -194,6 +330,12 @@ Space::GroupType& Space::addGroup(MoleculeData::index_type molid,
  * - groups
  * - particles
  * - implicit molecules
+ *
+ * For partial changes, only the touched particles are copied; inactive particles are included
+ * only if the matter has changed.
+ *
+ * If `Change::positions_only` is set, as for volume moves, only positions and mass centers
+ * are copied, leaving particle properties and extensions untouched.
  */
 void Space::sync(const Space& other, const Change& change)
 {
@@ -207,12 +349,22 @@ void Space::sync(const Space& other, const Change& change)
     if (change.volume_change or change.everything) {
         geometry = other.geometry; // copy simulation geometry
     }
-    if (change.everything) {                                  // deep copy *everything*
+    if (change.everything && change.positions_only) { // e.g. volume scaling; no deep copy
+        for (std::size_t i = 0; i < particles.size(); ++i) {
+            particles[i].pos = other.particles[i].pos;
+        }
+        for (std::size_t i = 0; i < groups.size(); ++i) {
+            assert(groups[i].size() == other.groups[i].size());
+            groups[i].mass_center = other.groups[i].mass_center;
+        }
+    }
+    else if (change.everything) {                             // deep copy *everything*
         implicit_reservoir = other.implicit_reservoir;        // copy all implicit molecules
         particles = other.particles;                          // copy all positions
         groups = other.groups;                                // copy all groups
         assert(particles.begin() != other.particles.begin()); // check deep copy problem
         assert(groups.front().begin() != other.groups.front().begin()); // check deep copy problem
+        updateRegistry(); // group sizes and atom ids may have changed without updating `other`
     }
     else {
         for (const auto& changed : change.groups) {                   // look over changed groups
@@ -223,7 +375,13 @@ void Space::sync(const Space& other, const Change& change)
                 implicit_reservoir[group.id] = other.implicit_reservoir.at(group.id);
             }
             else if (changed.all) {
-                group = other_group; // copy everything
+                if (change.matter_change || group.size() != other_group.size()) {
+                    group = other_group; // copy everything, including inactive particles
+                }
+                else {                              // inactive particles are untouched
+                    group.shallowCopy(other_group); // copy group data but *not* particles
+                    std::copy(other_group.begin(), other_group.end(), group.begin());
+                }
             }
             else {                              // copy only a subset
                 group.shallowCopy(other_group); // copy group data but *not* particles
@@ -233,7 +391,9 @@ void Space::sync(const Space& other, const Change& change)
                 }
             }
         }
+        updateRegistry(change);
     }
+    updateParticleArrays(change);
     // apply registered triggers
     std::ranges::for_each(onSyncTriggers, [&](auto& trigger) { trigger(*this, other, change); });
 }
@@ -293,6 +453,9 @@ Point Space::scaleVolume(double Vnew, Geometry::VolumeMethod method)
     if (method == Geometry::VolumeMethod::ISOCHORIC) { // ? not used for anything...
         Vold = std::pow(Vold, 1.0 / 3.0);              // ?
     }
+    if (maintain_particle_arrays) {
+        particle_arrays.update(particles);
+    }
     for (const auto& trigger_function :
          scaleVolumeTriggers) {              // external clients may have added function
         trigger_function(*this, Vold, Vnew); // to be triggered upon each volume change
@@ -300,6 +463,50 @@ Point Space::scaleVolume(double Vnew, Geometry::VolumeMethod method)
     return scale;
 }
 
+const ParticleArrays& Space::enableParticleArrays()
+{
+    if (!maintain_particle_arrays) {
+        maintain_particle_arrays = true;
+        particle_arrays.update(particles);
+    }
+    return particle_arrays;
+}
+
+bool Space::hasParticleArrays() const { return maintain_particle_arrays; }
+
+/**
+ * All rows are copied if everything, the volume, or the matter has changed, or if the number of
+ * particles differs from the mirror. Otherwise only rows of particles in the change are copied;
+ * implicit groups have no particles and are skipped.
+ */
+void Space::updateParticleArrays(const Change& change)
+{
+    if (!maintain_particle_arrays) {
+        return;
+    }
+    if (change.everything || change.volume_change || change.matter_change ||
+        particle_arrays.size() != particles.size()) {
+        particle_arrays.update(particles);
+        return;
+    }
+    for (const auto& group_change : change.groups) {
+        const auto& group = groups.at(group_change.group_index);
+        if (group.capacity() == 0) {
+            continue;
+        }
+        const auto first =
+            static_cast<std::size_t>(std::distance(particles.begin(), group.begin()));
+        if (group_change.all || group_change.relative_atom_indices.empty()) {
+            particle_arrays.update(particles, first, first + group.capacity());
+        }
+        else {
+            for (const auto i : group_change.relative_atom_indices) {
+                particle_arrays.update(first + i, particles[first + i]);
+            }
+        }
+    }
+}
+
 json Space::info()
 {
     json j = {{"number of particles", particles.size()},
@@ -326,9 +533,26 @@ json Space::info()
     return j;
 }
 
+/**
+ * For `Selection::ACTIVE` and `Selection::ALL`, the group is picked in constant time from the
+ * registry; other selections filter all groups of type `molid`.
+ */
 Space::GroupVector::iterator Space::randomMolecule(MoleculeData::index_type molid, Random& rand,
                                                    Space::Selection selection)
 {
+    if (!isRegistryValid()) {
+        updateRegistry();
+    }
+    if (selection == Selection::ACTIVE || selection == Selection::ALL) {
+        const auto& registry = getMoleculeRegistry(molid);
+        const auto& group_indices =
+            (selection == Selection::ACTIVE) ? registry.active : registry.groups;
+        if (group_indices.empty()) {
+            return groups.end();
+        }
+        const auto group_index = *rand.sample(group_indices.begin(), group_indices.end());
+        return groups.begin() + static_cast<std::ptrdiff_t>(group_index);
+    }
     auto found_molecules = findMolecules(molid, selection);
     if (std::ranges::empty(found_molecules)) {
         return groups.end();
@@ -419,12 +643,28 @@ std::size_t Space::getFirstActiveParticleIndex(const GroupType& group) const
 
 size_t Space::countAtoms(AtomData::index_type atomid) const
 {
-    return std::ranges::count_if(activeParticles(),
-                                 [&](auto& particle) { return particle.id == atomid; });
+    if (!isRegistryValid()) {
+        return std::ranges::count_if(activeParticles(),
+                                     [&](auto& particle) { return particle.id == atomid; });
+    }
+    return (atomid < active_atom_count.size()) ? active_atom_count[atomid] : 0;
 }
 
+std::size_t Space::numActiveMolecules(MoleculeData::index_type molid) const
+{
+    if (!isRegistryValid()) {
+        return std::ranges::count_if(groups, getGroupFilter(molid, Selection::ACTIVE));
+    }
+    return getMoleculeRegistry(molid).active.size();
+}
+
+/**
+ * Called after a move has modified the system. Registries are updated to reflect activated,
+ * deactivated, or swapped particles.
+ */
 void Space::updateInternalState(const Change& change)
 {
+    updateRegistry(change);
     std::for_each(changeTriggers.begin(), changeTriggers.end(),
                   [&](auto& trigger) { trigger(*this, change); });
 }
@@ -488,6 +728,7 @@ void from_json(const json& j, Space& spc)
                     throw ConfigurationError("load error");
                 }
             }
+            spc.updateRegistry();
         }
 
         if (auto it = j.find("implicit_reservoir"); it != j.end() && it->is_array()) {
@@ -606,6 +847,81 @@ TEST_CASE("[Faunus] Space")
         }
         CHECK_EQ(vals, std::vector<int>({1, 2, 6, 7, 8}));
     }
+
+    SUBCASE("sync positions only")
+    {
+        Space spc2;
+        spc2.geometry = spc1.geometry;
+        spc2.addGroup(0, p);
+        spc2.particles[0].pos.x() = 4;
+        spc2.particles[0].charge = 1;
+        spc2.groups[0].mass_center.x() = 3.5;
+        Change change;
+        change.everything = true;
+        change.positions_only = true;
+        spc1.sync(spc2, change);
+        CHECK_EQ(spc1.particles[0].pos.x(), doctest::Approx(4));
+        CHECK_EQ(spc1.particles[0].charge, doctest::Approx(0)); // untouched
+        CHECK_EQ(spc1.groups[0].mass_center.x(), doctest::Approx(3.5));
+        change.positions_only = false;
+        spc1.sync(spc2, change);
+        CHECK_EQ(spc1.particles[0].charge, doctest::Approx(1));
+    }
+
+    SUBCASE("registry")
+    {
+        Space spc2;
+        spc2.geometry = spc1.geometry;
+        spc2.addGroup(0, p);
+        p[1].id = 1;
+        for (auto* space : {&spc1, &spc2}) {
+            space->addGroup(0, p);
+            space->addGroup(0, p);
+        }
+        REQUIRE(spc1.isRegistryValid());
+        CHECK_EQ(spc1.countAtoms(0), 4);
+        CHECK_EQ(spc1.countAtoms(1), 2);
+        CHECK_EQ(spc1.numActiveMolecules(0), 3);
+        CHECK_EQ(std::ranges::distance(spc1.findMolecules(0, Space::Selection::ALL)), 3);
+
+        spc2.groups[1].deactivate(spc2.groups[1].begin(), spc2.groups[1].end());
+        spc2.particles[4].id = 1; // swap atom type
+        Change change;
+        auto& group_change = change.groups.emplace_back();
+        group_change.group_index = 1;
+        group_change.all = true;
+        auto& swap_change = change.groups.emplace_back();
+        swap_change.group_index = 2;
+        swap_change.relative_atom_indices = {0};
+        spc2.updateInternalState(change);
+        CHECK_EQ(spc2.countAtoms(0), 2);
+        CHECK_EQ(spc2.countAtoms(1), 2);
+        CHECK_EQ(spc2.numActiveMolecules(0), 2);
+        CHECK_EQ(std::ranges::distance(spc2.findMolecules(0, Space::Selection::INACTIVE)), 1);
+        Random random;
+        for (int i = 0; i < 10; ++i) {
+            CHECK_NE(spc2.randomMolecule(0, random), spc2.groups.begin() + 1);
+        }
+
+        spc1.sync(spc2, change);
+        CHECK_EQ(spc1.countAtoms(0), 2);
+        CHECK_EQ(spc1.countAtoms(1), 2);
+        CHECK_EQ(spc1.numActiveMolecules(0), 2);
+
+        // exchange of the whole state, as in parallel tempering, without updating `spc2`
+        spc2.groups[0].resize(0);
+        spc2.groups[1].resize(2);
+        spc2.particles[3].id = 0;
+        change.clear();
+        change.everything = true;
+        spc1.sync(spc2, change);
+        CHECK_EQ(spc1.countAtoms(0), 3);
+        CHECK_EQ(spc1.countAtoms(1), 1);
+        CHECK_EQ(spc1.numActiveMolecules(0), 2);
+        auto inactive = spc1.findMolecules(0, Space::Selection::INACTIVE);
+        REQUIRE_EQ(std::ranges::distance(inactive), 1);
+        CHECK_EQ(&*inactive.begin(), &spc1.groups[0]);
+    }
 }
 
 TEST_CASE("[Faunus] Space::toIndices")
@@ -680,6 +996,42 @@ TEST_CASE("[Faunus] Space::updateParticles")
     }
 }
 
+TEST_CASE("[Faunus] Space::enableParticleArrays")
+{
+    using doctest::Approx;
+    Space spc1, spc2;
+    SpaceFactory::makeWater(spc1, 2, R"( {"type": "cuboid", "length": 20} )"_json);
+    SpaceFactory::makeWater(spc2, 2, R"( {"type": "cuboid", "length": 20} )"_json);
+    Change everything;
+    everything.everything = true;
+    spc2.sync(spc1, everything);
+    CHECK_FALSE(spc2.hasParticleArrays());
+    const auto& arrays = spc2.enableParticleArrays();
+    CHECK(spc2.hasParticleArrays());
+    REQUIRE_EQ(arrays.size(), spc2.particles.size());
+    CHECK_EQ(arrays.x[4], Approx(spc1.particles[4].pos.x()));
+    CHECK_EQ(arrays.id[4], spc1.particles[4].id);
+
+    // partial sync
+    spc1.particles[4].pos = {1.0, 2.0, 3.0};
+    Change change;
+    auto& group_change = change.groups.emplace_back();
+    group_change.group_index = 1;
+    group_change.relative_atom_indices = {1};
+    spc2.sync(spc1, change);
+    CHECK_EQ(arrays.z[4], Approx(3.0));
+
+    std::vector<Point> positions = {{4.0, 5.0, 6.0}};
+    spc2.updateParticles(positions.begin(), positions.end(), spc2.particles.begin() + 5,
+                         [](const auto& pos, auto& particle) { particle.pos = pos; });
+    CHECK_EQ(arrays.y[5], Approx(5.0));
+
+    spc2.scaleVolume(2.0 * spc2.geometry.getVolume(), Geometry::VolumeMethod::ISOTROPIC);
+    for (std::size_t i = 0; i < spc2.particles.size(); ++i) {
+        CHECK_EQ(arrays.x[i], Approx(spc2.particles[i].pos.x()));
+    }
+}
+
 TEST_SUITE_END();
 
 namespace SpaceFactory {
@@ -940,6 +1292,7 @@ void InsertMoleculesInSpace::insertMolecules(const json& j, Space& spc)
             throw ConfigurationError("error inserting {}: {}", molecule_name, e.what());
         }
     }
+    spc.updateRegistry(); // groups may have been deactivated after insertion
     faunus_logger->trace("particles inserted = {}", spc.particles.size());
     faunus_logger->trace("groups inserted = {}", spc.groups.size());
 }
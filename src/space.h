@@ -6,6 +6,7 @@
 #include <ranges>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/filter.hpp>
+#include <range/v3/view/transform.hpp>
 #include <range/v3/range/conversion.hpp>
 
 namespace Faunus {
@@ -36,6 +37,7 @@ struct Change
     bool moved_to_moved_interactions =
         true; //!< If several groups are moved, should they interact with each other?
     bool disable_translational_entropy = false; //!< Force exclusion of translational entropy
+    bool positions_only = false; //!< Only positions, mass centers and volume changed (scaling)
 
     //! Properties of changed groups
     struct GroupChange
@@ -117,6 +119,25 @@ class Space
     std::vector<SyncTrigger>
         onSyncTriggers; //!< Every element called after two Space objects are synched with `sync()`
 
+    /** @brief Sorted group indices of a single molecule type */
+    struct MoleculeRegistry
+    {
+        std::vector<std::size_t> groups; //!< All groups of the molecule type
+        std::vector<std::size_t> active; //!< Groups where size equals capacity
+    };
+
+    std::vector<MoleculeRegistry> molecule_registry; //!< Group indices for each molecule id
+    std::vector<std::size_t> active_atom_count;      //!< Active particle count of each atom id
+    std::vector<int> registered_atom_ids;            //!< Registered atom id of each particle
+    std::vector<std::size_t> registered_group_sizes; //!< Registered size of each group
+
+    ParticleArrays particle_arrays;        //!< Optional structure-of-arrays mirror of `particles`
+    bool maintain_particle_arrays = false; //!< True if `particle_arrays` is kept up to date
+
+    [[nodiscard]] const MoleculeRegistry& getMoleculeRegistry(MoleculeData::index_type molid) const;
+    void updateGroupRegistry(std::size_t group_index,
+                             const std::vector<Change::index_type>* relative_atom_indices);
+
   public:
     ParticleVector particles; //!< All particles are stored here!
     GroupVector groups;       //!< All groups are stored here (i.e. molecules)
@@ -124,6 +145,27 @@ class Space
     std::vector<ScaleVolumeTrigger>
         scaleVolumeTriggers; //!< Functions triggered whenever the volume is scaled
 
+    /**
+     * @brief Rebuild molecule and atom registries from scratch
+     *
+     * Registries are maintained by `addGroup()`, `sync()`, and `updateInternalState()`. This must
+     * be called if groups are added, activated, or deactivated by other means.
+     */
+    void updateRegistry();
+    void updateRegistry(const Change& change); //!< Update registries for changed groups only
+    [[nodiscard]] bool isRegistryValid() const; //!< True if registries match particles and groups
+
+    /**
+     * @brief Start maintaining a structure-of-arrays mirror of the particles
+     *
+     * Once enabled, the mirror is kept up to date by `sync()`, `updateParticles()`, and
+     * `scaleVolume()`. Moves modify `particles` directly, so rows of a pending change must be
+     * refreshed with `updateParticleArrays()` before the mirror is read.
+     */
+    const ParticleArrays& enableParticleArrays();
+    void updateParticleArrays(const Change& change); //!< Refresh mirror rows of changed particles
+    [[nodiscard]] bool hasParticleArrays() const;     //!< True if the mirror is maintained
+
     [[nodiscard]] const std::map<MoleculeData::index_type, std::size_t>&
     getImplicitReservoir() const;                                            //!< Implicit molecules
     std::map<MoleculeData::index_type, std::size_t>& getImplicitReservoir(); //!< Implicit molecules
@@ -187,6 +229,7 @@ class Space
      *
      * - particles
      * - molecular mass centers of affected groups
+     * - particle arrays, if enabled
      * - future: update cell list?
      *
      * @todo Since Space::groups is ordered, binary search could be used to filter
@@ -199,6 +242,7 @@ class Space
     {
 
         const auto size = std::distance(begin, end); // number of affected particles
+        const auto first_index = std::distance(particles.begin(), destination);
 
         assert(destination >= particles.begin() && destination < particles.end());
         assert(size <= std::distance(destination, particles.end()));
@@ -211,6 +255,9 @@ class Space
         // copy data from source range (this modifies `destination`)
         std::for_each(begin, end,
                       [&](const auto& source) { copy_function(source, *destination++); });
+        if (maintain_particle_arrays && particle_arrays.size() == particles.size()) {
+            particle_arrays.update(particles, first_index, first_index + size);
+        }
 
         std::ranges::for_each(affected_groups, [&](Group& group) {
             group.updateMassCenter(geometry.getBoundaryFunc(), group.begin()->pos);
@@ -226,8 +273,9 @@ class Space
      * - mass centers;
      * - particle trackers
      * - cell lists
+     * - molecule and atom registries
      *
-     * @todo Under construction and currently not in use
+     * @todo Under construction; currently only registries are updated
      */
     void updateInternalState(const Change& change);
 
@@ -282,24 +330,42 @@ class Space
     }
 
     /**
-     * @brief Finds all groups of type `molid` (complexity: order N)
+     * @brief Finds all groups of type `molid` (complexity: number of `molid` groups)
      * @param molid Molecular id to look for
      * @param selection Selection
      * @return range with all groups of molid
+     *
+     * The selection is applied to the current state of each group, so the range is valid also
+     * while groups are being activated or deactivated.
      */
     auto findMolecules(MoleculeData::index_type molid, Selection selection = Selection::ACTIVE)
     {
+        if (!isRegistryValid()) {
+            updateRegistry();
+        }
         auto group_filter = getGroupFilter(molid, selection);
-        return groups | ranges::cpp20::views::filter(group_filter);
+        auto to_group = [&groups = groups](auto group_index) -> GroupType& {
+            return groups[group_index];
+        };
+        return getMoleculeRegistry(molid).groups | ranges::cpp20::views::transform(to_group) |
+               ranges::cpp20::views::filter(group_filter);
     }
 
     [[nodiscard]] auto findMolecules(MoleculeData::index_type molid,
                                      Selection selection = Selection::ACTIVE) const
     {
+        assert(isRegistryValid());
         auto group_filter = getGroupFilter(molid, selection);
-        return groups | ranges::cpp20::views::filter(group_filter);
+        auto to_group = [&groups = groups](auto group_index) -> const GroupType& {
+            return groups[group_index];
+        };
+        return getMoleculeRegistry(molid).groups | ranges::cpp20::views::transform(to_group) |
+               ranges::cpp20::views::filter(group_filter);
     }
 
+    [[nodiscard]] std::size_t
+    numActiveMolecules(MoleculeData::index_type molid) const; //!< Number of full `molid` groups
+
     auto activeParticles()
     {
         return groups | ranges::cpp20::views::join;
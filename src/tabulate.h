@@ -8,6 +8,10 @@
 #include <cmath>
 #include <memory>
 #include <concepts>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <iterator>
 
 namespace Faunus {
 
@@ -306,6 +310,232 @@ template <std::floating_point T = double> class Andrea : public TabulatorBase<T>
         return td;
     }
 };
+
+/**
+ * @brief Function tabulated on a regular grid in one, two, or three dimensions
+ *
+ * The grid spans a box from `lower` to `upper` and only the selected axes are tabulated;
+ * coordinates along the other axes are set to zero when tabulating and are ignored upon
+ * lookup. Values are interpolated either multilinearly or with tensor-product Catmull-Rom
+ * (cubic) polynomials which at the outermost intervals use quadratically extrapolated ghost
+ * nodes. Each node stores one value, `sizeof(T)` bytes, and grids with more than `max_size`
+ * nodes are rejected as they would exhaust memory.
+ */
+template <std::floating_point T = double> class Grid
+{
+  public:
+    using Coordinate = std::array<T, 3>;
+    enum class Interpolation
+    {
+        LINEAR,
+        CUBIC
+    };
+    static constexpr std::size_t max_size = std::size_t(1) << 24; //!< Maximum number of nodes
+
+  private:
+    Coordinate lower;                     //!< Lower corner of the box
+    Coordinate upper;                     //!< Upper corner of the box
+    Coordinate inverse_spacing = {0, 0, 0}; //!< Inverse spacing along each axis
+    std::array<int, 3> number_of_nodes = {1, 1, 1}; //!< Nodes along each axis; 1 if not tabulated
+    Interpolation interpolation;
+    std::vector<T> values; //!< Function values with x running fastest
+
+    /** @brief Nodes and weights along a single axis */
+    struct Stencil
+    {
+        std::array<int, 4> nodes = {0, 0, 0, 0};
+        std::array<T, 4> weights = {1, 0, 0, 0};
+        int size = 1;
+    };
+
+    Stencil stencil(const int axis, const T coordinate) const
+    {
+        Stencil stencil;
+        const auto n = number_of_nodes[axis];
+        if (n == 1) {
+            return stencil;
+        }
+        const auto u = (coordinate - lower[axis]) * inverse_spacing[axis];
+        const auto i = std::clamp(static_cast<int>(std::floor(u)), 0, n - 2);
+        const auto t = u - static_cast<T>(i);
+        if (interpolation == Interpolation::LINEAR) {
+            stencil.size = 2;
+            stencil.nodes = {i, i + 1, 0, 0};
+            stencil.weights = {1 - t, t, 0, 0};
+        }
+        else {
+            const auto t2 = t * t;
+            const auto t3 = t2 * t;
+            stencil.size = 4;
+            stencil.nodes = {i - 1, i, i + 1, i + 2};
+            stencil.weights = {(-t3 + 2 * t2 - t) / 2, (3 * t3 - 5 * t2 + 2) / 2,
+                               (-3 * t3 + 4 * t2 + t) / 2, (t3 - t2) / 2};
+            if (i == 0) { // ghost node, f(-1) = 3f(0) - 3f(1) + f(2)
+                stencil.nodes = {0, 1, 2, 0};
+                stencil.weights = {stencil.weights[1] + 3 * stencil.weights[0],
+                                   stencil.weights[2] - 3 * stencil.weights[0],
+                                   stencil.weights[3] + stencil.weights[0], 0};
+            }
+            else if (i == n - 2) { // ghost node, f(n) = 3f(n-1) - 3f(n-2) + f(n-3)
+                stencil.nodes[3] = n - 1;
+                stencil.weights[0] += stencil.weights[3];
+                stencil.weights[1] -= 3 * stencil.weights[3];
+                stencil.weights[2] += 3 * stencil.weights[3];
+                stencil.weights[3] = 0;
+            }
+        }
+        return stencil;
+    }
+
+  public:
+    /**
+     * @brief Number of nodes of a grid, without allocating it; arguments as for the constructor
+     *
+     * The count is returned as a floating point number so that it can be compared with
+     * `max_size` without integer overflow.
+     */
+    static double countNodes(const Coordinate& lower, const Coordinate& upper,
+                             const std::array<bool, 3>& axes, const T spacing,
+                             const Interpolation interpolation)
+    {
+        if (spacing <= 0) {
+            throw std::invalid_argument("grid spacing must be positive");
+        }
+        const auto minimum_nodes = interpolation == Interpolation::LINEAR ? 2.0 : 4.0;
+        double total_nodes = 1.0;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (axes[axis]) {
+                const auto length = upper[axis] - lower[axis];
+                if (length <= 0) {
+                    throw std::invalid_argument("grid box must have a positive size");
+                }
+                total_nodes *= std::max<double>(minimum_nodes, std::ceil(length / spacing) + 1);
+            }
+        }
+        return total_nodes;
+    }
+
+    /**
+     * @brief Grid with all node values set to zero; see `nodes()` and `setValues()`
+     * @param lower Lower corner of the box
+     * @param upper Upper corner of the box
+     * @param axes Tabulated axes
+     * @param spacing Maximum node spacing along each tabulated axis
+     * @param interpolation Interpolation scheme
+     */
+    Grid(const Coordinate& lower, const Coordinate& upper, const std::array<bool, 3>& axes,
+         const T spacing, const Interpolation interpolation)
+        : lower(lower)
+        , upper(upper)
+        , interpolation(interpolation)
+    {
+        const auto total_nodes = countNodes(lower, upper, axes, spacing, interpolation);
+        if (total_nodes > static_cast<double>(max_size)) {
+            throw std::length_error("grid with " + std::to_string(std::llround(total_nodes)) +
+                                    " nodes exceeds the maximum of " + std::to_string(max_size) +
+                                    "; increase the spacing or tabulate fewer axes");
+        }
+        const auto minimum_nodes = interpolation == Interpolation::LINEAR ? 2 : 4;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (axes[axis]) {
+                const auto length = upper[axis] - lower[axis];
+                number_of_nodes[axis] =
+                    std::max(minimum_nodes, static_cast<int>(std::ceil(length / spacing)) + 1);
+                inverse_spacing[axis] = (number_of_nodes[axis] - 1) / length;
+            }
+        }
+        values.assign(size(), T(0));
+    }
+
+    /**
+     * @param lower Lower corner of the box
+     * @param upper Upper corner of the box
+     * @param axes Tabulated axes
+     * @param spacing Maximum node spacing along each tabulated axis
+     * @param interpolation Interpolation scheme
+     * @param function Function to tabulate
+     */
+    Grid(const Coordinate& lower, const Coordinate& upper, const std::array<bool, 3>& axes,
+         const T spacing, const Interpolation interpolation,
+         const std::function<T(const Coordinate&)>& function)
+        : Grid(lower, upper, axes, spacing, interpolation)
+    {
+        std::ranges::transform(nodes(), values.begin(), function);
+    }
+
+    /** Coordinates of all nodes in storage order; zero along axes that are not tabulated */
+    std::vector<Coordinate> nodes() const
+    {
+        std::vector<Coordinate> points;
+        points.reserve(size());
+        Coordinate point;
+        for (int k = 0; k < number_of_nodes[2]; ++k) {
+            for (int j = 0; j < number_of_nodes[1]; ++j) {
+                for (int i = 0; i < number_of_nodes[0]; ++i) {
+                    const std::array<int, 3> node = {i, j, k};
+                    for (int axis = 0; axis < 3; ++axis) {
+                        point[axis] = number_of_nodes[axis] == 1
+                                          ? T(0)
+                                          : lower[axis] + node[axis] / inverse_spacing[axis];
+                    }
+                    points.push_back(point);
+                }
+            }
+        }
+        return points;
+    }
+
+    /** Set all node values, ordered as `nodes()` */
+    void setValues(std::vector<T> node_values)
+    {
+        if (node_values.size() != size()) {
+            throw std::invalid_argument("number of values must match number of grid nodes");
+        }
+        values = std::move(node_values);
+    }
+
+    /** Number of grid nodes */
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(number_of_nodes[0]) * number_of_nodes[1] *
+               number_of_nodes[2];
+    }
+
+    /** True if the point is within the box along all tabulated axes */
+    bool contains(const Coordinate& point) const
+    {
+        for (int axis = 0; axis < 3; ++axis) {
+            if (number_of_nodes[axis] > 1 &&
+                (point[axis] < lower[axis] || point[axis] > upper[axis])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Interpolated function value; the point must be within the box */
+    T operator()(const Coordinate& point) const
+    {
+        const auto x = stencil(0, point[0]);
+        const auto y = stencil(1, point[1]);
+        const auto z = stencil(2, point[2]);
+        T sum = 0;
+        for (int k = 0; k < z.size; ++k) {
+            for (int j = 0; j < y.size; ++j) {
+                const auto offset =
+                    (static_cast<std::size_t>(z.nodes[k]) * number_of_nodes[1] + y.nodes[j]) *
+                    number_of_nodes[0];
+                T sum_x = 0;
+                for (int i = 0; i < x.size; ++i) {
+                    sum_x += x.weights[i] * values[offset + x.nodes[i]];
+                }
+                sum += z.weights[k] * y.weights[j] * sum_x;
+            }
+        }
+        return sum;
+    }
+};
+
 } // namespace Tabulate
 } // namespace Faunus
 
@@ -363,4 +593,65 @@ TEST_CASE("[Faunus] Andrea")
     x = 5;
     CHECK(spline.evalDer(d, x) == Approx(f_prime_exact(x)));
 }
+
+TEST_CASE("[Faunus] Tabulate::Grid")
+{
+    using doctest::Approx;
+    using Grid = Faunus::Tabulate::Grid<double>;
+    const Grid::Coordinate lower = {-2.0, -3.0, -1.0};
+    const Grid::Coordinate upper = {2.0, 3.0, 1.0};
+
+    SUBCASE("Linear function is exact")
+    {
+        auto f = [](const Grid::Coordinate& p) { return 1.0 + 2.0 * p[0] - p[1] + 0.5 * p[2]; };
+        for (auto interpolation : {Grid::Interpolation::LINEAR, Grid::Interpolation::CUBIC}) {
+            Grid grid(lower, upper, {true, true, true}, 0.3, interpolation, f);
+            for (const auto& point : {Grid::Coordinate{0.1, -2.9, 0.77}, {-2.0, 3.0, 1.0},
+                                      Grid::Coordinate{1.33, 0.0, -0.25}}) {
+                CHECK(grid.contains(point));
+                CHECK_EQ(grid(point), Approx(f(point)));
+            }
+        }
+    }
+
+    SUBCASE("One dimension")
+    {
+        auto f = [](const Grid::Coordinate& p) { return std::sin(p[2]); };
+        Grid linear(lower, upper, {false, false, true}, 0.01, Grid::Interpolation::LINEAR, f);
+        Grid cubic(lower, upper, {false, false, true}, 0.1, Grid::Interpolation::CUBIC, f);
+        CHECK_EQ(linear.size(), 201);
+        CHECK_EQ(cubic.size(), 21);
+        CHECK(cubic.contains({100.0, -100.0, 0.5})); // x and y are not tabulated
+        CHECK_FALSE(cubic.contains({0.0, 0.0, 1.5}));
+        for (double z = -0.95; z < 1.0; z += 0.1) {
+            CHECK_EQ(linear({5.0, 5.0, z}), Approx(std::sin(z)).epsilon(1e-4));
+            CHECK_EQ(cubic({0.0, 0.0, z}), Approx(std::sin(z)).epsilon(1e-4));
+        }
+    }
+
+    SUBCASE("Externally set values")
+    {
+        auto f = [](const Grid::Coordinate& p) { return p[0] + 2.0 * p[1] - p[2]; };
+        Grid tabulated(lower, upper, {true, true, true}, 0.5, Grid::Interpolation::LINEAR, f);
+        Grid grid(lower, upper, {true, true, true}, 0.5, Grid::Interpolation::LINEAR);
+        std::vector<double> values;
+        std::ranges::transform(grid.nodes(), std::back_inserter(values), f);
+        grid.setValues(values);
+        CHECK_EQ(grid({0.3, -0.2, 0.7}), Approx(tabulated({0.3, -0.2, 0.7})));
+        CHECK_THROWS(grid.setValues({1.0}));
+    }
+
+    SUBCASE("Invalid input")
+    {
+        auto f = [](const Grid::Coordinate&) { return 0.0; };
+        CHECK_THROWS(Grid(lower, upper, {true, false, false}, 0.0, Grid::Interpolation::LINEAR, f));
+        CHECK_THROWS(Grid(upper, lower, {true, false, false}, 0.1, Grid::Interpolation::LINEAR, f));
+        CHECK_THROWS_AS(Grid(lower, upper, {true, true, true}, 0.01, Grid::Interpolation::LINEAR),
+                        std::length_error); // 401 x 601 x 201 nodes
+        const auto spacing = std::ldexp(1.0, -16); // exact binary fraction; 6 * 2^16 intervals
+        CHECK_EQ(Grid(lower, upper, {false, true, false}, spacing, Grid::Interpolation::LINEAR)
+                     .size(),
+                 6 * (1 << 16) + 1);
+    }
+}
 #endif
@@ -0,0 +1,206 @@
+#include <doctest/doctest.h>
+#include "threadpool.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace Faunus {
+
+ThreadPool::ThreadPool(unsigned int number_of_threads)
+{
+    if (number_of_threads == 0) {
+        number_of_threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    for (unsigned int i = 0; i < number_of_threads; ++i) {
+        queues.push_back(std::make_unique<TaskQueue>());
+    }
+    for (std::size_t i = 1; i < queues.size(); ++i) {
+        workers.emplace_back([this, i]() { work(i); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(mutex);
+        stop = true;
+    }
+    wake_up.notify_all();
+    std::for_each(workers.begin(), workers.end(), [](auto& worker) { worker.join(); });
+}
+
+std::size_t ThreadPool::size() const
+{
+    return queues.size();
+}
+
+/**
+ * The own queue is served from the back and other queues are stolen from at the front. Upon
+ * completing the last task of a batch, the waiting caller is notified.
+ */
+bool ThreadPool::runNextTask(const std::size_t queue_index)
+{
+    for (std::size_t offset = 0; offset < queues.size(); ++offset) {
+        auto& queue = *queues[(queue_index + offset) % queues.size()];
+        Task* task = nullptr;
+        {
+            std::lock_guard lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (offset == 0) {
+                task = queue.tasks.back();
+                queue.tasks.pop_back();
+            }
+            else {
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+            }
+        }
+        --queued_tasks;
+        try {
+            (*task)();
+        }
+        catch (...) {
+            std::lock_guard lock(mutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+        if (--pending_tasks == 0) {
+            std::lock_guard lock(mutex);
+            batch_done.notify_all();
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Batch tasks are preferred over background tasks, and remaining background tasks are
+ * completed before the worker exits.
+ */
+void ThreadPool::work(const std::size_t queue_index)
+{
+    while (true) {
+        if (runNextTask(queue_index)) {
+            continue;
+        }
+        std::packaged_task<void()> background_task;
+        {
+            std::unique_lock lock(mutex);
+            wake_up.wait(lock, [&]() {
+                return stop || queued_tasks > 0 || !background_tasks.empty();
+            });
+            if (queued_tasks > 0) {
+                continue;
+            }
+            if (background_tasks.empty()) {
+                return; // stopped
+            }
+            background_task = std::move(background_tasks.front());
+            background_tasks.pop_front();
+        }
+        background_task(); // exceptions are stored in the future
+    }
+}
+
+/**
+ * @param task Task to run
+ * @return Future that is ready when the task has completed and rethrows any exception from it
+ */
+std::future<void> ThreadPool::runInBackground(Task task)
+{
+    std::packaged_task<void()> background_task(std::move(task));
+    auto future = background_task.get_future();
+    if (workers.empty()) {
+        background_task();
+        return future;
+    }
+    {
+        std::lock_guard lock(mutex);
+        background_tasks.push_back(std::move(background_task));
+    }
+    wake_up.notify_one();
+    return future;
+}
+
+/**
+ * @throw Rethrows the first exception thrown by any of the tasks
+ */
+void ThreadPool::run(std::vector<Task>& tasks)
+{
+    if (tasks.empty()) {
+        return;
+    }
+    if (workers.empty()) {
+        std::for_each(tasks.begin(), tasks.end(), [](auto& task) { task(); });
+        return;
+    }
+    pending_tasks = tasks.size();
+    {
+        std::lock_guard lock(mutex);
+        queued_tasks = tasks.size(); // set before queueing as tasks may be taken immediately
+    }
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        auto& queue = *queues[i % queues.size()];
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back(&tasks[i]);
+    }
+    wake_up.notify_all();
+    while (runNextTask(0)) {
+    }
+    std::unique_lock lock(mutex);
+    batch_done.wait(lock, [&]() { return pending_tasks == 0; });
+    if (exception) {
+        std::rethrow_exception(std::exchange(exception, nullptr));
+    }
+}
+
+TEST_CASE("[Faunus] ThreadPool")
+{
+    for (const auto number_of_threads : {1U, 2U, 5U}) {
+        ThreadPool pool(number_of_threads);
+        CHECK_EQ(pool.size(), number_of_threads);
+        std::vector<int> results(1000, 0);
+        std::vector<ThreadPool::Task> tasks;
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            tasks.emplace_back([&results, i]() { results[i] = static_cast<int>(i); });
+        }
+        for (int batch = 0; batch < 3; ++batch) {
+            std::fill(results.begin(), results.end(), 0);
+            pool.run(tasks);
+            CHECK_EQ(std::accumulate(results.begin(), results.end(), 0), 999 * 1000 / 2);
+        }
+        tasks.emplace_back([]() { throw std::runtime_error("task error"); });
+        CHECK_THROWS_AS(pool.run(tasks), std::runtime_error);
+        tasks.pop_back();
+        CHECK_NOTHROW(pool.run(tasks));
+    }
+}
+
+TEST_CASE("[Faunus] ThreadPool::runInBackground")
+{
+    for (const auto number_of_threads : {1U, 3U}) {
+        ThreadPool pool(number_of_threads);
+        std::atomic<int> counter = 0;
+        std::vector<std::future<void>> futures;
+        for (int i = 0; i < 10; ++i) {
+            futures.push_back(pool.runInBackground([&counter]() { ++counter; }));
+        }
+        std::vector<int> results(100, 0); // batches still complete with background tasks queued
+        std::vector<ThreadPool::Task> tasks;
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            tasks.emplace_back([&results, i]() { results[i] = 1; });
+        }
+        pool.run(tasks);
+        CHECK_EQ(std::accumulate(results.begin(), results.end(), 0), 100);
+        std::for_each(futures.begin(), futures.end(), [](auto& future) { future.get(); });
+        CHECK_EQ(counter, 10);
+        auto failing = pool.runInBackground([]() { throw std::runtime_error("task error"); });
+        CHECK_THROWS_AS(failing.get(), std::runtime_error);
+    }
+}
+
+} // namespace Faunus
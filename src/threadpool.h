@@ -0,0 +1,79 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Faunus {
+
+/**
+ * @brief Persistent pool of worker threads with work stealing
+ *
+ * Each thread owns a task queue. A batch of tasks is distributed round-robin onto the queues
+ * whereafter each thread takes tasks from the back of its own queue and, once empty, steals
+ * tasks from the front of the other queues. The calling thread takes part in the work and
+ * `run()` returns only when all tasks of the batch are completed. Worker threads sleep
+ * between batches.
+ *
+ * Single tasks can also be run in the background with `runInBackground()`; these are taken
+ * by idle workers, which give priority to batch tasks. As the calling thread takes part in
+ * batches, `run()` completes even if all workers are busy with background tasks.
+ *
+ * Example code:
+ *
+ * ```{.cpp}
+ *     ThreadPool pool(4); // the calling thread and three workers
+ *     std::vector<double> results(100);
+ *     std::vector<ThreadPool::Task> tasks;
+ *     for (size_t i = 0; i < results.size(); ++i) {
+ *         tasks.emplace_back([&results, i]() { results[i] = std::sqrt(i); });
+ *     }
+ *     pool.run(tasks);
+ * ```
+ */
+class ThreadPool
+{
+  public:
+    using Task = std::function<void()>;
+
+  private:
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<Task*> tasks;
+    };
+    std::vector<std::unique_ptr<TaskQueue>> queues; //!< one queue per thread; first is the caller
+    std::vector<std::thread> workers;               //!< worker threads
+    std::mutex mutex;                               //!< guards `queued_tasks` when waiting
+    std::condition_variable wake_up;                //!< signals new tasks or stop to workers
+    std::condition_variable batch_done;             //!< signals completion of a batch
+    std::atomic<std::size_t> queued_tasks = 0;      //!< tasks not yet taken from any queue
+    std::atomic<std::size_t> pending_tasks = 0;     //!< tasks not yet completed
+    bool stop = false;                              //!< tells workers to exit
+    std::exception_ptr exception = nullptr;         //!< first exception thrown by a task
+    std::deque<std::packaged_task<void()>> background_tasks; //!< guarded by `mutex`
+
+    bool runNextTask(std::size_t queue_index); //!< Run own or stolen task; false if none found
+    void work(std::size_t queue_index);        //!< Worker thread main loop
+
+  public:
+    /**
+     * @param number_of_threads Number of threads including the calling thread; zero selects
+     *                          the number of hardware threads
+     */
+    explicit ThreadPool(unsigned int number_of_threads = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    [[nodiscard]] std::size_t size() const; //!< Number of threads including the calling thread
+    void run(std::vector<Task>& tasks);     //!< Run all tasks and wait for completion
+    std::future<void> runInBackground(Task task); //!< Run task on a worker; inline if none
+};
+
+} // namespace Faunus
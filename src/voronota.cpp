@@ -1,8 +1,10 @@
 #include "analysis.h"
 #include "core.h"
+#include "energy.h"
 #include "mpicontroller.h"
 #include <voronotalt/voronotalt.h>
 #include <numeric>
+#include <doctest/doctest.h>
 
 namespace Faunus::analysis {
 
@@ -279,3 +281,298 @@ void Voronota::_sample()
 }
 
 } // namespace Faunus::analysis
+
+namespace Faunus::Energy {
+
+class SASAVoronoi::Impl
+{
+  public:
+    explicit Impl(const double probe_radius)
+        : probe_radius(probe_radius)
+    {
+    }
+
+    voronotalt::SimpleSphere sphere(const Particle& particle) const
+    {
+        return {particle.pos.x(), particle.pos.y(), particle.pos.z(),
+                (0.5 * particle.traits().sigma) + probe_radius};
+    }
+
+    /** Append spheres affected by the latest tessellation update; false if it was a full reinit */
+    bool appendAffected(std::vector<std::size_t>& indices) const
+    {
+        if (tessellation.last_update_was_full_reinit()) {
+            return false;
+        }
+        const auto& affected = tessellation.last_update_ids_of_affected_input_spheres();
+        indices.insert(indices.end(), affected.begin(), affected.end());
+        return true;
+    }
+
+    double probe_radius;
+    bool initialized = false;
+    voronotalt::PeriodicBox periodic_box;
+    voronotalt::UpdateableRadicalTessellation tessellation;
+    std::vector<voronotalt::SimpleSphere> spheres;       //!< one sphere per particle
+    std::vector<voronotalt::UnsignedInt> moved_ids;      //!< spheres with new position or radius
+    std::vector<std::pair<std::size_t, bool>> exclusions; //!< spheres with new exclusion status
+    std::vector<std::size_t> changed_indices;            //!< particles with possibly new energy
+};
+
+/**
+ * @param spc
+ * @param cosolute_molarity in particles per angstrom cubed
+ * @param probe_radius in angstrom
+ */
+SASAVoronoi::SASAVoronoi(const Space& spc, const double cosolute_molarity,
+                         const double probe_radius)
+    : pimpl(std::make_unique<Impl>(probe_radius))
+    , spc(spc)
+    , cosolute_molarity(cosolute_molarity)
+    , probe_radius(probe_radius)
+{
+    name = "sasa_voronoi";
+    citation_information = "doi:10/mq8k";
+    const auto n_pbc = spc.geometry.asSimpleGeometry()->boundary_conditions.isPeriodic().count();
+    use_pbc = (n_pbc == 3);
+    if (n_pbc != 0 && n_pbc != 3) {
+        faunus_logger->warn("{}: Non-uniform PBC is currently ignored - be careful!", name);
+    }
+    init();
+}
+
+SASAVoronoi::SASAVoronoi(const json& j, const Space& spc)
+    : SASAVoronoi(spc, j.at("molarity").get<double>() * 1.0_molar,
+                  j.value("radius", 1.4) * 1.0_angstrom)
+{
+}
+
+SASAVoronoi::~SASAVoronoi() = default;
+
+void SASAVoronoi::init()
+{
+    auto& impl = *pimpl;
+    impl.periodic_box =
+        use_pbc ? analysis::get_periodic_box_from_space(spc) : voronotalt::PeriodicBox();
+    impl.spheres.clear();
+    impl.spheres.reserve(spc.particles.size());
+    for (const auto& particle : spc.particles) {
+        impl.spheres.push_back(impl.sphere(particle));
+    }
+    impl.tessellation.init(impl.spheres, impl.periodic_box);
+    for (const auto& group : spc.groups) {
+        const auto offset = spc.getFirstParticleIndex(group);
+        for (auto index = offset + group.size(); index < offset + group.capacity(); ++index) {
+            impl.tessellation.update_by_setting_exclusion_mask(index, true);
+        }
+    }
+    impl.initialized = true;
+
+    areas.assign(spc.particles.size(), 0.0);
+    energies.assign(spc.particles.size(), 0.0);
+    total_energy = 0.0;
+    impl.changed_indices.resize(spc.particles.size());
+    std::iota(impl.changed_indices.begin(), impl.changed_indices.end(), 0);
+    updateEnergies(impl.changed_indices);
+}
+
+/**
+ * Areas and energies are refreshed for the given particles; the total energy is updated by the
+ * difference so that the cost scales with the number of indices.
+ */
+void SASAVoronoi::updateEnergies(const std::vector<std::size_t>& indices)
+{
+    const auto& cells = pimpl->tessellation.result().cells_summaries;
+    for (const auto index : indices) {
+        const auto& particle = spc.particles[index];
+        const bool excluded = pimpl->tessellation.exclusion_status_of_input_sphere(index);
+        areas[index] = (excluded || index >= cells.size()) ? 0.0 : cells[index].sas_area;
+        const auto energy =
+            areas[index] * (particle.traits().tension + cosolute_molarity * particle.traits().tfe);
+        total_energy += energy - energies[index];
+        energies[index] = energy;
+    }
+}
+
+/**
+ * Only particles in the change object are compared against the tessellation. Moved spheres are
+ * updated in a single call, while (de)activated particles toggle the exclusion mask.
+ */
+void SASAVoronoi::updateTessellation(const Change& change)
+{
+    auto& impl = *pimpl;
+    impl.moved_ids.clear();
+    impl.exclusions.clear();
+    impl.changed_indices.clear();
+
+    for (const auto& group_change : change.groups) {
+        const auto& group = spc.groups.at(group_change.group_index);
+        const auto offset = spc.getFirstParticleIndex(group);
+        auto compare = [&](const std::size_t relative_index) {
+            const auto index = offset + relative_index;
+            const auto sphere = impl.sphere(spc.particles[index]);
+            if (!voronotalt::sphere_equals_sphere(sphere, impl.spheres[index])) {
+                impl.spheres[index] = sphere;
+                impl.moved_ids.push_back(index);
+            }
+            const bool excluded = relative_index >= group.size();
+            if (excluded != impl.tessellation.exclusion_status_of_input_sphere(index)) {
+                impl.exclusions.emplace_back(index, excluded);
+            }
+            impl.changed_indices.push_back(index);
+        };
+        if (group_change.relative_atom_indices.empty()) {
+            for (std::size_t relative_index = 0; relative_index < group.capacity();
+                 ++relative_index) {
+                compare(relative_index);
+            }
+        }
+        else {
+            std::ranges::for_each(group_change.relative_atom_indices, compare);
+        }
+    }
+
+    bool local_update = true;
+    if (!impl.moved_ids.empty()) {
+        impl.tessellation.update(impl.spheres, impl.moved_ids);
+        local_update = impl.appendAffected(impl.changed_indices);
+    }
+    for (const auto [index, excluded] : impl.exclusions) {
+        impl.tessellation.update_by_setting_exclusion_mask(index, excluded);
+        local_update = impl.appendAffected(impl.changed_indices) && local_update;
+    }
+
+    if (!local_update) {
+        impl.changed_indices.resize(spc.particles.size());
+        std::iota(impl.changed_indices.begin(), impl.changed_indices.end(), 0);
+    }
+    else {
+        std::sort(impl.changed_indices.begin(), impl.changed_indices.end());
+        impl.changed_indices.erase(
+            std::unique(impl.changed_indices.begin(), impl.changed_indices.end()),
+            impl.changed_indices.end());
+    }
+    updateEnergies(impl.changed_indices);
+}
+
+double SASAVoronoi::energy(const Change& change)
+{
+    if (change.everything || change.volume_change) {
+        init();
+    }
+    else if (change) {
+        updateTessellation(change);
+    }
+    return total_energy;
+}
+
+/**
+ * The other instance is not copied; instead the change is replayed on our own (already synced)
+ * space, which touches only the spheres around the changed particles.
+ */
+void SASAVoronoi::sync(EnergyTerm* energybase_ptr, const Change& change)
+{
+    if (dynamic_cast<SASAVoronoi*>(energybase_ptr) != nullptr) {
+        energy(change);
+    }
+}
+
+void SASAVoronoi::to_json(json& j) const
+{
+    j["molarity"] = cosolute_molarity / 1.0_molar;
+    j["radius"] = probe_radius / 1.0_angstrom;
+    j["area"] = std::accumulate(areas.begin(), areas.end(), 0.0);
+    roundJSON(j, 6);
+}
+
+const std::vector<double>& SASAVoronoi::getAreas() const
+{
+    return areas;
+}
+
+TEST_CASE("[Faunus] SASAVoronoi")
+{
+    using doctest::Approx;
+    atoms = R"([
+        { "A": { "sigma": 4.0, "tfe": 1.0 } },
+        { "B": { "sigma": 2.4, "tfe": 1.0 } }
+    ])"_json.get<decltype(atoms)>();
+    molecules = R"([
+        { "M": { "atoms": ["A", "B"], "atomic": true } }
+    ])"_json.get<decltype(molecules)>();
+    Space spc = R"({
+        "geometry": {"type": "cuboid", "length": [50.0, 50.0, 50.0] },
+        "insertmolecules": [ { "M": { "N": 1 } } ]
+    })"_json;
+    spc.particles.at(0).pos = {10.0, 0.0, 0.0};
+    spc.particles.at(1).pos = {-10.0, 0.0, 0.0};
+
+    SASAVoronoi sasa(spc, 1.0, 1.4_angstrom); // unit molarity so that energy equals area
+    Change change;
+    change.everything = true;
+    CHECK_EQ(sasa.energy(change), Approx(4.0 * pc::pi * (3.4 * 3.4 + 2.6 * 2.6)));
+
+    SUBCASE("local update equals full tessellation")
+    {
+        spc.particles.at(1).pos = {7.0, 0.0, 0.0};
+        Change local_change;
+        Change::GroupChange group_change;
+        group_change.group_index = 0;
+        group_change.relative_atom_indices = {1};
+        local_change.groups.push_back(group_change);
+        const auto incremental_energy = sasa.energy(local_change);
+        CHECK_LT(incremental_energy, 4.0 * pc::pi * (3.4 * 3.4 + 2.6 * 2.6));
+
+        SASAVoronoi reference(spc, 1.0, 1.4_angstrom);
+        CHECK_EQ(incremental_energy, Approx(reference.energy(change)));
+        CHECK_EQ(sasa.getAreas()[0], Approx(reference.getAreas()[0]));
+        CHECK_EQ(sasa.getAreas()[1], Approx(reference.getAreas()[1]));
+    }
+
+    SUBCASE("inactive particles are excluded")
+    {
+        spc.groups[0].deactivate(spc.groups[0].begin() + 1, spc.groups[0].end());
+        Change local_change;
+        Change::GroupChange group_change;
+        group_change.group_index = 0;
+        group_change.relative_atom_indices = {1};
+        local_change.groups.push_back(group_change);
+        CHECK_EQ(sasa.energy(local_change), Approx(4.0 * pc::pi * 3.4 * 3.4));
+        CHECK_EQ(sasa.getAreas()[1], 0.0);
+    }
+
+    SUBCASE("rejected move is undone by sync")
+    {
+        Space trial_spc = R"({
+            "geometry": {"type": "cuboid", "length": [50.0, 50.0, 50.0] },
+            "insertmolecules": [ { "M": { "N": 1 } } ]
+        })"_json;
+        trial_spc.sync(spc, change);
+        SASAVoronoi trial_sasa(trial_spc, 1.0, 1.4_angstrom);
+
+        trial_spc.particles.at(1).pos = {7.0, 0.0, 0.0}; // trial move
+        Change local_change;
+        local_change.groups.push_back({.group_index = 0, .relative_atom_indices = {1}});
+        CHECK_LT(trial_sasa.energy(local_change), sasa.energy(Change()));
+
+        trial_spc.sync(spc, local_change); // reject
+        static_cast<EnergyTerm&>(trial_sasa).sync(&sasa, local_change);
+        SASAVoronoi reference(trial_spc, 1.0, 1.4_angstrom);
+        CHECK_EQ(trial_sasa.energy(Change()), Approx(reference.energy(change)));
+        CHECK_EQ(trial_sasa.getAreas()[1], Approx(reference.getAreas()[1]));
+    }
+
+    SUBCASE("volume change reinitializes")
+    {
+        // particles are brought into contact and the periodic box shrinks
+        spc.scaleVolume(spc.geometry.getVolume() / 64.0, Geometry::VolumeMethod::ISOTROPIC);
+        Change volume_change;
+        volume_change.volume_change = true;
+        const auto scaled_energy = sasa.energy(volume_change);
+        CHECK_LT(scaled_energy, 4.0 * pc::pi * (3.4 * 3.4 + 2.6 * 2.6));
+        SASAVoronoi reference(spc, 1.0, 1.4_angstrom);
+        CHECK_EQ(scaled_energy, Approx(reference.energy(change)));
+    }
+}
+
+} // namespace Faunus::Energy